@@ -77,7 +77,8 @@ IBEELKinematics::IBEELKinematics(const std::string& object_name,
                                  Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
                                  bool register_for_restart)
     : ConstraintIBKinematics(object_name, input_db, l_data_manager, register_for_restart), d_current_time(0.0),
-      d_kinematics_vel(NDIM), d_shape(NDIM), d_center_of_mass(3), d_incremented_angle_from_reference_axis(3),
+      d_kinematics_vel(NDIM), d_shape(NDIM), d_section_vel(NDIM), d_section_origin(NDIM), d_reference_normal(NDIM),
+      d_center_of_mass(3), d_incremented_angle_from_reference_axis(3),
       d_tagged_pt_position(3), d_mesh_width(NDIM), d_parser_time(new double), d_parser_posn(new double[NDIM]),
       d_parser_normal(new double[NDIM])
 {
@@ -281,6 +282,38 @@ void IBEELKinematics::setImmersedBodyLayout(Pointer<PatchHierarchy<NDIM> > patch
         d_ImmersedBodyData.insert(std::make_pair(s, NumPtsInHeight));
     }
 
+    // Cache the body-frame layout of the eel. The points of each cross section are offset from the body axis along
+    // the normal direction, so that the kinematics only need to be evaluated once per cross section.
+    std::vector<double> section_arc_length;
+    std::vector<int> section_num_pts;
+    std::vector<std::vector<double> > body_frame_coords(NDIM);
+    for (std::map<double, int>::const_iterator mitr = d_ImmersedBodyData.begin(); mitr != d_ImmersedBodyData.end();
+         ++mitr)
+    {
+        const int NumPtsInSection = mitr->second;
+        section_arc_length.push_back(mitr->first);
+        section_num_pts.push_back(NumPtsInSection);
+        for (int j = 1; j <= NumPtsInSection / 2; ++j)
+        {
+            body_frame_coords[0].push_back(0.0);
+            body_frame_coords[1].push_back((j - 1) * d_mesh_width[1]);
+        }
+        for (int j = 1; j <= NumPtsInSection / 2; ++j)
+        {
+            body_frame_coords[0].push_back(0.0);
+            body_frame_coords[1].push_back(-j * d_mesh_width[1]);
+        }
+    }
+    setBodyLayout(section_arc_length, section_num_pts, body_frame_coords);
+
+    const int num_sections = getNumberOfSections();
+    for (int d = 0; d < NDIM; ++d)
+    {
+        d_section_vel[d].resize(num_sections);
+        d_section_origin[d].resize(num_sections);
+        d_reference_normal[d].resize(num_sections);
+    }
+
     // Find the coordinates of the axis of maneuvering in the reference frame from the input file.
     if (d_bodyIsManeuvering)
     {
@@ -337,12 +370,29 @@ void IBEELKinematics::setImmersedBodyLayout(Pointer<PatchHierarchy<NDIM> > patch
             d_maneuverAxisReferenceCoordinates_vec[i][0] -= maneuverAxis_x_cm;
             d_maneuverAxisReferenceCoordinates_vec[i][1] -= maneuverAxis_y_cm;
         }
+
+        setReferenceNormals();
     } // body is maneuvering
 
     return;
 
 } // setImmersedBodyLayout
 
+void IBEELKinematics::setReferenceNormals()
+{
+    const std::vector<double>& arc_length = getSectionArcLength();
+    const int num_sections = getNumberOfSections();
+    for (int k = 0; k < num_sections; ++k)
+    {
+        const double s = arc_length[k];
+        d_reference_normal[0][k] = -sin(d_map_reference_tangent[s]) * d_map_reference_sign[s][1];
+        d_reference_normal[1][k] = cos(d_map_reference_tangent[s]) * d_map_reference_sign[s][0];
+    }
+
+    return;
+
+} // setReferenceNormals
+
 void IBEELKinematics::transformManeuverAxisAndCalculateTangents(const double angleFromHorizontal)
 {
     d_maneuverAxisTransformedCoordinates_vec.clear();
@@ -512,20 +562,24 @@ void IBEELKinematics::setEelSpecificVelocity(const double time,
                 std::make_pair((BodyNx - 1) * d_mesh_width[0], (d_map_reference_tangent.rbegin())->second));
             d_map_reference_sign.insert(
                 std::make_pair((BodyNx - 1) * d_mesh_width[0], (d_map_reference_sign.rbegin())->second));
+            setReferenceNormals();
         } // maneuverAxisIsChangingShape
 
         // Rotate the reference axis and calculate tangents in the rotated frame.
         transformManeuverAxisAndCalculateTangents(angleFromHorizontal);
     } // bodyIsManeuvering
 
-    // Set the deformation velocity in the body frame.
-    std::vector<double> vec_vel(NDIM);
-    int lag_idx = 0;
-    for (std::map<double, int>::const_iterator itr = d_ImmersedBodyData.begin(); itr != d_ImmersedBodyData.end(); itr++)
+    // Evaluate the deformation velocity once per cross section and spread it to the points of the section.
+    const std::vector<double>& arc_length = getSectionArcLength();
+    const int num_sections = getNumberOfSections();
+    if (!d_bodyIsManeuvering)
     {
-        d_parser_posn[0] = itr->first;
-        const int NumPtsInSection = itr->second;
-
+        d_parser_normal[0] = -sin(angleFromHorizontal);
+        d_parser_normal[1] = cos(angleFromHorizontal);
+    }
+    for (int k = 0; k < num_sections; ++k)
+    {
+        d_parser_posn[0] = arc_length[k];
         if (d_bodyIsManeuvering)
         {
             d_parser_normal[0] =
@@ -533,24 +587,9 @@ void IBEELKinematics::setEelSpecificVelocity(const double time,
             d_parser_normal[1] =
                 cos(d_map_transformed_tangent[d_parser_posn[0]]) * d_map_transformed_sign[d_parser_posn[0]][0];
         }
-        else
-        {
-            d_parser_normal[0] = -sin(angleFromHorizontal);
-            d_parser_normal[1] = cos(angleFromHorizontal);
-        }
-
-        vec_vel[0] = d_deformationvel_parsers[0]->Eval();
-        vec_vel[1] = d_deformationvel_parsers[1]->Eval();
-
-        const int lowerlimit = lag_idx;
-        const int upperlimit = lag_idx + NumPtsInSection;
-        for (int d = 0; d < NDIM; ++d)
-        {
-            for (int i = lowerlimit; i < upperlimit; ++i) d_kinematics_vel[d][i] = vec_vel[d];
-        }
-
-        lag_idx = upperlimit;
+        for (int d = 0; d < NDIM; ++d) d_section_vel[d][k] = d_deformationvel_parsers[d]->Eval();
     }
+    spreadSectionData(d_section_vel, d_kinematics_vel);
 
     return;
 } // setEelSpecificVelocity
@@ -586,93 +625,43 @@ void IBEELKinematics::setShape(const double time, const std::vector<double>& /*i
     // Find the deformed shape. Rotate the shape about center of mass.
     TBOX_ASSERT(d_new_time == time);
     *d_parser_time = time;
-    std::vector<double> shape_new(NDIM);
 
-    int lag_idx = -1;
-    int reference_axis_idx = -1;
-    for (std::map<double, int>::const_iterator itr = d_ImmersedBodyData.begin(); itr != d_ImmersedBodyData.end(); itr++)
+    // Evaluate the body shape once per cross section and apply it to the cached body-frame layout.
+    const std::vector<double>& arc_length = getSectionArcLength();
+    const int num_sections = getNumberOfSections();
+    for (int k = 0; k < num_sections; ++k)
     {
-        const int NumPtsInSection = itr->second;
-        d_parser_posn[0] = itr->first;
-        const double y_shape_base = d_body_shape_parser->Eval();
-
-        if (d_bodyIsManeuvering)
-        {
-            ++reference_axis_idx;
-            const double x_maneuver_base = d_maneuverAxisReferenceCoordinates_vec[reference_axis_idx][0];
-            const double y_maneuver_base = d_maneuverAxisReferenceCoordinates_vec[reference_axis_idx][1];
-
-            for (int j = 1; j <= NumPtsInSection / 2; ++j)
-            {
-                const double nx = (-1 * sin(d_map_reference_tangent[itr->first]) * d_map_reference_sign[itr->first][1]);
-                const double ny = (cos(d_map_reference_tangent[itr->first]) * d_map_reference_sign[itr->first][0]);
-
-                shape_new[0] = x_maneuver_base + (y_shape_base + (j - 1) * d_mesh_width[1]) * nx;
-                shape_new[1] = y_maneuver_base + (y_shape_base + (j - 1) * d_mesh_width[1]) * ny;
-
-                d_shape[0][++lag_idx] = shape_new[0];
-                d_shape[1][lag_idx] = shape_new[1];
-            }
-
-            for (int j = 1; j <= NumPtsInSection / 2; ++j)
-            {
-                const double nx = (-1 * sin(d_map_reference_tangent[itr->first]) * d_map_reference_sign[itr->first][1]);
-                const double ny = (cos(d_map_reference_tangent[itr->first]) * d_map_reference_sign[itr->first][0]);
-
-                shape_new[0] = x_maneuver_base + (y_shape_base - (j)*d_mesh_width[1]) * nx;
-                shape_new[1] = y_maneuver_base + (y_shape_base - (j)*d_mesh_width[1]) * ny;
-
-                d_shape[0][++lag_idx] = shape_new[0];
-                d_shape[1][lag_idx] = shape_new[1];
-            }
-        } // bodyIsManeuvering.
-        else
-        {
-            for (int j = 1; j <= NumPtsInSection / 2; ++j)
-            {
-                d_shape[0][++lag_idx] = itr->first;
-                d_shape[1][lag_idx] = y_shape_base + (j - 1) * d_mesh_width[1];
-            }
-
-            for (int j = 1; j <= NumPtsInSection / 2; ++j)
-            {
-                d_shape[0][++lag_idx] = itr->first;
-                d_shape[1][lag_idx] = y_shape_base - j * d_mesh_width[1];
-            }
-        }
+        d_parser_posn[0] = arc_length[k];
+        d_section_origin[0][k] = arc_length[k];
+        d_section_origin[1][k] = d_body_shape_parser->Eval();
     }
 
-    // Find the c.m of this new shape.
-    std::vector<double> center_of_mass(NDIM, 0.0);
-    const int total_lag_pts = d_shape[0].size();
-    for (int d = 0; d < NDIM; ++d)
+    if (d_bodyIsManeuvering)
     {
-        for (std::vector<double>::const_iterator citr = d_shape[d].begin(); citr != d_shape[d].end(); ++citr)
+        const std::vector<int>& section_offsets = getSectionOffsets();
+        const std::vector<double>& Y_body = getBodyFrameCoordinates()[1];
+        for (int k = 0; k < num_sections; ++k)
         {
-            center_of_mass[d] += *citr;
+            const double x_maneuver_base = d_maneuverAxisReferenceCoordinates_vec[k][0];
+            const double y_maneuver_base = d_maneuverAxisReferenceCoordinates_vec[k][1];
+            const double y_shape_base = d_section_origin[1][k];
+            const double nx = d_reference_normal[0][k];
+            const double ny = d_reference_normal[1][k];
+            for (int i = section_offsets[k]; i < section_offsets[k + 1]; ++i)
+            {
+                d_shape[0][i] = x_maneuver_base + (y_shape_base + Y_body[i]) * nx;
+                d_shape[1][i] = y_maneuver_base + (y_shape_base + Y_body[i]) * ny;
+            }
         }
-    }
-
-    for (int d = 0; d < NDIM; ++d) center_of_mass[d] /= total_lag_pts;
-
-    // Shift the c.m to the origin to apply the rotation
-    for (int d = 0; d < NDIM; ++d)
+    } // bodyIsManeuvering.
+    else
     {
-        for (std::vector<double>::iterator itr = d_shape[d].begin(); itr != d_shape[d].end(); ++itr)
-        {
-            *itr -= center_of_mass[d];
-        }
+        setShapeFromSections(d_section_origin, d_shape);
     }
 
-    // Now rotate the shape about origin or center of mass.
+    // Shift the c.m to the origin and rotate the shape about it.
     const double angleFromHorizontal = d_initAngle_bodyAxis_x + d_incremented_angle_from_reference_axis[2];
-    for (int i = 0; i < total_lag_pts; ++i)
-    {
-        const double x_rotated = d_shape[0][i] * cos(angleFromHorizontal) - d_shape[1][i] * sin(angleFromHorizontal);
-        const double y_rotated = d_shape[0][i] * sin(angleFromHorizontal) + d_shape[1][i] * cos(angleFromHorizontal);
-        d_shape[0][i] = x_rotated;
-        d_shape[1][i] = y_rotated;
-    }
+    centerAndRotateShape(d_shape, angleFromHorizontal);
 
     d_current_time = d_new_time;
 
@@ -151,6 +151,11 @@ private:
      */
     void transformManeuverAxisAndCalculateTangents(const double angleFromHorizontal);
 
+    /*!
+     * \brief Set the normals to the reference maneuver axis at each cross section.
+     */
+    void setReferenceNormals();
+
     /*!
      * Current time (t) and new time (t+dt).
      */
@@ -162,6 +167,11 @@ private:
     std::vector<std::vector<double> > d_kinematics_vel;
     std::vector<std::vector<double> > d_shape;
 
+    /*!
+     * Deformational velocity, shape origin and reference maneuver axis normal of each cross section.
+     */
+    std::vector<std::vector<double> > d_section_vel, d_section_origin, d_reference_normal;
+
     /*!
      * Save COM, tagged point position and incremented angle from reference axis for restarted runs.
      */
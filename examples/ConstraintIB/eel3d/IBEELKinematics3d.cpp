@@ -208,7 +208,8 @@ IBEELKinematics3d::IBEELKinematics3d(const std::string& object_name,
                                      Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
                                      bool register_for_restart)
     : ConstraintIBKinematics(object_name, input_db, l_data_manager, register_for_restart), d_mesh_width(NDIM),
-      d_current_time(0.0), d_kinematics_vel(NDIM), d_shape(NDIM), d_center_of_mass(3),
+      d_current_time(0.0), d_kinematics_vel(NDIM), d_shape(NDIM), d_section_vel(NDIM), d_section_origin(NDIM),
+      d_center_of_mass(3),
       d_incremented_angle_from_reference_axis(3), d_tagged_pt_position(3), d_interp_coefs()
 {
     // NOTE: Parent class constructor registers class with the restart manager, sets object name.
@@ -337,6 +338,63 @@ void IBEELKinematics3d::setImmersedBodyLayout(Pointer<PatchHierarchy<NDIM> > pat
         d_IBWidthHeight[i - 1] = std::make_pair(section, height);
     }
 
+    // Cache the body-frame layout of the eel. Each nonempty cross section consists of its middle line followed by
+    // pairs of points on the right and left sides of an elliptical cross section.
+    std::vector<double> section_arc_length;
+    std::vector<int> section_num_pts;
+    std::vector<std::vector<double> > body_frame_coords(NDIM);
+    for (int i = 1; i <= d_BodyNs; ++i)
+    {
+        const int NumPtsInSection = d_IBPts[i - 1].first;
+        const int NumPtsInHeight = d_IBPts[i - 1].second;
+        if (!NumPtsInSection || !NumPtsInHeight) continue;
+
+        const double width = d_IBWidthHeight[i - 1].first;
+        const double depth = d_IBWidthHeight[i - 1].second;
+        int pts_this_xsection = 0;
+
+        // Fill the middle line first.
+        for (int k = -NumPtsInHeight; k <= NumPtsInHeight; ++k)
+        {
+            body_frame_coords[0].push_back(0.0);
+            body_frame_coords[1].push_back(0.0);
+            body_frame_coords[2].push_back(k * d_mesh_width[2]);
+            ++pts_this_xsection;
+        }
+
+        // Fill the rest of the cross section next.
+        for (int j = 1; j <= NumPtsInSection; ++j)
+        {
+            const double y = j * d_mesh_width[1];
+            for (int k = -NumPtsInHeight; k <= NumPtsInHeight; ++k)
+            {
+                const double z = k * d_mesh_width[2];
+                if ((std::pow(y / width, 2) + std::pow(z / depth, 2)) <= 1) // use elliptical cross sections
+                {
+                    body_frame_coords[0].push_back(0.0); // right side.
+                    body_frame_coords[1].push_back(y);
+                    body_frame_coords[2].push_back(z);
+
+                    body_frame_coords[0].push_back(0.0); // left side.
+                    body_frame_coords[1].push_back(-y);
+                    body_frame_coords[2].push_back(z);
+                    pts_this_xsection += 2;
+                }
+            }
+        } // cross section filled
+
+        section_arc_length.push_back((i - 1) * d_mesh_width[0]);
+        section_num_pts.push_back(pts_this_xsection);
+    }
+    setBodyLayout(section_arc_length, section_num_pts, body_frame_coords);
+
+    const int num_sections = getNumberOfSections();
+    for (int d = 0; d < NDIM; ++d)
+    {
+        d_section_vel[d].resize(num_sections);
+        d_section_origin[d].resize(num_sections);
+    }
+
     return;
 
 } // setImmersedBodyLayout
@@ -347,8 +405,6 @@ void IBEELKinematics3d::setEelSpecificVelocity(const double time,
                                                const std::vector<double>& /*tagged_pt_position*/)
 {
     const double angleFromHorizontal = d_initAngle_bodyAxis_x + incremented_angle_from_reference_axis[2];
-    std::vector<double> vec_vel(NDIM, 0.0);
-    int lag_idx = 0;
 
     double input[7];
     double dydt, dxdt, errory, errorx;
@@ -367,43 +423,20 @@ void IBEELKinematics3d::setEelSpecificVelocity(const double time,
     input[5] = time;
     input[6] = d_time_period;
 
-    for (int i = 1; i <= d_BodyNs; ++i)
+    // Evaluate the deformation velocity once per cross section and spread it to the points of the section.
+    const std::vector<double>& arc_length = getSectionArcLength();
+    const int num_sections = getNumberOfSections();
+    for (int k = 0; k < num_sections; ++k)
     {
-        const int NumPtsInSection = d_IBPts[i - 1].first;
-        const int NumPtsInHeight = d_IBPts[i - 1].second;
-
-        if (NumPtsInSection && NumPtsInHeight)
-        {
-            const double width = d_IBWidthHeight[i - 1].first;
-            const double depth = d_IBWidthHeight[i - 1].second;
-            const double S = (i - 1) * d_mesh_width[0];
-
-            gsl_integration_qng(&Fx, 0, S, 1e-8, 0.0, &dxdt, &errorx, &nevalsx);
-            gsl_integration_qng(&Fy, 0, S, 1e-8, 0.0, &dydt, &errory, &nevalsy);
-
-            vec_vel[0] = dxdt * (std::cos(angleFromHorizontal)) + dydt * (-std::sin(angleFromHorizontal));
-            vec_vel[1] = dydt * (std::cos(angleFromHorizontal)) + dxdt * (std::sin(angleFromHorizontal));
+        const double S = arc_length[k];
+        gsl_integration_qng(&Fx, 0, S, 1e-8, 0.0, &dxdt, &errorx, &nevalsx);
+        gsl_integration_qng(&Fy, 0, S, 1e-8, 0.0, &dydt, &errory, &nevalsy);
 
-            int pts_this_xsection = 2 * NumPtsInHeight + 1;
-            for (int j = 1; j <= NumPtsInSection; ++j)
-            {
-                const double y = j * d_mesh_width[1];
-                for (int k = -NumPtsInHeight; k <= NumPtsInHeight; ++k)
-                {
-                    const double z = k * d_mesh_width[2];
-                    if ((std::pow(y / width, 2) + std::pow(z / depth, 2)) <= 1) // use elliptical cross sections
-                        pts_this_xsection += 2;
-                }
-            } // cross section filled
-
-            const int lowerlimit = lag_idx;
-            const int upperlimit = lag_idx + pts_this_xsection;
-            for (int d = 0; d < NDIM; ++d)
-                for (int j = lowerlimit; j < upperlimit; ++j) d_kinematics_vel[d][j] = vec_vel[d];
-
-            lag_idx = upperlimit;
-        }
+        d_section_vel[0][k] = dxdt * (std::cos(angleFromHorizontal)) + dydt * (-std::sin(angleFromHorizontal));
+        d_section_vel[1][k] = dydt * (std::cos(angleFromHorizontal)) + dxdt * (std::sin(angleFromHorizontal));
+        d_section_vel[2][k] = 0.0;
     }
+    spreadSectionData(d_section_vel, d_kinematics_vel);
 
     return;
 
@@ -460,86 +493,24 @@ void IBEELKinematics3d::setShape(const double time, const std::vector<double>& i
         double ybase, xbase, errory, errorx;
         size_t nevalsy, nevalsx;
 
-        // Find the deformed shape. Rotate the shape about center of mass.
-        std::vector<double> shape_new(NDIM);
-        int lag_idx = -1;
-        for (int i = 1; i <= d_BodyNs; ++i)
-        {
-            const int NumPtsInSection = d_IBPts[i - 1].first;
-            const int NumPtsInHeight = d_IBPts[i - 1].second;
-
-            if (NumPtsInSection && NumPtsInHeight)
-            {
-                const double width = d_IBWidthHeight[i - 1].first;
-                const double depth = d_IBWidthHeight[i - 1].second;
-                const double S = (i - 1) * d_mesh_width[0];
-
-                gsl_integration_qng(&Fx, 0, S, 1e-8, 0.0, &xbase, &errorx, &nevalsx);
-                gsl_integration_qng(&Fy, 0, S, 1e-8, 0.0, &ybase, &errory, &nevalsy);
-
-                // Fill the middle line first.
-                for (int k = -NumPtsInHeight; k <= NumPtsInHeight; ++k)
-                {
-                    d_shape[0][++lag_idx] = xbase;
-                    d_shape[1][lag_idx] = ybase;
-                    d_shape[2][lag_idx] = k * d_mesh_width[2];
-                }
-
-                // Fill the rest of the cross section next.
-                for (int j = 1; j <= NumPtsInSection; ++j)
-                {
-                    const double y = j * d_mesh_width[1];
-                    for (int k = -NumPtsInHeight; k <= NumPtsInHeight; ++k)
-                    {
-                        const double z = k * d_mesh_width[2];
-                        if ((std::pow(y / width, 2) + std::pow(z / depth, 2)) <= 1) // use elliptical cross sections
-                        {
-                            d_shape[0][++lag_idx] = xbase; // right side.
-                            d_shape[1][lag_idx] = ybase + y;
-                            d_shape[2][lag_idx] = z;
-
-                            d_shape[0][++lag_idx] = xbase; // left side.
-                            d_shape[1][lag_idx] = ybase - y;
-                            d_shape[2][lag_idx] = z;
-                        }
-                    }
-                } // cross section filled
-            }
-        }
-
-        // Find the c.m of this new shape.
-        std::vector<double> center_of_mass(NDIM, 0.0);
-        const int total_lag_pts = d_shape[0].size();
-        for (int d = 0; d < NDIM; ++d)
-        {
-            for (std::vector<double>::const_iterator citr = d_shape[d].begin(); citr != d_shape[d].end(); ++citr)
-            {
-                center_of_mass[d] += *citr;
-            }
-        }
-
-        for (int d = 0; d < NDIM; ++d) center_of_mass[d] /= total_lag_pts;
-
-        // Shift the c.m to the origin to apply the rotation
-        for (int d = 0; d < NDIM; ++d)
+        // Find the deformed shape by evaluating the backbone position once per cross section and applying it to
+        // the cached body-frame layout.
+        const std::vector<double>& arc_length = getSectionArcLength();
+        const int num_sections = getNumberOfSections();
+        for (int k = 0; k < num_sections; ++k)
         {
-            for (std::vector<double>::iterator itr = d_shape[d].begin(); itr != d_shape[d].end(); ++itr)
-            {
-                *itr -= center_of_mass[d];
-            }
+            const double S = arc_length[k];
+            gsl_integration_qng(&Fx, 0, S, 1e-8, 0.0, &xbase, &errorx, &nevalsx);
+            gsl_integration_qng(&Fy, 0, S, 1e-8, 0.0, &ybase, &errory, &nevalsy);
+            d_section_origin[0][k] = xbase;
+            d_section_origin[1][k] = ybase;
+            d_section_origin[2][k] = 0.0;
         }
+        setShapeFromSections(d_section_origin, d_shape);
 
-        // Now rotate the shape about the origin (or the shifted center of mass).
+        // Shift the c.m to the origin and rotate the shape about it.
         const double angleFromHorizontal = d_initAngle_bodyAxis_x + incremented_angle_from_reference_axis[2];
-        for (int i = 0; i < total_lag_pts; ++i)
-        {
-            const double x_rotated =
-                d_shape[0][i] * cos(angleFromHorizontal) - d_shape[1][i] * sin(angleFromHorizontal);
-            const double y_rotated =
-                d_shape[0][i] * sin(angleFromHorizontal) + d_shape[1][i] * cos(angleFromHorizontal);
-            d_shape[0][i] = x_rotated;
-            d_shape[1][i] = y_rotated;
-        }
+        centerAndRotateShape(d_shape, angleFromHorizontal);
 
         return;
     }
@@ -177,6 +177,11 @@ private:
     std::vector<std::vector<double> > d_kinematics_vel;
     std::vector<std::vector<double> > d_shape;
 
+    /*!
+     * Deformational velocity and backbone position of each cross section.
+     */
+    std::vector<std::vector<double> > d_section_vel, d_section_origin;
+
     /*!
      * Save COM, tagged point position and incremented angle from reference axis for restarted runs.
      */
@@ -57,13 +57,16 @@ class AppInitializer : public SAMRAI::tbox::DescribedClass
 public:
     /*!
      * Constructor for class AppInitializer parses command line arguments, sets
-     * up input and restart databases, and enables SAMRAI logging.
+     * up input and restart databases, and enables SAMRAI logging.  If the
+     * input database contains a HardwareCounters database, hardware counter
+     * sampling is configured via HardwareCounters::setFromDatabase().
      */
     AppInitializer(int argc, char* argv[], const std::string& default_log_file_name = "IBAMR.log");
 
     /*!
      * Destructor for class AppInitializer frees the SAMRAI manager objects
-     * used to set up input and restart databases.
+     * used to set up input and restart databases, and writes any sampled
+     * hardware counter values to the log file.
      */
     ~AppInitializer();
 
@@ -469,6 +469,12 @@ public:
      */
     void updateWorkloadEstimates(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \brief Return the number of element quadrature points that are located in
+     * the local patches of the level in which the FE mesh is embedded.
+     */
+    double getNumberOfLocalQuadPoints();
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.  The level number indicates that of
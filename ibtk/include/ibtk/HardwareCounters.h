@@ -0,0 +1,171 @@
+// Filename: HardwareCounters.h
+// Created on 18 Oct 2026 by agent
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_HardwareCounters
+#define included_HardwareCounters
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ostream>
+#include <string>
+
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace tbox
+{
+class Database;
+class Timer;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class HardwareCounters provides optional sampling of hardware
+ * performance counters (CPU cycles, retired instructions, last-level cache
+ * misses, and, optionally, floating point operations) within the regions of
+ * code delimited by the IBTK_TIMER_START()/IBTK_TIMER_STOP() and
+ * IBAMR_TIMER_START()/IBAMR_TIMER_STOP() macros.
+ *
+ * Counters are read via the Linux perf_event_open() system call.  Counters
+ * are only sampled when they have been enabled via setFromDatabase(), and
+ * sampling is silently disabled (with a single warning) on platforms that do
+ * not support perf_event_open() or when the kernel does not permit the
+ * counters to be opened (e.g., because of the value of
+ * /proc/sys/kernel/perf_event_paranoid).  When sampling is disabled, the
+ * only overhead incurred by the timer macros is a test of a static flag.
+ *
+ * Counter values are accumulated only for the outermost activation of each
+ * timer, and include all work done by the calling thread (but not by any
+ * other threads) while the timer is running, including work done within
+ * nested timers.  Because there is no portable hardware event for floating
+ * point operations, the FP operation count is only sampled when a
+ * processor-specific raw event code is provided in the input database.
+ *
+ * Sample input database entries:
+ \verbatim
+ enable_hardware_counters = TRUE       // default is TRUE when the database is provided
+ timer_names = "IBTK::LEInteractor::*" , "IBTK::PatchMathOps::*"  // default is all timers
+ fp_ops_raw_event = 455               // processor-specific raw event code (optional)
+ \endverbatim
+ *
+ * A trailing '*' in an entry of timer_names matches any timer name with the
+ * specified prefix.
+ *
+ * \note The values reported by printReport() are the values recorded by the
+ * local MPI process; this class does not perform any communication.
+ */
+class HardwareCounters
+{
+public:
+    /*!
+     * \brief Configure and (if requested) enable hardware counter sampling.
+     */
+    static void setFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
+
+    /*!
+     * \brief Close any open hardware counters and discard all accumulated
+     * counter values.
+     */
+    static void finalize();
+
+    /*!
+     * \brief Indicate whether hardware counters are currently being sampled.
+     */
+    static inline bool isEnabled()
+    {
+        return s_enabled;
+    } // isEnabled
+
+    /*!
+     * \brief Begin sampling the hardware counters for the region associated
+     * with the specified timer.
+     */
+    static void startRegion(const SAMRAI::tbox::Timer* timer);
+
+    /*!
+     * \brief Stop sampling the hardware counters for the region associated
+     * with the specified timer and accumulate the counter values.
+     */
+    static void stopRegion(const SAMRAI::tbox::Timer* timer);
+
+    /*!
+     * \brief Print the accumulated counter values for each sampled region,
+     * along with the wall-clock time spent within the region and derived
+     * quantities (instructions per cycle and cache misses per thousand
+     * instructions) that indicate whether the region is compute or memory
+     * bound.
+     */
+    static void printReport(std::ostream& os);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    HardwareCounters();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    HardwareCounters(const HardwareCounters& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    HardwareCounters& operator=(const HardwareCounters& that);
+
+    /*!
+     * \brief Whether hardware counters are currently being sampled.
+     */
+    static bool s_enabled;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_HardwareCounters
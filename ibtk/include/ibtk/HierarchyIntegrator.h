@@ -59,6 +59,8 @@
 #include "VisItDataWriter.h"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/PerformanceTelemetry.h"
+#include "ibtk/WorkloadReport.h"
 #include "ibtk/ibtk_enums.h"
 #include "tbox/Array.h"
 #include "tbox/Pointer.h"
@@ -544,6 +546,28 @@ public:
      */
     void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
+    /*!
+     * Return the object used to record per-time step performance telemetry, or
+     * a NULL pointer if telemetry is not enabled.
+     *
+     * \note Child integrators use the telemetry object of the top-level parent
+     * integrator.
+     */
+    SAMRAI::tbox::Pointer<PerformanceTelemetry> getPerformanceTelemetry() const;
+
+    /*!
+     * Return the object used to report the distribution of work across
+     * processes after each regridding operation, or a NULL pointer if workload
+     * reporting is not enabled.
+     *
+     * Objects that manage additional work (e.g., Lagrangian data) may add
+     * per-level counts to the report during regridding.
+     *
+     * \note Child integrators use the workload report object of the top-level
+     * parent integrator.
+     */
+    SAMRAI::tbox::Pointer<WorkloadReport> getWorkloadReport() const;
+
 protected:
     /*!
      * Virtual method to compute an implementation-specific minimum stable time
@@ -827,6 +851,25 @@ protected:
         return d_at_regrid_time_step;
     }
 
+    /*!
+     * Register a named phase or counter with the performance telemetry object.
+     *
+     * \note Phases and counters must be registered collectively before the
+     * first time step is taken, e.g., in initializeHierarchyIntegrator().  These
+     * functions have no effect if telemetry is not enabled.
+     */
+    void registerTelemetryPhase(const std::string& phase_name);
+    void registerTelemetryCounter(const std::string& counter_name);
+
+    /*!
+     * Record performance telemetry for the current time step.
+     *
+     * \note These functions have no effect if telemetry is not enabled.
+     */
+    void startTelemetryPhase(const std::string& phase_name);
+    void stopTelemetryPhase(const std::string& phase_name);
+    void addTelemetryCount(const std::string& counter_name, double value);
+
     /*
      * The object name is used as a handle to databases stored in restart files
      * and for error reporting purposes.
@@ -905,6 +948,30 @@ protected:
      */
     bool d_enable_logging;
 
+    /*
+     * Indicates whether the integrator should record per-time step performance
+     * telemetry, and the object used to record it.
+     */
+    bool d_enable_telemetry;
+    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_telemetry_db;
+    SAMRAI::tbox::Pointer<PerformanceTelemetry> d_telemetry;
+
+    /*
+     * Indicates whether the integrator should report the distribution of work
+     * across processes after each regridding operation, and the object used to
+     * generate the report.
+     */
+    bool d_enable_workload_report;
+    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_workload_report_db;
+    SAMRAI::tbox::Pointer<WorkloadReport> d_workload_report;
+
+    /*
+     * Indicates whether the integrator should report the memory allocated for
+     * patch data (see PatchDataMemoryManager) prior to each regridding
+     * operation.
+     */
+    bool d_enable_memory_report;
+
     /*
      * The type of extrapolation to use at physical boundaries when prolonging
      * data during regridding.
@@ -39,6 +39,7 @@
 #include <string>
 #include <vector>
 
+#include "ibtk/LDataVecPool.h"
 #include "petscvec.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
@@ -79,6 +80,22 @@ public:
           unsigned int depth,
           const std::vector<int>& nonlocal_petsc_indices = std::vector<int>(0));
 
+    /*!
+     * \brief Constructor.
+     *
+     * \note This constructor obtains an appropriately sized PETSc Vec object
+     * from the specified pool.  The Vec is returned to the pool when it is no
+     * longer needed by the LData object.
+     *
+     * \see LDataVecPool
+     */
+    LData(const std::string& name,
+          unsigned int num_local_nodes,
+          unsigned int depth,
+          const std::vector<int>& nonlocal_petsc_indices,
+          SAMRAI::tbox::Pointer<LDataVecPool> vec_pool,
+          int vec_pool_layout_id);
+
     /*!
      * \brief Constructor.
      *
@@ -117,10 +134,15 @@ public:
      * \note The blocksize of the supplied PETSc Vec object \em must be set
      * appropriately.  Its value is used to determine the data depth (i.e., the
      * number of data components per node).
+     *
+     * \note If the supplied PETSc Vec object was obtained from an LDataVecPool
+     * and is managed by the LData object, the pool must also be provided so
+     * that the Vec can be returned to the pool when it is no longer needed.
      */
     virtual void resetData(Vec vec,
                            const std::vector<int>& nonlocal_petsc_indices = std::vector<int>(0),
-                           const bool manage_petsc_vec = true);
+                           const bool manage_petsc_vec = true,
+                           SAMRAI::tbox::Pointer<LDataVecPool> vec_pool = SAMRAI::tbox::Pointer<LDataVecPool>(NULL));
 
     /*!
      * \brief Returns a const reference to the name of this LData object.
@@ -320,6 +342,12 @@ private:
     void getArrayCommon();
     void getGhostedLocalFormArrayCommon();
 
+    /*
+     * Destroy the PETSc Vec object (or return it to the pool from which it was
+     * obtained) if it is managed by this object.
+     */
+    void releaseVec();
+
     /*
      * The name of the LData object.
      */
@@ -356,6 +384,7 @@ private:
      */
     Vec d_global_vec;
     bool d_managing_petsc_vec;
+    SAMRAI::tbox::Pointer<LDataVecPool> d_vec_pool;
     double* d_array;
     boost::multi_array_ref<double, 1>* d_boost_array, *d_boost_local_array;
     boost::multi_array_ref<double, 2>* d_boost_vec_array, *d_boost_local_vec_array;
@@ -56,6 +56,7 @@
 #include "StandardTagAndInitStrategy.h"
 #include "VariableContext.h"
 #include "VisItDataWriter.h"
+#include "ibtk/LDataVecPool.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LNodeSet.h"
 #include "ibtk/LNodeSetVariable.h"
@@ -502,6 +503,19 @@ public:
     void registerLoadBalancer(SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > load_balancer,
                               int workload_data_idx);
 
+    /*!
+     * \brief Set whether the local nodes are ordered along a space-filling
+     * (Morton) curve through the Cartesian grid cells that contain them when
+     * the Lagrangian data are redistributed.
+     *
+     * By default, local nodes are ordered by the patches and cells in which
+     * they are found.  Ordering the nodes along a space-filling curve keeps the
+     * nodes that are close together in space close together in memory, which
+     * improves the cache behavior of loops over Lagrangian elements (e.g.,
+     * springs and beams, which are ordered by master node).
+     */
+    void setUseSpaceFillingCurveOrdering(bool use_sfc_ordering);
+
     /*!
      * \brief Indicates whether there is Lagrangian data on the given patch
      * hierarchy level.
@@ -563,6 +577,11 @@ public:
      *
      * \note Quantities maintained by the LDataManager must have unique names.
      * The name "X" is reserved for the nodal coordinates.
+     *
+     * \note The storage for the returned data is obtained from a pool of PETSc
+     * Vec objects that is maintained by the manager, so that allocating
+     * temporary data between regridding operations does not require any PETSc
+     * setup.
      */
     SAMRAI::tbox::Pointer<LData>
     createLData(const std::string& quantity_name, int level_number, unsigned int depth = 1, bool maintain_data = false);
@@ -742,17 +761,47 @@ public:
     /*!
      * \brief Scatter data from a distributed PETSc vector to all processors.
      *
-     * \todo Optimize the implementation of this method.
+     * If sequential_vec is NULL, a new sequential vector is created; the caller
+     * is responsible for destroying it.
+     *
+     * \note The VecScatter context is cached and reused for all parallel
+     * vectors with the same parallel layout.  The cache is cleared whenever the
+     * Lagrangian data are redistributed.
      */
     void scatterToAll(Vec& parallel_vec, Vec& sequential_vec) const;
 
     /*!
      * \brief Scatter data from a distributed PETSc vector to processor zero.
      *
-     * \todo Optimize the implementation of this method.
+     * If sequential_vec is NULL, a new sequential vector is created; the caller
+     * is responsible for destroying it.
+     *
+     * \note The VecScatter context is cached and reused for all parallel
+     * vectors with the same parallel layout.  The cache is cleared whenever the
+     * Lagrangian data are redistributed.
      */
     void scatterToZero(Vec& parallel_vec, Vec& sequential_vec) const;
 
+    /*!
+     * \brief Scatter the data associated with a subset of the nodes of a
+     * distributed PETSc vector to processor zero.
+     *
+     * The node indices are specified in the global PETSc ordering (e.g., as
+     * obtained from mapLagrangianToPETSc()) and must be the same on all
+     * processors.  On processor zero, the sequential vector stores the data for
+     * the specified nodes in the order in which they are listed.  On all other
+     * processors, the sequential vector is empty.
+     *
+     * If sequential_vec is NULL, a new sequential vector is created; the caller
+     * is responsible for destroying it.
+     *
+     * \note The VecScatter context is cached and reused for all parallel
+     * vectors with the same parallel layout and the same collection of node
+     * indices.  The cache is cleared whenever the Lagrangian data are
+     * redistributed.
+     */
+    void scatterToZero(Vec& parallel_vec, Vec& sequential_vec, const std::vector<int>& petsc_node_idxs) const;
+
     /*!
      * \brief Start the process of redistributing the Lagrangian data.
      *
@@ -945,6 +994,48 @@ private:
      */
     void scatterData(Vec& lagrangian_vec, Vec& petsc_vec, int level_number, ScatterMode mode) const;
 
+    /*!
+     * \brief Enumerated type for the kinds of cached scatters to sequential
+     * vectors.
+     */
+    enum SequentialScatterType
+    {
+        SCATTER_TO_ALL,
+        SCATTER_TO_ZERO,
+        SCATTER_SUBSET_TO_ZERO
+    };
+
+    /*!
+     * \brief Common implementation of scatterToAll() and scatterToZero().
+     *
+     * The VecScatter context is looked up in (or inserted into) a cache that is
+     * keyed on the parallel layout of the source vector.  Because that layout
+     * is the same on all processors, cache hits and misses are consistent
+     * across processors, and the collective VecScatter setup is only performed
+     * when it is required.
+     */
+    void scatterToSequential(Vec& parallel_vec,
+                             Vec& sequential_vec,
+                             SequentialScatterType scatter_type,
+                             const std::vector<int>& petsc_node_idxs) const;
+
+    /*!
+     * \brief Destroy all cached VecScatter contexts and template vectors.
+     */
+    void clearSequentialScatterCache();
+
+    /*!
+     * \brief Get the ID that identifies the present parallel layout of the
+     * Lagrangian data on the specified level to the LData Vec pool.
+     */
+    int getVecPoolLayoutID(int level_number);
+
+    /*!
+     * \brief Indicate that the parallel layout of the Lagrangian data on the
+     * specified level is no longer valid.
+     */
+    void resetVecPoolLayoutID(int level_number);
+
     /*!
      * \brief Begin the process of refilling nonlocal Lagrangian quantities over
      * the specified range of levels in the patch hierarchy.
@@ -1075,6 +1166,12 @@ private:
     int d_workload_idx;
     bool d_output_workload;
 
+    /*
+     * Whether local nodes are ordered along a space-filling curve when the
+     * Lagrangian data are redistributed.
+     */
+    bool d_use_sfc_ordering;
+
     /*
      * SAMRAI::hier::Variable pointer and patch data descriptor indices for the
      * cell variable used to keep track of the count of the nodes in each cell
@@ -1205,7 +1302,29 @@ private:
      */
     std::vector<std::vector<int> > d_nonlocal_petsc_indices;
 
+    /*!
+     * The IDs that identify the parallel layout of the Lagrangian data on each
+     * level of the patch hierarchy to the LData Vec pool.  A value of -1
+     * indicates that a new ID must be assigned before the pool is used.
+     */
+    std::vector<int> d_vec_pool_layout_ids;
+
     //\}
+
+    /*!
+     * The pool of PETSc Vec objects used to provide storage for LData objects
+     * allocated by the manager.
+     */
+    SAMRAI::tbox::Pointer<LDataVecPool> d_vec_pool;
+    int d_next_vec_pool_layout_id;
+
+    /*!
+     * Cached VecScatter contexts (and the sequential vectors used as templates
+     * for the output vectors) used by scatterToAll() and scatterToZero().  The
+     * key encodes the type of the scatter, the block size and ownership ranges
+     * of the source vector, and, for subset scatters, the node indices.
+     */
+    mutable std::map<std::vector<int>, std::pair<VecScatter, Vec> > d_sequential_scatter_cache;
 };
 } // namespace IBTK
 
@@ -0,0 +1,194 @@
+// Filename: LDataVecPool.h
+// Created on 18 Oct 2026 by agent
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_LDataVecPool
+#define included_LDataVecPool
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "petscvec.h"
+#include "tbox/DescribedClass.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LDataVecPool recycles the ghosted parallel PETSc Vec objects
+ * (and their underlying storage) that are used by LData objects.
+ *
+ * Each Vec provided by the pool is associated with a <em>layout ID</em> that
+ * identifies a particular parallel distribution of Lagrangian nodes (i.e., a
+ * particular number of local nodes and a particular set of ghost node indices
+ * on each processor).  When a Vec is released back to the pool, it is kept
+ * intact so that subsequent requests for a Vec with the same layout ID and
+ * depth can be satisfied without performing any PETSc setup, including the
+ * setup of the ghost update scatter.  Once a layout is retired (e.g., because
+ * the Lagrangian data have been redistributed), the Vec objects associated with
+ * that layout are destroyed, but their storage is retained and used to back
+ * Vec objects with new layouts.  New storage is allocated with some slack so
+ * that modest changes in the number of local and ghost nodes do not require
+ * reallocation.
+ *
+ * \note All methods that create or destroy PETSc Vec objects are collective.
+ * The pool assumes that all processes request and release Vec objects in the
+ * same order, as is the case for LData objects allocated via LDataManager, so
+ * that reuse decisions are consistent across processes.
+ */
+class LDataVecPool : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param slack_factor Amount of extra storage (relative to the requested
+     * size) to allocate when new storage is required.
+     */
+    LDataVecPool(const std::string& object_name, double slack_factor = 0.25);
+
+    /*!
+     * \brief Destructor.
+     *
+     * \note All Vec objects provided by the pool must be released prior to
+     * destroying the pool.
+     */
+    ~LDataVecPool();
+
+    /*!
+     * \brief Get a ghosted parallel Vec with the specified layout and depth.
+     *
+     * All requests with the same layout ID must provide the same number of
+     * local nodes and the same nonlocal PETSc indices.  The entries of the
+     * returned Vec (including its ghost entries) are zero.
+     *
+     * \note The returned Vec must be returned to the pool via releaseVec().
+     */
+    Vec getVec(int layout_id,
+               unsigned int depth,
+               unsigned int num_local_nodes,
+               const std::vector<int>& nonlocal_petsc_indices);
+
+    /*!
+     * \brief Release a Vec back to the pool and set the handle to NULL.
+     *
+     * Vec objects that were not provided by the pool are destroyed.
+     */
+    void releaseVec(Vec& vec);
+
+    /*!
+     * \brief Indicate that no more Vec objects will be requested with the
+     * specified layout ID.
+     *
+     * Free Vec objects with this layout are destroyed immediately, and Vec
+     * objects with this layout that are currently in use are destroyed when
+     * they are released.  In both cases, their storage is retained by the pool.
+     *
+     * \note The storage of Vec objects that are in use when the layout is
+     * retired becomes available only once they are released.  In particular,
+     * when LDataManager redistributes the Lagrangian data, the storage of the
+     * source Vec objects is reused by the destination Vec objects of the
+     * following redistribution.
+     */
+    void retireLayout(int layout_id);
+
+    /*!
+     * \brief Free all storage that is not presently in use.
+     */
+    void freeUnusedStorage();
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LDataVecPool();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LDataVecPool(const LDataVecPool& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LDataVecPool& operator=(const LDataVecPool& that);
+
+    /*!
+     * \brief Get storage for at least the specified number of values.
+     */
+    double* acquireStorage(size_t size, size_t& capacity);
+
+    /*!
+     * \brief Destroy the specified (unused) Vec and retain its storage.
+     */
+    void destroyVec(Vec vec);
+
+    /*
+     * Data associated with each Vec provided by the pool.
+     */
+    struct VecRecord
+    {
+        int layout_id;
+        unsigned int depth;
+        double* array;
+        size_t capacity;
+        bool in_use;
+    };
+
+    std::string d_object_name;
+    double d_slack_factor;
+    std::map<Vec, VecRecord> d_vecs;
+    std::multimap<size_t, double*> d_free_storage;
+    std::set<int> d_retired_layout_ids;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_LDataVecPool
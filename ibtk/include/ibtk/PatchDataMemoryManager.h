@@ -0,0 +1,245 @@
+// Filename: PatchDataMemoryManager.h
+// Created on 18 Oct 2026 by agent
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_PatchDataMemoryManager
+#define included_PatchDataMemoryManager
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PatchDataMemoryManager is a singleton manager class that
+ * accounts for the memory allocated for patch data on a patch hierarchy,
+ * broken down by patch data descriptor index, by owning object, and by patch
+ * level.
+ *
+ * The memory used by each allocated patch data object is estimated via
+ * SAMRAI::hier::PatchDataFactory::getSizeOfMemory(), so that accounting
+ * requires neither modifications to the code that allocates patch data nor
+ * additional bookkeeping during allocation.  Consequently, the values
+ * reported correspond to the data allocated at the time that
+ * computeMemoryUsage() is called.  The largest values obtained by any call to
+ * computeMemoryUsage() are also recorded.
+ *
+ * Objects may register themselves as the owners of the patch data indices
+ * that they create via registerPatchDataOwner().  The owner of an index that
+ * has not been registered explicitly is taken to be the prefix of the name of
+ * its variable context (e.g., the owner of data allocated in the context
+ * "INSStaggeredHierarchyIntegrator::SCRATCH" is
+ * "INSStaggeredHierarchyIntegrator"), which follows the convention used to
+ * name variable contexts throughout IBTK and IBAMR.  An index that is not
+ * associated with a context because it was obtained by cloning another index
+ * (e.g., via SAMRAI::hier::VariableDatabase::registerClonedPatchDataIndex() or
+ * SAMRAI::solv::SAMRAIVectorReal::cloneVector()) is attributed to the owner of
+ * another index of the same variable unless its owner is registered
+ * explicitly.
+ */
+class PatchDataMemoryManager
+{
+public:
+    /*!
+     * Return a pointer to the instance of the patch data memory manager.  All
+     * access to the singleton PatchDataMemoryManager object is through the
+     * getManager() function.
+     *
+     * Note that when the manager is accessed for the first time, the
+     * freeManager static method is registered with the ShutdownRegistry class.
+     * Consequently, an allocated manager is freed at program completion.  Thus,
+     * users of this class do not explicitly allocate or deallocate the manager
+     * instances.
+     *
+     * \return A pointer to the data manager instance.
+     */
+    static PatchDataMemoryManager* getManager();
+
+    /*!
+     * Deallocate the PatchDataMemoryManager instance.
+     *
+     * It is not necessary to call this function at program termination, since
+     * it is automatically called by the ShutdownRegistry class.
+     */
+    static void freeManager();
+
+    /*!
+     * \brief Register the name of the object that owns the specified patch
+     * data index.
+     */
+    void registerPatchDataOwner(int data_idx, const std::string& owner_name);
+
+    /*!
+     * \brief Remove the explicitly registered owner of the specified patch
+     * data index.
+     *
+     * \note This method should be called when a patch data index with an
+     * explicitly registered owner is removed from the variable database, so
+     * that the owner is not attributed to a different index that subsequently
+     * reuses the same descriptor index.
+     */
+    void unregisterPatchDataOwner(int data_idx);
+
+    /*!
+     * \brief Return the name of the object that owns the specified patch data
+     * index.
+     */
+    std::string getPatchDataOwner(int data_idx) const;
+
+    /*!
+     * \brief Compute the memory allocated for patch data on each level of the
+     * patch hierarchy, along with the peak resident set size of each process.
+     *
+     * \note This method is collective.
+     */
+    void computeMemoryUsage(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
+    /*!
+     * \brief Return the total number of bytes allocated on all processes for
+     * the specified patch data index, as of the most recent call to
+     * computeMemoryUsage().
+     *
+     * If the level number is negative, the total over all levels is returned.
+     */
+    double getAllocatedBytes(int data_idx, int level_number = -1) const;
+
+    /*!
+     * \brief Return the total number of bytes allocated on all processes for
+     * patch data owned by the specified object, as of the most recent call to
+     * computeMemoryUsage().
+     */
+    double getAllocatedBytesForOwner(const std::string& owner_name) const;
+
+    /*!
+     * \brief Return the total number of bytes allocated on all processes for
+     * patch data on the specified level (or on all levels if the level number
+     * is negative), as of the most recent call to computeMemoryUsage().
+     */
+    double getAllocatedBytesForLevel(int level_number = -1) const;
+
+    /*!
+     * \brief Return the peak resident set size of the calling process in
+     * bytes, or zero if it cannot be determined.
+     */
+    static double getPeakResidentSetSize();
+
+    /*!
+     * \brief Print the memory usage computed by the most recent call to
+     * computeMemoryUsage().
+     *
+     * The report includes the total and largest per-process amount of patch
+     * data owned by each object and allocated on each level, the amount of
+     * data allocated for each patch data index (largest first), and the peak
+     * resident set size of the processes.  Only MPI process 0 writes the
+     * report.
+     */
+    void printReport(std::ostream& os) const;
+
+protected:
+    /*!
+     * \brief Constructor.
+     */
+    PatchDataMemoryManager();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PatchDataMemoryManager();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PatchDataMemoryManager(const PatchDataMemoryManager& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PatchDataMemoryManager& operator=(const PatchDataMemoryManager& that);
+
+    /*!
+     * Static data members used to control access to and destruction of
+     * singleton data manager instance.
+     */
+    static PatchDataMemoryManager* s_data_manager_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+
+    /*!
+     * The explicitly registered owners of patch data indices.
+     */
+    std::map<int, std::string> d_owner_names;
+
+    /*!
+     * The number of patch data indices and patch levels for which memory usage
+     * has been computed, and the total (over all processes) and maximum (on
+     * any process) numbers of bytes allocated for each index on each level,
+     * stored with the level number varying fastest.
+     */
+    int d_num_data_idxs, d_num_levels;
+    std::vector<double> d_total_bytes, d_max_bytes;
+
+    /*!
+     * The largest total number of bytes allocated for each patch data index
+     * over all calls to computeMemoryUsage().
+     */
+    std::vector<double> d_high_water_bytes;
+
+    /*!
+     * The minimum, maximum, and mean peak resident set sizes over all
+     * processes.
+     */
+    double d_min_peak_rss, d_max_peak_rss, d_mean_peak_rss;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_PatchDataMemoryManager
@@ -0,0 +1,243 @@
+// Filename: PerformanceTelemetry.h
+// Created on 18 Oct 2026 by agent
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_PerformanceTelemetry
+#define included_PerformanceTelemetry
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace tbox
+{
+class Database;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PerformanceTelemetry records per-time step performance data
+ * (wall-clock times of named phases of the time step and named work or
+ * iteration counters) and periodically writes the minimum, maximum, and mean
+ * of each value over all MPI processes to a compact CSV or JSON stream.
+ *
+ * Values are buffered locally for a fixed number of time steps, so that only
+ * one global reduction is required per flush interval.  Phases and counters
+ * must be registered before the first flush, and all processes must register
+ * them in the same order.  Phases may be started and stopped multiple times
+ * per time step, and counts may be added multiple times per time step; the
+ * values recorded within a time step are accumulated.
+ *
+ * A time step is closed when the next time step begins (or when the data are
+ * flushed), so that work done between calls to beginStep() (e.g., I/O done by
+ * the application between time steps) is attributed to the preceding step.
+ *
+ * Sample input database entries:
+ \verbatim
+ flush_interval = 10           // number of time steps between global reductions
+ file_name = "telemetry.csv"   // output file (written by MPI process 0)
+ format = "CSV"                // "CSV" or "JSON" (one JSON object per line)
+ \endverbatim
+ *
+ * \note All methods except startPhase(), stopPhase(), and addCount() are
+ * collective.
+ */
+class PerformanceTelemetry : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    PerformanceTelemetry(const std::string& object_name, SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Destructor.
+     *
+     * Any buffered data are flushed, so this destructor must be called by all
+     * processes.
+     */
+    ~PerformanceTelemetry();
+
+    /*!
+     * \brief Register a named phase of the time step.
+     *
+     * \note Registering a phase or counter more than once has no effect.
+     */
+    void registerPhase(const std::string& phase_name);
+
+    /*!
+     * \brief Register a named counter.
+     */
+    void registerCounter(const std::string& counter_name);
+
+    /*!
+     * \brief Close the preceding time step (if any) and begin recording data
+     * for a new time step.
+     */
+    void beginStep(int step_num, double time, double dt);
+
+    /*!
+     * \brief Start the timer associated with the specified phase.
+     */
+    void startPhase(const std::string& phase_name);
+
+    /*!
+     * \brief Stop the timer associated with the specified phase and add the
+     * elapsed time to the value of the phase for the current time step.
+     */
+    void stopPhase(const std::string& phase_name);
+
+    /*!
+     * \brief Add the specified value to the specified counter for the current
+     * time step.
+     */
+    void addCount(const std::string& counter_name, double value);
+
+    /*!
+     * \brief Close the current time step (if any), reduce all buffered data,
+     * and write the reduced data to the output stream.
+     */
+    void flush();
+
+    /*!
+     * \brief Get the local times of all phases accumulated over all completed
+     * time steps since the accumulated values were last reset.
+     */
+    void getAccumulatedPhaseTimes(std::vector<std::string>& phase_names, std::vector<double>& phase_times) const;
+
+    /*!
+     * \brief Reset the accumulated values.
+     */
+    void resetAccumulatedValues();
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    PerformanceTelemetry();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PerformanceTelemetry(const PerformanceTelemetry& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PerformanceTelemetry& operator=(const PerformanceTelemetry& that);
+
+    /*!
+     * \brief Register a named value.
+     */
+    void registerValue(const std::string& name, bool is_phase);
+
+    /*!
+     * \brief Return the index of a registered value.
+     */
+    int getValueIndex(const std::string& name, bool is_phase) const;
+
+    /*!
+     * \brief Close the current time step (if any) and append its data to the
+     * buffer.
+     */
+    void endStep();
+
+    /*!
+     * \brief Write the reduced data for the buffered time steps.
+     */
+    void writeData(const std::vector<double>& reduced_values);
+
+    std::string d_object_name;
+    int d_flush_interval;
+    std::string d_file_name;
+    bool d_use_json;
+
+    /*
+     * Names of the registered values, whether each value is the time of a
+     * phase, and the start time of each running phase.
+     */
+    std::vector<std::string> d_names;
+    std::vector<bool> d_is_phase;
+    std::map<std::string, int> d_value_idxs;
+    std::vector<double> d_phase_start_times;
+    bool d_values_are_frozen;
+
+    /*
+     * Data for the current time step and the buffered time steps.
+     */
+    bool d_step_is_open;
+    int d_step_num;
+    double d_step_time, d_step_dt;
+    std::vector<double> d_step_values;
+    std::vector<int> d_buffered_step_nums;
+    std::vector<double> d_buffered_step_times, d_buffered_step_dts;
+    std::vector<double> d_buffered_values;
+
+    /*
+     * Local values accumulated over all completed time steps since the last
+     * reset.
+     */
+    std::vector<double> d_accumulated_values;
+
+    /*
+     * The output stream (only used by MPI process 0).
+     */
+    std::ofstream d_output_stream;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_PerformanceTelemetry
@@ -0,0 +1,175 @@
+// Filename: WorkloadReport.h
+// Created on 18 Oct 2026 by agent
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_WorkloadReport
+#define included_WorkloadReport
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "PatchHierarchy.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace tbox
+{
+class Database;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class WorkloadReport gathers the distribution of work across MPI
+ * processes and levels of a patch hierarchy and reports load imbalance
+ * statistics, e.g., after each regridding operation.
+ *
+ * The numbers of cells and patches assigned to each process on each level of
+ * the patch hierarchy are always reported.  Other per-level counts (e.g.,
+ * numbers of Lagrangian nodes or of finite element quadrature points), the
+ * values of a cell-centered workload estimate, and measured per-process phase
+ * times may be provided prior to generating the report.  For each quantity,
+ * the report includes the minimum, maximum, and mean values over all
+ * processes, the imbalance ratio (max/mean), and a histogram of the
+ * per-process values.  Optionally, a per-patch workload map (the owning
+ * process, index space extents, number of cells, and total workload of each
+ * patch) is written in CSV format for visualization.
+ *
+ * Sample input database entries:
+ \verbatim
+ num_histogram_bins = 10                      // number of histogram bins
+ write_patch_workload_map = FALSE             // whether to write the per-patch workload map
+ patch_workload_map_file_name = "workload"    // base name of the per-patch workload map files
+ \endverbatim
+ *
+ * \note The counts, phase times, and workload data index must be provided
+ * collectively, i.e., in the same order by all processes.
+ */
+class WorkloadReport : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    WorkloadReport(const std::string& object_name, SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~WorkloadReport();
+
+    /*!
+     * \brief Add the local value of a named count on the specified level of the
+     * patch hierarchy to the next report.
+     */
+    void addLevelCount(const std::string& count_name, int level_number, double local_count);
+
+    /*!
+     * \brief Add the local measured time of a named phase to the next report.
+     */
+    void addPhaseTime(const std::string& phase_name, double local_time);
+
+    /*!
+     * \brief Set the patch data index of a cell-centered workload estimate to be
+     * included in the next report.
+     */
+    void setWorkloadDataIndex(int workload_data_idx);
+
+    /*!
+     * \brief Generate the report, and reset the counts, phase times, and
+     * workload data index.
+     *
+     * \note This method is collective.  The report is written to plog by MPI
+     * process 0.
+     */
+    void generateReport(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                        int step_num,
+                        double time);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    WorkloadReport();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    WorkloadReport(const WorkloadReport& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    WorkloadReport& operator=(const WorkloadReport& that);
+
+    /*!
+     * \brief Write the per-patch workload map.
+     */
+    void writePatchWorkloadMap(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy, int step_num);
+
+    std::string d_object_name;
+    int d_num_histogram_bins;
+    bool d_write_patch_workload_map;
+    std::string d_patch_workload_map_file_name;
+
+    /*
+     * Data to be included in the next report.
+     */
+    std::map<std::string, std::vector<double> > d_level_counts;
+    std::vector<std::pair<std::string, double> > d_phase_times;
+    int d_workload_data_idx;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_WorkloadReport
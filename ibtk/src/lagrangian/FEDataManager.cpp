@@ -1770,6 +1770,24 @@ void FEDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int
     return;
 } // updateWorkloadEstimates
 
+double FEDataManager::getNumberOfLocalQuadPoints()
+{
+    const int ln = d_level_number;
+    updateQuadPointCountData(ln, ln);
+    double num_local_qps = 0.0;
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > qp_count_data = patch->getPatchData(d_qp_count_idx);
+        for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+        {
+            num_local_qps += (*qp_count_data)(b());
+        }
+    }
+    return num_local_qps;
+} // getNumberOfLocalQuadPoints
+
 void FEDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
                                         const int level_number,
                                         const double /*init_data_time*/,
@@ -40,6 +40,7 @@
 #include "boost/multi_array.hpp"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LData.h"
+#include "ibtk/LDataVecPool.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "petscsys.h"
 #include "petscvec.h"
@@ -60,10 +61,10 @@ LData::LData(const std::string& name,
              const unsigned int depth,
              const std::vector<int>& nonlocal_petsc_indices)
     : d_name(name), d_global_node_count(0), d_local_node_count(0), d_ghost_node_count(0), d_depth(depth),
-      d_nonlocal_petsc_indices(nonlocal_petsc_indices), d_global_vec(NULL), d_managing_petsc_vec(true), d_array(NULL),
-      d_boost_array(NULL), d_boost_local_array(NULL), d_boost_vec_array(NULL), d_boost_local_vec_array(NULL),
-      d_ghosted_local_vec(NULL), d_ghosted_local_array(NULL), d_boost_ghosted_local_array(NULL),
-      d_boost_vec_ghosted_local_array(NULL)
+      d_nonlocal_petsc_indices(nonlocal_petsc_indices), d_global_vec(NULL), d_managing_petsc_vec(true),
+      d_vec_pool(NULL), d_array(NULL), d_boost_array(NULL), d_boost_local_array(NULL), d_boost_vec_array(NULL),
+      d_boost_local_vec_array(NULL), d_ghosted_local_vec(NULL), d_ghosted_local_array(NULL),
+      d_boost_ghosted_local_array(NULL), d_boost_vec_ghosted_local_array(NULL)
 {
     // Create the PETSc Vec that provides storage for the Lagrangian data.
     int ierr;
@@ -101,13 +102,44 @@ LData::LData(const std::string& name,
     return;
 } // LData
 
+LData::LData(const std::string& name,
+             const unsigned int num_local_nodes,
+             const unsigned int depth,
+             const std::vector<int>& nonlocal_petsc_indices,
+             Pointer<LDataVecPool> vec_pool,
+             const int vec_pool_layout_id)
+    : d_name(name), d_global_node_count(0), d_local_node_count(0), d_ghost_node_count(0), d_depth(depth),
+      d_nonlocal_petsc_indices(nonlocal_petsc_indices), d_global_vec(NULL), d_managing_petsc_vec(true),
+      d_vec_pool(vec_pool), d_array(NULL), d_boost_array(NULL), d_boost_local_array(NULL), d_boost_vec_array(NULL),
+      d_boost_local_vec_array(NULL), d_ghosted_local_vec(NULL), d_ghosted_local_array(NULL),
+      d_boost_ghosted_local_array(NULL), d_boost_vec_ghosted_local_array(NULL)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_vec_pool);
+#endif
+    // Get a PETSc Vec that provides storage for the Lagrangian data from the
+    // pool.
+    d_global_vec = d_vec_pool->getVec(vec_pool_layout_id, d_depth, num_local_nodes, d_nonlocal_petsc_indices);
+    int global_node_count;
+    const int ierr = VecGetSize(d_global_vec, &global_node_count);
+    IBTK_CHKERRQ(ierr);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(global_node_count >= 0);
+#endif
+    d_global_node_count = global_node_count;
+    d_global_node_count /= d_depth;
+    d_local_node_count = num_local_nodes;
+    d_ghost_node_count = static_cast<int>(d_nonlocal_petsc_indices.size());
+    return;
+} // LData
+
 LData::LData(const std::string& name,
              Vec vec,
              const std::vector<int>& nonlocal_petsc_indices,
              const bool manage_petsc_vec)
     : d_name(name), d_global_node_count(0), d_local_node_count(0), d_ghost_node_count(0), d_depth(0),
       d_nonlocal_petsc_indices(nonlocal_petsc_indices), d_global_vec(vec), d_managing_petsc_vec(manage_petsc_vec),
-      d_array(NULL), d_boost_array(NULL), d_boost_local_array(NULL), d_boost_vec_array(NULL),
+      d_vec_pool(NULL), d_array(NULL), d_boost_array(NULL), d_boost_local_array(NULL), d_boost_vec_array(NULL),
       d_boost_local_vec_array(NULL), d_ghosted_local_vec(NULL), d_ghosted_local_array(NULL),
       d_boost_ghosted_local_array(NULL), d_boost_vec_ghosted_local_array(NULL)
 {
@@ -141,10 +173,10 @@ LData::LData(const std::string& name,
 
 LData::LData(Pointer<Database> db)
     : d_name(db->getString("d_name")), d_global_node_count(0), d_local_node_count(0), d_ghost_node_count(0),
-      d_depth(db->getInteger("d_depth")), d_nonlocal_petsc_indices(), d_global_vec(NULL), d_array(NULL),
-      d_boost_array(NULL), d_boost_local_array(NULL), d_boost_vec_array(NULL), d_boost_local_vec_array(NULL),
-      d_ghosted_local_vec(NULL), d_ghosted_local_array(NULL), d_boost_ghosted_local_array(NULL),
-      d_boost_vec_ghosted_local_array(NULL)
+      d_depth(db->getInteger("d_depth")), d_nonlocal_petsc_indices(), d_global_vec(NULL), d_managing_petsc_vec(true),
+      d_vec_pool(NULL), d_array(NULL), d_boost_array(NULL), d_boost_local_array(NULL), d_boost_vec_array(NULL),
+      d_boost_local_vec_array(NULL), d_ghosted_local_vec(NULL), d_ghosted_local_array(NULL),
+      d_boost_ghosted_local_array(NULL), d_boost_vec_ghosted_local_array(NULL)
 {
     int num_local_nodes = db->getInteger("num_local_nodes");
     int num_ghost_nodes = db->getInteger("num_ghost_nodes");
@@ -204,27 +236,23 @@ LData::LData(Pointer<Database> db)
 LData::~LData()
 {
     restoreArrays();
-    if (d_managing_petsc_vec)
-    {
-        const int ierr = VecDestroy(&d_global_vec);
-        IBTK_CHKERRQ(ierr);
-    }
+    releaseVec();
     return;
 } // ~LData
 
-void LData::resetData(Vec vec, const std::vector<int>& nonlocal_petsc_indices, const bool manage_petsc_vec)
+void LData::resetData(Vec vec,
+                      const std::vector<int>& nonlocal_petsc_indices,
+                      const bool manage_petsc_vec,
+                      Pointer<LDataVecPool> vec_pool)
 {
     restoreArrays();
-    int ierr;
-    if (d_managing_petsc_vec)
-    {
-        ierr = VecDestroy(&d_global_vec);
-        IBTK_CHKERRQ(ierr);
-    }
+    releaseVec();
 
     // Take ownership of new Vec
+    int ierr;
     d_global_vec = vec;
     d_managing_petsc_vec = manage_petsc_vec;
+    d_vec_pool = vec_pool;
 
     int depth;
     ierr = VecGetBlockSize(d_global_vec, &depth);
@@ -282,6 +310,21 @@ void LData::putToDatabase(Pointer<Database> db)
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void LData::releaseVec()
+{
+    if (!d_managing_petsc_vec) return;
+    if (d_vec_pool)
+    {
+        d_vec_pool->releaseVec(d_global_vec);
+    }
+    else
+    {
+        const int ierr = VecDestroy(&d_global_vec);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // releaseVec
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -35,6 +35,7 @@
 #include <math.h>
 #include <stddef.h>
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <map>
 #include <numeric>
@@ -66,6 +67,7 @@
 #include "HierarchyCellDataOpsReal.h"
 #include "HierarchyDataOpsManager.h"
 #include "HierarchyDataOpsReal.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
 #include "MultiblockDataTranslator.h"
@@ -91,6 +93,7 @@
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
+#include "ibtk/LDataVecPool.h"
 #include "ibtk/LEInteractor.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LInitStrategy.h"
@@ -173,6 +176,30 @@ inline int round(double x)
 {
     return floor(x + 0.5);
 } // round
+
+// Compares cell indices (offset to be nonnegative) by their positions along a
+// Morton (Z-order) space-filling curve without explicitly interleaving their
+// bits.
+struct MortonOrderComp
+    : std::binary_function<std::pair<Index<NDIM>, LNode*>, std::pair<Index<NDIM>, LNode*>, bool>
+{
+    inline bool operator()(const std::pair<Index<NDIM>, LNode*>& lhs, const std::pair<Index<NDIM>, LNode*>& rhs) const
+    {
+        // Determine the dimension with the most significant differing bit.
+        int msd = 0;
+        unsigned int msd_bits = static_cast<unsigned int>(lhs.first(0) ^ rhs.first(0));
+        for (unsigned int d = 1; d < NDIM; ++d)
+        {
+            const unsigned int bits = static_cast<unsigned int>(lhs.first(d) ^ rhs.first(d));
+            if (msd_bits < bits && msd_bits < (msd_bits ^ bits))
+            {
+                msd = d;
+                msd_bits = bits;
+            }
+        }
+        return lhs.first(msd) < rhs.first(msd);
+    } // operator()
+};
 }
 
 const std::string LDataManager::POSN_DATA_NAME = "X";
@@ -266,6 +293,12 @@ void LDataManager::setPatchLevels(const int coarsest_ln, const int finest_ln)
         }
     }
 
+    for (int level_number = finest_ln + 1; level_number < static_cast<int>(d_vec_pool_layout_ids.size());
+         ++level_number)
+    {
+        resetVecPoolLayoutID(level_number);
+    }
+
     // Reset the level numbers.
     d_coarsest_ln = coarsest_ln;
     d_finest_ln = finest_ln;
@@ -291,6 +324,7 @@ void LDataManager::setPatchLevels(const int coarsest_ln, const int finest_ln)
     d_nonlocal_lag_indices.resize(d_finest_ln + 1);
     d_local_petsc_indices.resize(d_finest_ln + 1);
     d_nonlocal_petsc_indices.resize(d_finest_ln + 1);
+    d_vec_pool_layout_ids.resize(d_finest_ln + 1, -1);
     return;
 } // setPatchLevels
 
@@ -437,7 +471,8 @@ void LDataManager::spread(const int f_data_idx,
         if (ds_data_ghost_node_update) ds_data[ln]->endGhostUpdate();
 
         const int depth = F_data[ln]->getDepth();
-        F_ds_data[ln] = new LData("", getNumberOfLocalNodes(ln), depth, d_nonlocal_petsc_indices[ln]);
+        F_ds_data[ln] = new LData(
+            "", getNumberOfLocalNodes(ln), depth, d_nonlocal_petsc_indices[ln], d_vec_pool, getVecPoolLayoutID(ln));
         boost::multi_array_ref<double, 2>& F_ds_arr = *F_ds_data[ln]->getGhostedLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& F_arr = *F_data[ln]->getGhostedLocalFormVecArray();
         const boost::multi_array_ref<double, 1>& ds_arr = *ds_data[ln]->getGhostedLocalFormArray();
@@ -875,6 +910,12 @@ void LDataManager::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balanc
     return;
 } // return
 
+void LDataManager::setUseSpaceFillingCurveOrdering(const bool use_sfc_ordering)
+{
+    d_use_sfc_ordering = use_sfc_ordering;
+    return;
+} // setUseSpaceFillingCurveOrdering
+
 Pointer<LData> LDataManager::createLData(const std::string& quantity_name,
                                          const int level_number,
                                          const unsigned int depth,
@@ -887,8 +928,12 @@ Pointer<LData> LDataManager::createLData(const std::string& quantity_name,
     TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
     TBOX_ASSERT(depth > 0);
 #endif
-    Pointer<LData> ret_val =
-        new LData(quantity_name, getNumberOfLocalNodes(level_number), depth, d_nonlocal_petsc_indices[level_number]);
+    Pointer<LData> ret_val = new LData(quantity_name,
+                                       getNumberOfLocalNodes(level_number),
+                                       depth,
+                                       d_nonlocal_petsc_indices[level_number],
+                                       d_vec_pool,
+                                       getVecPoolLayoutID(level_number));
     if (maintain_data)
     {
         d_lag_mesh_data[level_number][quantity_name] = ret_val;
@@ -1304,33 +1349,19 @@ void LDataManager::scatterPETScToLagrangian(Vec& petsc_vec, Vec& lagrangian_vec,
 
 void LDataManager::scatterToAll(Vec& parallel_vec, Vec& sequential_vec) const
 {
-    int ierr;
-    const bool create_vout = !sequential_vec;
-    VecScatter ctx;
-    ierr = VecScatterCreateToAll(parallel_vec, &ctx, (create_vout ? &sequential_vec : NULL));
-    IBTK_CHKERRQ(ierr);
-    ierr = VecScatterBegin(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecScatterEnd(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecScatterDestroy(&ctx);
-    IBTK_CHKERRQ(ierr);
+    scatterToSequential(parallel_vec, sequential_vec, SCATTER_TO_ALL, std::vector<int>());
     return;
 } // scatterToAll
 
 void LDataManager::scatterToZero(Vec& parallel_vec, Vec& sequential_vec) const
 {
-    int ierr;
-    const bool create_vout = !sequential_vec;
-    VecScatter ctx;
-    ierr = VecScatterCreateToZero(parallel_vec, &ctx, (create_vout ? &sequential_vec : NULL));
-    IBTK_CHKERRQ(ierr);
-    ierr = VecScatterBegin(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecScatterEnd(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecScatterDestroy(&ctx);
-    IBTK_CHKERRQ(ierr);
+    scatterToSequential(parallel_vec, sequential_vec, SCATTER_TO_ZERO, std::vector<int>());
+    return;
+} // scatterToZero
+
+void LDataManager::scatterToZero(Vec& parallel_vec, Vec& sequential_vec, const std::vector<int>& petsc_node_idxs) const
+{
+    scatterToSequential(parallel_vec, sequential_vec, SCATTER_SUBSET_TO_ZERO, petsc_node_idxs);
     return;
 } // scatterToZero
 
@@ -1745,6 +1776,21 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
         num_local_nodes[level_number] = static_cast<int>(d_local_lag_indices[level_number].size());
         num_nonlocal_nodes[level_number] = static_cast<int>(d_nonlocal_lag_indices[level_number].size());
 
+        // The Vec objects associated with the old layout can no longer be
+        // reused, but their storage can be recycled.
+        //
+        // NOTE: The layout is retired before the destination Vec objects are
+        // obtained so that the storage of any free Vec objects with the old
+        // layout can back the destination Vec objects.  The source Vec objects
+        // must remain intact until the scatters below have completed, so their
+        // storage is returned to the pool only when they are released by
+        // LData::resetData().  That storage is therefore recycled by the
+        // destination Vec objects of the *next* redistribution (i.e., with a
+        // delay of one regrid); during the scatters, both the old and new data
+        // are necessarily allocated.
+        resetVecPoolLayoutID(level_number);
+        const int layout_id = getVecPoolLayoutID(level_number);
+
         // Setup src indices.
         std::vector<int> src_inds(num_local_nodes[level_number]);
         for (int k = 0; k < num_local_nodes[level_number]; ++k)
@@ -1807,17 +1853,10 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
                 IBTK_CHKERRQ(ierr);
             }
 
-            // Create the destination Vec.
+            // Get the destination Vec from the pool.
             src_vec[level_number][i] = data->getVec();
-            ierr = VecCreateGhostBlock(
-                PETSC_COMM_WORLD,
-                depth,
-                depth * num_local_nodes[level_number],
-                PETSC_DECIDE,
-                num_nonlocal_nodes[level_number],
-                num_nonlocal_nodes[level_number] > 0 ? &d_nonlocal_petsc_indices[level_number][0] : NULL,
-                &dst_vec[level_number][i]);
-            IBTK_CHKERRQ(ierr);
+            dst_vec[level_number][i] = d_vec_pool->getVec(
+                layout_id, depth, num_local_nodes[level_number], d_nonlocal_petsc_indices[level_number]);
 
             // Create the VecScatter.
             ierr = VecScatterCreate(src_vec[level_number][i],
@@ -1913,7 +1952,7 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
             ierr = VecScatterDestroy(&scatter[level_number][i]);
             IBTK_CHKERRQ(ierr);
             Pointer<LData> data = it->second;
-            data->resetData(dst_vec[level_number][i], d_nonlocal_petsc_indices[level_number]);
+            data->resetData(dst_vec[level_number][i], d_nonlocal_petsc_indices[level_number], true, d_vec_pool);
         }
     }
 
@@ -1947,6 +1986,10 @@ void LDataManager::endDataRedistribution(const int coarsest_ln_in, const int fin
         }
     }
 
+    // The parallel layouts of the LData have changed, so cached scatter
+    // contexts are no longer likely to be reused.
+    clearSequentialScatterCache();
+
     // If a Silo data writer is registered with the manager, give it access to
     // the new application orderings.
     if (d_silo_writer)
@@ -2130,6 +2173,7 @@ void LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> >
         d_nonlocal_lag_indices.resize(level_number + 1);
         d_local_petsc_indices.resize(level_number + 1);
         d_nonlocal_petsc_indices.resize(level_number + 1);
+        d_vec_pool_layout_ids.resize(level_number + 1, -1);
 
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_lag_init);
@@ -2162,6 +2206,7 @@ void LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> >
 
         d_nonlocal_lag_indices[level_number].clear();
         d_nonlocal_petsc_indices[level_number].clear();
+        resetVecPoolLayoutID(level_number);
 
         computeNodeOffsets(d_num_nodes[level_number], d_node_offset[level_number], num_local_nodes);
         TBOX_ASSERT(d_num_nodes[level_number] == num_global_nodes);
@@ -2602,13 +2647,15 @@ LDataManager::LDataManager(const std::string& object_name,
       d_coarsest_ln(-1), d_finest_ln(-1), d_visit_writer(NULL), d_silo_writer(NULL), d_load_balancer(NULL),
       d_lag_init(NULL), d_level_contains_lag_data(), d_lag_node_index_var(NULL), d_lag_node_index_current_idx(-1),
       d_lag_node_index_scratch_idx(-1), d_beta_work(1.0), d_workload_var(NULL), d_workload_idx(-1),
-      d_output_workload(false), d_node_count_var(NULL), d_node_count_idx(-1), d_output_node_count(false),
+      d_output_workload(false), d_use_sfc_ordering(false), d_node_count_var(NULL), d_node_count_idx(-1),
+      d_output_node_count(false),
       d_default_interp_kernel_fcn(default_interp_kernel_fcn), d_default_spread_kernel_fcn(default_spread_kernel_fcn),
       d_ghost_width(ghost_width), d_lag_node_index_bdry_fill_alg(NULL), d_lag_node_index_bdry_fill_scheds(),
       d_node_count_coarsen_alg(NULL), d_node_count_coarsen_scheds(), d_current_context(NULL), d_scratch_context(NULL),
       d_current_data(), d_scratch_data(), d_lag_mesh(), d_lag_mesh_data(), d_needs_synch(true), d_ao(), d_num_nodes(),
       d_node_offset(), d_local_lag_indices(), d_nonlocal_lag_indices(), d_local_petsc_indices(),
-      d_nonlocal_petsc_indices()
+      d_nonlocal_petsc_indices(), d_vec_pool_layout_ids(), d_sequential_scatter_cache(), d_vec_pool(NULL),
+      d_next_vec_pool_layout_id(0)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -2620,6 +2667,9 @@ LDataManager::LDataManager(const std::string& object_name,
         RestartManager::getManager()->registerRestartItem(d_object_name, this);
     }
 
+    // Setup the pool of PETSc Vec objects used by the LData.
+    d_vec_pool = new LDataVecPool(d_object_name + "::vec_pool");
+
     bool from_restart = RestartManager::getManager()->isFromRestart();
     if (from_restart)
     {
@@ -2710,6 +2760,9 @@ LDataManager::~LDataManager()
             IBTK_CHKERRQ(ierr);
         }
     }
+
+    // Destroy any cached VecScatter objects.
+    clearSequentialScatterCache();
     return;
 } // ~LDataManager
 
@@ -2786,6 +2839,122 @@ void LDataManager::scatterData(Vec& lagrangian_vec, Vec& petsc_vec, const int le
     return;
 } // scatterData
 
+void LDataManager::scatterToSequential(Vec& parallel_vec,
+                                       Vec& sequential_vec,
+                                       const SequentialScatterType scatter_type,
+                                       const std::vector<int>& petsc_node_idxs) const
+{
+    int ierr;
+
+    // Build the cache key from the layout of the parallel vector.  Since the
+    // ownership ranges are the same on each processor, the result of the cache
+    // lookup is also the same on each processor.
+    int bs;
+    ierr = VecGetBlockSize(parallel_vec, &bs);
+    IBTK_CHKERRQ(ierr);
+    const int* ranges;
+    ierr = VecGetOwnershipRanges(parallel_vec, &ranges);
+    IBTK_CHKERRQ(ierr);
+    const int num_procs = SAMRAI_MPI::getNodes();
+    std::vector<int> key;
+    key.reserve(num_procs + 3 + petsc_node_idxs.size());
+    key.push_back(static_cast<int>(scatter_type));
+    key.push_back(bs);
+    key.insert(key.end(), ranges, ranges + num_procs + 1);
+    if (scatter_type == SCATTER_SUBSET_TO_ZERO)
+    {
+        key.insert(key.end(), petsc_node_idxs.begin(), petsc_node_idxs.end());
+    }
+
+    std::map<std::vector<int>, std::pair<VecScatter, Vec> >::iterator it = d_sequential_scatter_cache.find(key);
+    if (it == d_sequential_scatter_cache.end())
+    {
+        VecScatter ctx;
+        Vec vout;
+        switch (scatter_type)
+        {
+        case SCATTER_TO_ALL:
+            ierr = VecScatterCreateToAll(parallel_vec, &ctx, &vout);
+            IBTK_CHKERRQ(ierr);
+            break;
+        case SCATTER_TO_ZERO:
+            ierr = VecScatterCreateToZero(parallel_vec, &ctx, &vout);
+            IBTK_CHKERRQ(ierr);
+            break;
+        case SCATTER_SUBSET_TO_ZERO:
+        {
+            // Only processor zero receives any data.
+            const int num_idxs = SAMRAI_MPI::getRank() == 0 ? static_cast<int>(petsc_node_idxs.size()) : 0;
+            ierr = VecCreateSeq(PETSC_COMM_SELF, bs * num_idxs, &vout);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecSetBlockSize(vout, bs);
+            IBTK_CHKERRQ(ierr);
+            IS is_from;
+            ierr = ISCreateBlock(
+                PETSC_COMM_SELF, bs, num_idxs, num_idxs > 0 ? &petsc_node_idxs[0] : NULL, PETSC_COPY_VALUES, &is_from);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecScatterCreate(parallel_vec, is_from, vout, NULL, &ctx);
+            IBTK_CHKERRQ(ierr);
+            ierr = ISDestroy(&is_from);
+            IBTK_CHKERRQ(ierr);
+            break;
+        }
+        default:
+            TBOX_ERROR(d_object_name << "::scatterToSequential():\n"
+                       << "  unrecognized scatter type: " << scatter_type << "\n");
+        }
+        it = d_sequential_scatter_cache.insert(std::make_pair(key, std::make_pair(ctx, vout))).first;
+    }
+
+    VecScatter& ctx = it->second.first;
+    if (!sequential_vec)
+    {
+        ierr = VecDuplicate(it->second.second, &sequential_vec);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = VecScatterBegin(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterEnd(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // scatterToSequential
+
+void LDataManager::clearSequentialScatterCache()
+{
+    int ierr;
+    for (std::map<std::vector<int>, std::pair<VecScatter, Vec> >::iterator it = d_sequential_scatter_cache.begin();
+         it != d_sequential_scatter_cache.end();
+         ++it)
+    {
+        ierr = VecScatterDestroy(&it->second.first);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&it->second.second);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_sequential_scatter_cache.clear();
+    return;
+} // clearSequentialScatterCache
+
+int LDataManager::getVecPoolLayoutID(const int level_number)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number >= 0 && level_number < static_cast<int>(d_vec_pool_layout_ids.size()));
+#endif
+    if (d_vec_pool_layout_ids[level_number] == -1)
+    {
+        d_vec_pool_layout_ids[level_number] = d_next_vec_pool_layout_id++;
+    }
+    return d_vec_pool_layout_ids[level_number];
+} // getVecPoolLayoutID
+
+void LDataManager::resetVecPoolLayoutID(const int level_number)
+{
+    if (level_number >= static_cast<int>(d_vec_pool_layout_ids.size())) return;
+    d_vec_pool->retireLayout(d_vec_pool_layout_ids[level_number]);
+    d_vec_pool_layout_ids[level_number] = -1;
+    return;
+} // resetVecPoolLayoutID
+
 void LDataManager::beginNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_in)
 {
     IBTK_TIMER_START(t_begin_nonlocal_data_fill);
@@ -2874,15 +3043,41 @@ void LDataManager::computeNodeDistribution(AO& ao,
     // Collect the local nodes and assign local indices to the local nodes.
     unsigned int local_offset = 0;
     std::map<int, int> lag_idx_to_petsc_idx;
-#if 1
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    if (d_use_sfc_ordering)
     {
-        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-        for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
+        // Order the local nodes along a space-filling curve through the cells
+        // that contain them.  Nodes in the same cell retain their relative
+        // ordering.
+        std::vector<std::pair<Index<NDIM>, LNode*> > local_nodes;
+        Index<NDIM> index_lower(std::numeric_limits<int>::max());
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
-            LNode* const node_idx = *it;
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            for (LNodeSetData::SetIterator it(*idx_data); it; it++)
+            {
+                const Index<NDIM>& i = it.getIndex();
+                if (!patch_box.contains(i)) continue;
+                const LNodeSet& node_set = *it;
+                for (LNodeSet::const_iterator node_it = node_set.begin(); node_it != node_set.end(); ++node_it)
+                {
+                    local_nodes.push_back(std::make_pair(i, *node_it));
+                }
+                index_lower.min(i);
+            }
+        }
+        for (std::vector<std::pair<Index<NDIM>, LNode*> >::iterator it = local_nodes.begin(); it != local_nodes.end();
+             ++it)
+        {
+            it->first -= index_lower;
+        }
+        std::stable_sort(local_nodes.begin(), local_nodes.end(), MortonOrderComp());
+        for (std::vector<std::pair<Index<NDIM>, LNode*> >::const_iterator it = local_nodes.begin();
+             it != local_nodes.end();
+             ++it)
+        {
+            LNode* const node_idx = it->second;
             const int lag_idx = node_idx->getLagrangianIndex();
             local_lag_indices.push_back(lag_idx);
             const int petsc_idx = local_offset++;
@@ -2890,20 +3085,17 @@ void LDataManager::computeNodeDistribution(AO& ao,
             lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
         }
     }
-#else
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    else
     {
-        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+#if 1
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
-            const Index<NDIM>& i = b();
-            if (!idx_data->isElement(i)) continue;
-            const LNodeSet* const node_set = idx_data->getItem(i);
-            for (LNodeSet::const_iterator node_it = node_set->begin(); node_it != node_set->end(); ++node_it)
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
             {
-                LNode* const node_idx = *node_it;
+                LNode* const node_idx = *it;
                 const int lag_idx = node_idx->getLagrangianIndex();
                 local_lag_indices.push_back(lag_idx);
                 const int petsc_idx = local_offset++;
@@ -2911,8 +3103,30 @@ void LDataManager::computeNodeDistribution(AO& ao,
                 lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
             }
         }
-    }
+#else
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const Index<NDIM>& i = b();
+                if (!idx_data->isElement(i)) continue;
+                const LNodeSet* const node_set = idx_data->getItem(i);
+                for (LNodeSet::const_iterator node_it = node_set->begin(); node_it != node_set->end(); ++node_it)
+                {
+                    LNode* const node_idx = *node_it;
+                    const int lag_idx = node_idx->getLagrangianIndex();
+                    local_lag_indices.push_back(lag_idx);
+                    const int petsc_idx = local_offset++;
+                    node_idx->setLocalPETScIndex(petsc_idx);
+                    lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+                }
+            }
+        }
 #endif
+    }
 
     // Determine the Lagrangian indices of the nonlocal nodes.
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
@@ -3092,6 +3306,7 @@ void LDataManager::getFromRestart()
     d_nonlocal_lag_indices.resize(d_finest_ln + 1);
     d_local_petsc_indices.resize(d_finest_ln + 1);
     d_nonlocal_petsc_indices.resize(d_finest_ln + 1);
+    d_vec_pool_layout_ids.resize(d_finest_ln + 1, -1);
 
     // Read in data that is stored on a level-by-level basis.
     for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
@@ -0,0 +1,242 @@
+// Filename: LDataVecPool.cpp
+// Created on 18 Oct 2026 by agent
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <algorithm>
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibtk/IBTK_CHKERRQ.h"
+#include "ibtk/LDataVecPool.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "petscsys.h"
+#include "petscvec.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LDataVecPool::LDataVecPool(const std::string& object_name, const double slack_factor)
+    : d_object_name(object_name), d_slack_factor(slack_factor), d_vecs(), d_free_storage(), d_retired_layout_ids()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!object_name.empty());
+    TBOX_ASSERT(slack_factor >= 0.0);
+#endif
+    return;
+} // LDataVecPool
+
+LDataVecPool::~LDataVecPool()
+{
+    std::vector<Vec> vecs;
+    for (std::map<Vec, VecRecord>::const_iterator cit = d_vecs.begin(); cit != d_vecs.end(); ++cit)
+    {
+        if (cit->second.in_use)
+        {
+            TBOX_WARNING(d_object_name << "::~LDataVecPool():\n"
+                                       << "  destroying pool while Vec objects are still in use.\n");
+        }
+        vecs.push_back(cit->first);
+    }
+    for (std::vector<Vec>::iterator it = vecs.begin(); it != vecs.end(); ++it)
+    {
+        destroyVec(*it);
+    }
+    freeUnusedStorage();
+    return;
+} // ~LDataVecPool
+
+Vec LDataVecPool::getVec(const int layout_id,
+                         const unsigned int depth,
+                         const unsigned int num_local_nodes,
+                         const std::vector<int>& nonlocal_petsc_indices)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(layout_id >= 0);
+    TBOX_ASSERT(depth > 0);
+    TBOX_ASSERT(d_retired_layout_ids.find(layout_id) == d_retired_layout_ids.end());
+#endif
+    int ierr;
+    const unsigned int num_ghost_nodes = static_cast<unsigned int>(nonlocal_petsc_indices.size());
+    const size_t size = static_cast<size_t>(depth) * static_cast<size_t>(num_local_nodes + num_ghost_nodes);
+
+    // Look for a free Vec with the same layout.
+    for (std::map<Vec, VecRecord>::iterator it = d_vecs.begin(); it != d_vecs.end(); ++it)
+    {
+        VecRecord& record = it->second;
+        if (!record.in_use && record.layout_id == layout_id && record.depth == depth)
+        {
+            record.in_use = true;
+            ierr = PetscMemzero(record.array, size * sizeof(double));
+            IBTK_CHKERRQ(ierr);
+            return it->first;
+        }
+    }
+
+    // Otherwise, create a new Vec that uses recycled storage.
+    VecRecord record;
+    record.layout_id = layout_id;
+    record.depth = depth;
+    record.array = acquireStorage(size, record.capacity);
+    record.in_use = true;
+    ierr = PetscMemzero(record.array, size * sizeof(double));
+    IBTK_CHKERRQ(ierr);
+    Vec vec;
+    ierr = VecCreateGhostBlockWithArray(PETSC_COMM_WORLD,
+                                        depth,
+                                        depth * num_local_nodes,
+                                        PETSC_DECIDE,
+                                        static_cast<int>(num_ghost_nodes),
+                                        nonlocal_petsc_indices.empty() ? NULL : &nonlocal_petsc_indices[0],
+                                        record.array,
+                                        &vec);
+    IBTK_CHKERRQ(ierr);
+    d_vecs.insert(std::make_pair(vec, record));
+    return vec;
+} // getVec
+
+void LDataVecPool::releaseVec(Vec& vec)
+{
+    if (!vec) return;
+    int ierr;
+    std::map<Vec, VecRecord>::iterator it = d_vecs.find(vec);
+    if (it == d_vecs.end())
+    {
+        ierr = VecDestroy(&vec);
+        IBTK_CHKERRQ(ierr);
+        return;
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(it->second.in_use);
+#endif
+    it->second.in_use = false;
+    if (d_retired_layout_ids.find(it->second.layout_id) != d_retired_layout_ids.end())
+    {
+        destroyVec(vec);
+    }
+    vec = NULL;
+    return;
+} // releaseVec
+
+void LDataVecPool::retireLayout(const int layout_id)
+{
+    if (layout_id < 0) return;
+    d_retired_layout_ids.insert(layout_id);
+    std::vector<Vec> free_vecs;
+    for (std::map<Vec, VecRecord>::const_iterator cit = d_vecs.begin(); cit != d_vecs.end(); ++cit)
+    {
+        if (!cit->second.in_use && cit->second.layout_id == layout_id) free_vecs.push_back(cit->first);
+    }
+    for (std::vector<Vec>::iterator it = free_vecs.begin(); it != free_vecs.end(); ++it)
+    {
+        destroyVec(*it);
+    }
+    return;
+} // retireLayout
+
+void LDataVecPool::freeUnusedStorage()
+{
+    int ierr;
+    for (std::multimap<size_t, double*>::iterator it = d_free_storage.begin(); it != d_free_storage.end(); ++it)
+    {
+        ierr = PetscFree(it->second);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_free_storage.clear();
+    return;
+} // freeUnusedStorage
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+double* LDataVecPool::acquireStorage(const size_t size, size_t& capacity)
+{
+    // Use the smallest block of free storage that is large enough.
+    std::multimap<size_t, double*>::iterator it = d_free_storage.lower_bound(size);
+    if (it != d_free_storage.end())
+    {
+        capacity = it->first;
+        double* const array = it->second;
+        d_free_storage.erase(it);
+        return array;
+    }
+
+    // None of the free storage is large enough.  Release the largest block
+    // (which is too small) to prevent the pool from accumulating storage that
+    // is never reused, and allocate a new block with some slack.
+    int ierr;
+    if (!d_free_storage.empty())
+    {
+        std::multimap<size_t, double*>::iterator last = --d_free_storage.end();
+        ierr = PetscFree(last->second);
+        IBTK_CHKERRQ(ierr);
+        d_free_storage.erase(last);
+    }
+    capacity = std::max(static_cast<size_t>(1), size + static_cast<size_t>(d_slack_factor * static_cast<double>(size)));
+    double* array = NULL;
+    ierr = PetscMalloc(capacity * sizeof(double), &array);
+    IBTK_CHKERRQ(ierr);
+    return array;
+} // acquireStorage
+
+void LDataVecPool::destroyVec(Vec vec)
+{
+    std::map<Vec, VecRecord>::iterator it = d_vecs.find(vec);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(it != d_vecs.end());
+#endif
+    // NOTE: Destroying a Vec created with user-provided storage does not free
+    // that storage.
+    const int ierr = VecDestroy(&vec);
+    IBTK_CHKERRQ(ierr);
+    d_free_storage.insert(std::make_pair(it->second.capacity, it->second.array));
+    d_vecs.erase(it);
+    return;
+} // destroyVec
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
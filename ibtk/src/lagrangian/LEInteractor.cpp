@@ -63,6 +63,8 @@
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 // FORTRAN ROUTINES
@@ -626,6 +628,10 @@ namespace IBTK
 
 namespace
 {
+// Timers.
+static Timer* t_interpolate;
+static Timer* t_spread;
+
 inline double ib4_kernel_fcn(double r)
 {
     r = std::abs(r);
@@ -2425,6 +2431,10 @@ void LEInteractor::interpolate(double* const Q_data,
                    << "  ghost cell width         = " << q_gcw_min << "\n");
     }
     if (local_indices.empty()) return;
+
+    IBTK_DO_ONCE(t_interpolate = TimerManager::getManager()->getTimer("IBTK::LEInteractor::interpolate()"););
+    IBTK_TIMER_START(t_interpolate);
+
     const int local_indices_size = static_cast<int>(local_indices.size());
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
@@ -2706,6 +2716,8 @@ void LEInteractor::interpolate(double* const Q_data,
         TBOX_ERROR("LEInteractor::interpolate()\n"
                    << "  Unknown interpolation kernel function " << interp_fcn << std::endl);
     }
+
+    IBTK_TIMER_STOP(t_interpolate);
     return;
 }
 
@@ -2744,6 +2756,10 @@ void LEInteractor::spread(double* const q_data,
                    << "  ghost cell width         = " << q_gcw_min << "\n");
     }
     if (local_indices.empty()) return;
+
+    IBTK_DO_ONCE(t_spread = TimerManager::getManager()->getTimer("IBTK::LEInteractor::spread()"););
+    IBTK_TIMER_START(t_spread);
+
     const int local_indices_size = static_cast<int>(local_indices.size());
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
@@ -3025,6 +3041,8 @@ void LEInteractor::spread(double* const q_data,
         TBOX_ERROR("LEInteractor::spread()\n"
                    << "  Unknown spreading kernel function " << spread_fcn << std::endl);
     }
+
+    IBTK_TIMER_STOP(t_spread);
     return;
 }
 
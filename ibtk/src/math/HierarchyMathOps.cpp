@@ -90,6 +90,7 @@
 #include "VariableDatabase.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/PatchDataMemoryManager.h"
 #include "ibtk/PatchMathOps.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -1335,6 +1336,7 @@ void HierarchyMathOps::grad(const int dst_idx,
         {
             VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
             int cc_idx = var_db->registerClonedPatchDataIndex(dst_var, dst_idx);
+            PatchDataMemoryManager::getManager()->registerPatchDataOwner(cc_idx, d_object_name);
             const Pointer<CellVariable<NDIM, double> > cc_var = dst_var;
 
             for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
@@ -1361,6 +1363,7 @@ void HierarchyMathOps::grad(const int dst_idx,
                 d_hierarchy->getPatchLevel(ln)->deallocatePatchData(cc_idx);
             }
 
+            PatchDataMemoryManager::getManager()->unregisterPatchDataOwner(cc_idx);
             var_db->removePatchDataIndex(cc_idx);
             cc_idx = -1;
         }
@@ -1538,6 +1541,7 @@ void HierarchyMathOps::grad(const int dst_idx,
     {
         VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
         int cc_idx = var_db->registerClonedPatchDataIndex(dst_var, dst_idx);
+        PatchDataMemoryManager::getManager()->registerPatchDataOwner(cc_idx, d_object_name);
         const Pointer<CellVariable<NDIM, double> > cc_var = dst_var;
 
         for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
@@ -1564,6 +1568,7 @@ void HierarchyMathOps::grad(const int dst_idx,
             d_hierarchy->getPatchLevel(ln)->deallocatePatchData(cc_idx);
         }
 
+        PatchDataMemoryManager::getManager()->unregisterPatchDataOwner(cc_idx);
         var_db->removePatchDataIndex(cc_idx);
         cc_idx = -1;
     }
@@ -1624,6 +1629,7 @@ void HierarchyMathOps::grad(const int dst_idx,
     {
         VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
         int cc_idx = var_db->registerClonedPatchDataIndex(dst_var, dst_idx);
+        PatchDataMemoryManager::getManager()->registerPatchDataOwner(cc_idx, d_object_name);
         const Pointer<CellVariable<NDIM, double> > cc_var = dst_var;
 
         for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
@@ -1650,6 +1656,7 @@ void HierarchyMathOps::grad(const int dst_idx,
             d_hierarchy->getPatchLevel(ln)->deallocatePatchData(cc_idx);
         }
 
+        PatchDataMemoryManager::getManager()->unregisterPatchDataOwner(cc_idx);
         var_db->removePatchDataIndex(cc_idx);
         cc_idx = -1;
     }
@@ -2225,6 +2232,7 @@ void HierarchyMathOps::laplace(const int dst_idx,
         {
             VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
             int cc_idx = var_db->registerClonedPatchDataIndex(dst_var, dst_idx);
+            PatchDataMemoryManager::getManager()->registerPatchDataOwner(cc_idx, d_object_name);
             const Pointer<CellVariable<NDIM, double> > cc_var = dst_var;
             const int cc_depth = dst_depth;
 
@@ -2255,6 +2263,7 @@ void HierarchyMathOps::laplace(const int dst_idx,
                 d_hierarchy->getPatchLevel(ln)->deallocatePatchData(cc_idx);
             }
 
+            PatchDataMemoryManager::getManager()->unregisterPatchDataOwner(cc_idx);
             var_db->removePatchDataIndex(cc_idx);
             cc_idx = -1;
         }
@@ -51,8 +51,11 @@
 #include "SideGeometry.h"
 #include "boost/array.hpp"
 #include "ibtk/PatchMathOps.h"
+#include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 // FORTRAN ROUTINES
@@ -1173,11 +1176,30 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Timers.
+static Timer* t_curl;
+static Timer* t_rot;
+static Timer* t_div;
+static Timer* t_grad;
+static Timer* t_interp;
+static Timer* t_laplace;
+static Timer* t_vc_laplace;
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 PatchMathOps::PatchMathOps()
 {
-    // intentionally blank
+    // Setup Timers.
+    IBTK_DO_ONCE(t_curl = TimerManager::getManager()->getTimer("IBTK::PatchMathOps::curl()");
+                 t_rot = TimerManager::getManager()->getTimer("IBTK::PatchMathOps::rot()");
+                 t_div = TimerManager::getManager()->getTimer("IBTK::PatchMathOps::div()");
+                 t_grad = TimerManager::getManager()->getTimer("IBTK::PatchMathOps::grad()");
+                 t_interp = TimerManager::getManager()->getTimer("IBTK::PatchMathOps::interp()");
+                 t_laplace = TimerManager::getManager()->getTimer("IBTK::PatchMathOps::laplace()");
+                 t_vc_laplace = TimerManager::getManager()->getTimer("IBTK::PatchMathOps::vc_laplace()"););
     return;
 } // PatchMathOps
 
@@ -1191,6 +1213,8 @@ void PatchMathOps::curl(Pointer<CellData<NDIM, double> > dst,
                         const Pointer<CellData<NDIM, double> > src,
                         const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_curl);
+
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
@@ -1279,6 +1303,8 @@ void PatchMathOps::curl(Pointer<CellData<NDIM, double> > dst,
                    patch_box.upper(2),
 #endif
                    dx);
+
+    IBTK_TIMER_STOP(t_curl);
     return;
 } // curl
 
@@ -1286,6 +1312,8 @@ void PatchMathOps::curl(Pointer<CellData<NDIM, double> > dst,
                         const Pointer<FaceData<NDIM, double> > src,
                         const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_curl);
+
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
@@ -1374,6 +1402,8 @@ void PatchMathOps::curl(Pointer<CellData<NDIM, double> > dst,
                    patch_box.upper(2),
 #endif
                    dx);
+
+    IBTK_TIMER_STOP(t_curl);
     return;
 } // curl
 
@@ -1381,6 +1411,8 @@ void PatchMathOps::curl(Pointer<FaceData<NDIM, double> > dst,
                         const Pointer<FaceData<NDIM, double> > src,
                         const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_curl);
+
 #if (NDIM != 3)
     TBOX_ERROR("PatchMathOps::curl():\n"
                << "  not implemented for NDIM != 3" << std::endl);
@@ -1461,6 +1493,8 @@ void PatchMathOps::curl(Pointer<FaceData<NDIM, double> > dst,
                    patch_box.upper(2),
                    dx);
 #endif
+
+    IBTK_TIMER_STOP(t_curl);
     return;
 } // curl
 
@@ -1468,6 +1502,8 @@ void PatchMathOps::curl(Pointer<CellData<NDIM, double> > dst,
                         const Pointer<SideData<NDIM, double> > src,
                         const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_curl);
+
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
@@ -1556,6 +1592,8 @@ void PatchMathOps::curl(Pointer<CellData<NDIM, double> > dst,
                    patch_box.upper(2),
 #endif
                    dx);
+
+    IBTK_TIMER_STOP(t_curl);
     return;
 } // curl
 
@@ -1563,6 +1601,8 @@ void PatchMathOps::curl(Pointer<SideData<NDIM, double> > dst,
                         const Pointer<SideData<NDIM, double> > src,
                         const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_curl);
+
 #if (NDIM != 3)
     TBOX_ERROR("PatchMathOps::curl():\n"
                << "  not implemented for NDIM != 3" << std::endl);
@@ -1643,6 +1683,8 @@ void PatchMathOps::curl(Pointer<SideData<NDIM, double> > dst,
                    patch_box.upper(2),
                    dx);
 #endif
+
+    IBTK_TIMER_STOP(t_curl);
     return;
 } // curl
 
@@ -1650,6 +1692,8 @@ void PatchMathOps::curl(Pointer<NodeData<NDIM, double> > dst,
                         const Pointer<SideData<NDIM, double> > src,
                         const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_curl);
+
 #if (NDIM != 2)
     TBOX_ERROR("PatchMathOps::curl():\n"
                << "  not implemented for NDIM != 2" << std::endl);
@@ -1722,6 +1766,8 @@ void PatchMathOps::curl(Pointer<NodeData<NDIM, double> > dst,
                    patch_box.upper(1),
                    dx);
 #endif
+
+    IBTK_TIMER_STOP(t_curl);
     return;
 } // curl
 
@@ -1729,6 +1775,8 @@ void PatchMathOps::curl(Pointer<EdgeData<NDIM, double> > dst,
                         const Pointer<SideData<NDIM, double> > src,
                         const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_curl);
+
 #if (NDIM != 3)
     TBOX_ERROR("PatchMathOps::curl():\n"
                << "  not implemented for NDIM != 3" << std::endl);
@@ -1809,6 +1857,8 @@ void PatchMathOps::curl(Pointer<EdgeData<NDIM, double> > dst,
                    patch_box.upper(2),
                    dx);
 #endif
+
+    IBTK_TIMER_STOP(t_curl);
     return;
 } // curl
 
@@ -1816,6 +1866,8 @@ void PatchMathOps::rot(Pointer<SideData<NDIM, double> > dst,
                        const Pointer<NodeData<NDIM, double> > src,
                        const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_rot);
+
 #if (NDIM != 2)
     TBOX_ERROR("PatchMathOps::rot():\n"
                << "  not implemented for NDIM != 2" << std::endl);
@@ -1879,6 +1931,8 @@ void PatchMathOps::rot(Pointer<SideData<NDIM, double> > dst,
                   patch_box.upper(1),
                   dx);
 #endif
+
+    IBTK_TIMER_STOP(t_rot);
     return;
 } // rot
 
@@ -1886,6 +1940,8 @@ void PatchMathOps::rot(Pointer<SideData<NDIM, double> > dst,
                        const Pointer<CellData<NDIM, double> > src,
                        const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_rot);
+
 #if (NDIM != 2)
     TBOX_ERROR("PatchMathOps::rot():\n"
                << "  not implemented for NDIM != 2" << std::endl);
@@ -1958,6 +2014,8 @@ void PatchMathOps::rot(Pointer<SideData<NDIM, double> > dst,
                   patch_box.upper(1),
                   dx);
 #endif
+
+    IBTK_TIMER_STOP(t_rot);
     return;
 } // rot
 
@@ -1965,6 +2023,8 @@ void PatchMathOps::rot(Pointer<SideData<NDIM, double> > dst,
                        const Pointer<EdgeData<NDIM, double> > src,
                        const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_rot);
+
 #if (NDIM != 3)
     TBOX_ERROR("PatchMathOps::rot():\n"
                << "  not implemented for NDIM != 3" << std::endl);
@@ -2037,6 +2097,8 @@ void PatchMathOps::rot(Pointer<SideData<NDIM, double> > dst,
                   patch_box.upper(2),
                   dx);
 #endif
+
+    IBTK_TIMER_STOP(t_rot);
     return;
 } // rot
 
@@ -2057,6 +2119,8 @@ void PatchMathOps::div(Pointer<CellData<NDIM, double> > dst,
                        const int l,
                        const int m) const
 {
+    IBTK_TIMER_START(t_div);
+
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
@@ -2176,6 +2240,8 @@ void PatchMathOps::div(Pointer<CellData<NDIM, double> > dst,
 #endif
                           dx);
     }
+
+    IBTK_TIMER_STOP(t_div);
     return;
 } // div
 
@@ -2188,6 +2254,8 @@ void PatchMathOps::div(Pointer<CellData<NDIM, double> > dst,
                        const int l,
                        const int m) const
 {
+    IBTK_TIMER_START(t_div);
+
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
@@ -2290,6 +2358,8 @@ void PatchMathOps::div(Pointer<CellData<NDIM, double> > dst,
 #endif
                           dx);
     }
+
+    IBTK_TIMER_STOP(t_div);
     return;
 } // div
 
@@ -2302,6 +2372,8 @@ void PatchMathOps::div(Pointer<CellData<NDIM, double> > dst,
                        const int l,
                        const int m) const
 {
+    IBTK_TIMER_START(t_div);
+
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
@@ -2404,6 +2476,8 @@ void PatchMathOps::div(Pointer<CellData<NDIM, double> > dst,
 #endif
                           dx);
     }
+
+    IBTK_TIMER_STOP(t_div);
     return;
 } // div
 
@@ -2415,6 +2489,8 @@ void PatchMathOps::grad(Pointer<CellData<NDIM, double> > dst,
                         const Pointer<Patch<NDIM> > patch,
                         const int l) const
 {
+    IBTK_TIMER_START(t_grad);
+
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
@@ -2542,6 +2618,8 @@ void PatchMathOps::grad(Pointer<CellData<NDIM, double> > dst,
 #endif
                            dx);
     }
+
+    IBTK_TIMER_STOP(t_grad);
     return;
 } // grad
 
@@ -2553,6 +2631,8 @@ void PatchMathOps::grad(Pointer<FaceData<NDIM, double> > dst,
                         const Pointer<Patch<NDIM> > patch,
                         const int l) const
 {
+    IBTK_TIMER_START(t_grad);
+
     // Compute the gradient.
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
@@ -2673,6 +2753,8 @@ void PatchMathOps::grad(Pointer<FaceData<NDIM, double> > dst,
 #endif
                            dx);
     }
+
+    IBTK_TIMER_STOP(t_grad);
     return;
 } // grad
 
@@ -2684,6 +2766,8 @@ void PatchMathOps::grad(Pointer<SideData<NDIM, double> > dst,
                         const Pointer<Patch<NDIM> > patch,
                         const int l) const
 {
+    IBTK_TIMER_START(t_grad);
+
     // Compute the gradient.
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
@@ -2804,6 +2888,8 @@ void PatchMathOps::grad(Pointer<SideData<NDIM, double> > dst,
 #endif
                            dx);
     }
+
+    IBTK_TIMER_STOP(t_grad);
     return;
 } // grad
 
@@ -2815,6 +2901,8 @@ void PatchMathOps::grad(Pointer<FaceData<NDIM, double> > dst,
                         const Pointer<Patch<NDIM> > patch,
                         const int l) const
 {
+    IBTK_TIMER_START(t_grad);
+
     // Compute the gradient.
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
@@ -3011,6 +3099,8 @@ void PatchMathOps::grad(Pointer<FaceData<NDIM, double> > dst,
             patch_fc_data_ops.axpy(dst, beta, src2, dst, patch_box);
         }
     }
+
+    IBTK_TIMER_STOP(t_grad);
     return;
 } // grad
 
@@ -3022,6 +3112,8 @@ void PatchMathOps::grad(Pointer<SideData<NDIM, double> > dst,
                         const Pointer<Patch<NDIM> > patch,
                         const int l) const
 {
+    IBTK_TIMER_START(t_grad);
+
     // Compute the gradient.
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
@@ -3210,6 +3302,8 @@ void PatchMathOps::grad(Pointer<SideData<NDIM, double> > dst,
             patch_sc_data_ops.axpy(dst, beta, src2, dst, patch_box);
         }
     }
+
+    IBTK_TIMER_STOP(t_grad);
     return;
 } // grad
 
@@ -3217,6 +3311,8 @@ void PatchMathOps::interp(Pointer<CellData<NDIM, double> > dst,
                           const Pointer<FaceData<NDIM, double> > src,
                           const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_interp);
+
     const int U_ghosts = (dst->getGhostCellWidth()).max();
     const int v_ghosts = (src->getGhostCellWidth()).max();
 
@@ -3284,6 +3380,8 @@ void PatchMathOps::interp(Pointer<CellData<NDIM, double> > dst,
 #endif
                              );
     }
+
+    IBTK_TIMER_STOP(t_interp);
     return;
 } // interp
 
@@ -3291,6 +3389,8 @@ void PatchMathOps::interp(Pointer<CellData<NDIM, double> > dst,
                           const Pointer<SideData<NDIM, double> > src,
                           const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_interp);
+
     const int U_ghosts = (dst->getGhostCellWidth()).max();
     const int v_ghosts = (src->getGhostCellWidth()).max();
 
@@ -3358,6 +3458,8 @@ void PatchMathOps::interp(Pointer<CellData<NDIM, double> > dst,
 #endif
                              );
     }
+
+    IBTK_TIMER_STOP(t_interp);
     return;
 } // interp
 
@@ -3365,6 +3467,8 @@ void PatchMathOps::interp(Pointer<FaceData<NDIM, double> > dst,
                           const Pointer<CellData<NDIM, double> > src,
                           const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_interp);
+
     const int u_ghosts = (dst->getGhostCellWidth()).max();
     const int V_ghosts = (src->getGhostCellWidth()).max();
 
@@ -3440,6 +3544,8 @@ void PatchMathOps::interp(Pointer<FaceData<NDIM, double> > dst,
 #endif
                              );
     }
+
+    IBTK_TIMER_STOP(t_interp);
     return;
 } // interp
 
@@ -3447,6 +3553,8 @@ void PatchMathOps::interp(Pointer<SideData<NDIM, double> > dst,
                           const Pointer<CellData<NDIM, double> > src,
                           const Pointer<Patch<NDIM> > patch) const
 {
+    IBTK_TIMER_START(t_interp);
+
     const int u_ghosts = (dst->getGhostCellWidth()).max();
     const int V_ghosts = (src->getGhostCellWidth()).max();
 
@@ -3522,6 +3630,8 @@ void PatchMathOps::interp(Pointer<SideData<NDIM, double> > dst,
 #endif
                              );
     }
+
+    IBTK_TIMER_STOP(t_interp);
     return;
 } // interp
 
@@ -3536,6 +3646,8 @@ void PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
                            const int m,
                            const int n) const
 {
+    IBTK_TIMER_START(t_laplace);
+
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
@@ -3692,6 +3804,8 @@ void PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
                                   dx);
         }
     }
+
+    IBTK_TIMER_STOP(t_laplace);
     return;
 } // laplace
 
@@ -3706,6 +3820,8 @@ void PatchMathOps::laplace(Pointer<SideData<NDIM, double> > dst,
                            const int m,
                            const int n) const
 {
+    IBTK_TIMER_START(t_laplace);
+
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
@@ -3896,6 +4012,8 @@ void PatchMathOps::laplace(Pointer<SideData<NDIM, double> > dst,
             }
         }
     }
+
+    IBTK_TIMER_STOP(t_laplace);
     return;
 } // laplace
 
@@ -3910,6 +4028,8 @@ void PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
                            const int m,
                            const int n) const
 {
+    IBTK_TIMER_START(t_laplace);
+
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
@@ -4111,6 +4231,8 @@ void PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
                                                  dx);
         }
     }
+
+    IBTK_TIMER_STOP(t_laplace);
     return;
 } // laplace
 
@@ -4125,6 +4247,8 @@ void PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
                            const int m,
                            const int n) const
 {
+    IBTK_TIMER_START(t_laplace);
+
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
@@ -4326,6 +4450,8 @@ void PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
                                                  dx);
         }
     }
+
+    IBTK_TIMER_STOP(t_laplace);
     return;
 } // laplace
 
@@ -4341,6 +4467,8 @@ void PatchMathOps::vc_laplace(Pointer<SideData<NDIM, double> > dst,
                               const int m,
                               const int n) const
 {
+    IBTK_TIMER_START(t_vc_laplace);
+
 #if (NDIM == 2)
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
@@ -4501,6 +4629,8 @@ void PatchMathOps::vc_laplace(Pointer<SideData<NDIM, double> > dst,
     NULL_USE(m);
     NULL_USE(n);
 #endif
+
+    IBTK_TIMER_STOP(t_vc_laplace);
     return;
 } // vc_laplace
 
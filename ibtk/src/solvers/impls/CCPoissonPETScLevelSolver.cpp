@@ -57,6 +57,7 @@
 #include "ibtk/PETScLevelSolver.h"
 #include "ibtk/PETScMatUtilities.h"
 #include "ibtk/PETScVecUtilities.h"
+#include "ibtk/PatchDataMemoryManager.h"
 #include "ibtk/PoissonUtilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "petscmat.h"
@@ -180,6 +181,7 @@ void CCPoissonPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
     Pointer<CellVariable<NDIM, double> > b_var = b.getComponentVariable(0);
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     int b_adj_idx = var_db->registerClonedPatchDataIndex(b_var, b_idx);
+    PatchDataMemoryManager::getManager()->registerPatchDataOwner(b_adj_idx, d_object_name);
     patch_level->allocatePatchData(b_adj_idx);
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
@@ -193,6 +195,7 @@ void CCPoissonPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
     }
     PETScVecUtilities::copyToPatchLevelVec(petsc_b, b_adj_idx, d_dof_index_idx, patch_level);
     patch_level->deallocatePatchData(b_adj_idx);
+    PatchDataMemoryManager::getManager()->unregisterPatchDataOwner(b_adj_idx);
     var_db->removePatchDataIndex(b_adj_idx);
     return;
 } // setupKSPVecs
@@ -56,6 +56,7 @@
 #include "ibtk/PETScLevelSolver.h"
 #include "ibtk/PETScMatUtilities.h"
 #include "ibtk/PETScVecUtilities.h"
+#include "ibtk/PatchDataMemoryManager.h"
 #include "ibtk/PoissonUtilities.h"
 #include "ibtk/SCPoissonPETScLevelSolver.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -180,6 +181,7 @@ void SCPoissonPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
     Pointer<SideVariable<NDIM, double> > b_var = b.getComponentVariable(0);
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     int b_adj_idx = var_db->registerClonedPatchDataIndex(b_var, b_idx);
+    PatchDataMemoryManager::getManager()->registerPatchDataOwner(b_adj_idx, d_object_name);
     patch_level->allocatePatchData(b_adj_idx);
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
@@ -193,6 +195,7 @@ void SCPoissonPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
     }
     PETScVecUtilities::copyToPatchLevelVec(petsc_b, b_adj_idx, d_dof_index_idx, patch_level);
     patch_level->deallocatePatchData(b_adj_idx);
+    PatchDataMemoryManager::getManager()->unregisterPatchDataOwner(b_adj_idx);
     var_db->removePatchDataIndex(b_adj_idx);
     return;
 } // setupKSPVecs
@@ -41,6 +41,7 @@
 
 #include "VisItDataWriter.h"
 #include "ibtk/AppInitializer.h"
+#include "ibtk/HardwareCounters.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -423,11 +424,19 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         }
         TimerManager::createManager(timer_manager_db);
     }
+
+    // Configure hardware performance counters.
+    if (d_input_db->isDatabase("HardwareCounters"))
+    {
+        HardwareCounters::setFromDatabase(d_input_db->getDatabase("HardwareCounters"));
+    }
     return;
 } // AppInitializer
 
 AppInitializer::~AppInitializer()
 {
+    if (HardwareCounters::isEnabled()) HardwareCounters::printReport(plog);
+    HardwareCounters::finalize();
     InputManager::freeManager();
     return;
 } // ~AppInitializer
@@ -0,0 +1,395 @@
+// Filename: HardwareCounters.cpp
+// Created on 18 Oct 2026 by agent
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include "ibtk/HardwareCounters.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The sampled hardware events.
+enum HardwareEvent
+{
+    CYCLES = 0,
+    INSTRUCTIONS = 1,
+    LLC_MISSES = 2,
+    FP_OPS = 3,
+    NUM_EVENTS = 4
+};
+
+// The number of values read for each sample: the time enabled, the time
+// running, and the value of each event.
+static const int NUM_VALUES = NUM_EVENTS + 2;
+
+// The data accumulated for each timer region.
+struct RegionData
+{
+    RegionData() : name(), sampled(false), depth(0), num_calls(0)
+    {
+        std::fill(start_values, start_values + NUM_VALUES, 0);
+        std::fill(total_values, total_values + NUM_VALUES, 0);
+        return;
+    } // RegionData
+
+    std::string name;
+    bool sampled;
+    int depth;
+    unsigned long num_calls;
+    uint64_t start_values[NUM_VALUES];
+    uint64_t total_values[NUM_VALUES];
+};
+
+// The regions that have been encountered since counters were enabled, keyed
+// by the corresponding timer.
+static std::map<const Timer*, RegionData> s_regions;
+
+// The timer names (or name prefixes) to sample; all timers are sampled when
+// no names are specified.
+static std::vector<std::string> s_timer_names;
+
+// The file descriptors of the counter group leader and of each event, and the
+// position of each event within the values read from the group (or -1 if the
+// event is unavailable).
+static int s_group_fd = -1;
+static int s_event_fds[NUM_EVENTS] = { -1, -1, -1, -1 };
+static int s_event_slots[NUM_EVENTS] = { -1, -1, -1, -1 };
+static int s_num_open_events = 0;
+
+bool timerNameSelected(const std::string& timer_name)
+{
+    if (s_timer_names.empty()) return true;
+    for (std::vector<std::string>::const_iterator it = s_timer_names.begin(); it != s_timer_names.end(); ++it)
+    {
+        const std::string& name = *it;
+        if (!name.empty() && name[name.size() - 1] == '*')
+        {
+            if (timer_name.compare(0, name.size() - 1, name, 0, name.size() - 1) == 0) return true;
+        }
+        else if (timer_name == name)
+        {
+            return true;
+        }
+    }
+    return false;
+} // timerNameSelected
+
+#if defined(__linux__)
+int openEvent(const uint32_t type, const uint64_t config, const int group_fd)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = (group_fd == -1 ? 1 : 0);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+} // openEvent
+#endif
+
+void addEvent(const HardwareEvent event, const int fd)
+{
+    if (fd < 0) return;
+    s_event_fds[event] = fd;
+    s_event_slots[event] = s_num_open_events++;
+    return;
+} // addEvent
+
+bool openCounters(const int fp_ops_raw_event)
+{
+#if defined(__linux__)
+    const int leader_fd = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (leader_fd < 0) return false;
+    s_group_fd = leader_fd;
+    addEvent(CYCLES, leader_fd);
+    addEvent(INSTRUCTIONS, openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, s_group_fd));
+    int llc_fd = openEvent(PERF_TYPE_HW_CACHE,
+                           PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+                           s_group_fd);
+    if (llc_fd < 0) llc_fd = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, s_group_fd);
+    addEvent(LLC_MISSES, llc_fd);
+    if (fp_ops_raw_event >= 0)
+    {
+        addEvent(FP_OPS, openEvent(PERF_TYPE_RAW, static_cast<uint64_t>(fp_ops_raw_event), s_group_fd));
+    }
+    if (ioctl(s_group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP) != 0 ||
+        ioctl(s_group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0)
+    {
+        return false;
+    }
+    return true;
+#else
+    NULL_USE(fp_ops_raw_event);
+    return false;
+#endif
+} // openCounters
+
+void closeCounters()
+{
+#if defined(__linux__)
+    for (int k = NUM_EVENTS - 1; k >= 0; --k)
+    {
+        if (s_event_fds[k] >= 0) close(s_event_fds[k]);
+    }
+#endif
+    std::fill(s_event_fds, s_event_fds + NUM_EVENTS, -1);
+    std::fill(s_event_slots, s_event_slots + NUM_EVENTS, -1);
+    s_group_fd = -1;
+    s_num_open_events = 0;
+    return;
+} // closeCounters
+
+bool readCounters(uint64_t* const values)
+{
+#if defined(__linux__)
+    // The group read format is: the number of events, the time enabled, the
+    // time running, and the value of each event in the order in which the
+    // events were added to the group.
+    uint64_t buf[3 + NUM_EVENTS];
+    const ssize_t num_bytes = read(s_group_fd, buf, sizeof(buf));
+    if (num_bytes < static_cast<ssize_t>((3 + s_num_open_events) * sizeof(uint64_t))) return false;
+    values[0] = buf[1];
+    values[1] = buf[2];
+    for (int k = 0; k < NUM_EVENTS; ++k)
+    {
+        values[2 + k] = (s_event_slots[k] >= 0 ? buf[3 + s_event_slots[k]] : 0);
+    }
+    return true;
+#else
+    NULL_USE(values);
+    return false;
+#endif
+} // readCounters
+
+void disableCounters(const std::string& reason)
+{
+    TBOX_WARNING("HardwareCounters: " << reason << "\n"
+                                      << "  hardware counter sampling has been disabled.\n");
+    HardwareCounters::finalize();
+    return;
+} // disableCounters
+}
+
+bool HardwareCounters::s_enabled = false;
+
+void HardwareCounters::setFromDatabase(Pointer<Database> db)
+{
+    finalize();
+    if (!db) return;
+
+    bool enable_hardware_counters = true;
+    if (db->keyExists("enable_hardware_counters"))
+        enable_hardware_counters = db->getBool("enable_hardware_counters");
+    if (db->keyExists("timer_names"))
+    {
+        Array<std::string> timer_names = db->getStringArray("timer_names");
+        s_timer_names.assign(timer_names.getPointer(), timer_names.getPointer() + timer_names.size());
+    }
+    int fp_ops_raw_event = -1;
+    if (db->keyExists("fp_ops_raw_event")) fp_ops_raw_event = db->getInteger("fp_ops_raw_event");
+    if (!enable_hardware_counters) return;
+
+    if (!openCounters(fp_ops_raw_event))
+    {
+        disableCounters("hardware performance counters are not available on this system.");
+        return;
+    }
+    s_enabled = true;
+    return;
+} // setFromDatabase
+
+void HardwareCounters::finalize()
+{
+    closeCounters();
+    s_regions.clear();
+    s_timer_names.clear();
+    s_enabled = false;
+    return;
+} // finalize
+
+void HardwareCounters::startRegion(const Timer* const timer)
+{
+    if (!s_enabled) return;
+    std::map<const Timer*, RegionData>::iterator it = s_regions.find(timer);
+    if (it == s_regions.end())
+    {
+        RegionData region;
+        region.name = timer->getName();
+        region.sampled = timerNameSelected(region.name);
+        it = s_regions.insert(std::make_pair(timer, region)).first;
+    }
+    RegionData& region = it->second;
+    if (!region.sampled) return;
+    if (region.depth++ > 0) return;
+    if (!readCounters(region.start_values))
+    {
+        disableCounters("unable to read hardware performance counters.");
+    }
+    return;
+} // startRegion
+
+void HardwareCounters::stopRegion(const Timer* const timer)
+{
+    if (!s_enabled) return;
+    std::map<const Timer*, RegionData>::iterator it = s_regions.find(timer);
+    if (it == s_regions.end()) return;
+    RegionData& region = it->second;
+    if (!region.sampled || region.depth == 0) return;
+    if (--region.depth > 0) return;
+    uint64_t stop_values[NUM_VALUES];
+    if (!readCounters(stop_values))
+    {
+        disableCounters("unable to read hardware performance counters.");
+        return;
+    }
+    for (int k = 0; k < NUM_VALUES; ++k)
+    {
+        region.total_values[k] += stop_values[k] - region.start_values[k];
+    }
+    ++region.num_calls;
+    return;
+} // stopRegion
+
+void HardwareCounters::printReport(std::ostream& os)
+{
+    os << "HardwareCounters::printReport(): hardware counter values for the local MPI process\n";
+    if (!s_enabled)
+    {
+        os << "  hardware counter sampling is not enabled\n";
+        return;
+    }
+
+    // Sort the regions by name so that the report is reproducible.
+    std::map<std::string, const RegionData*> sorted_regions;
+    for (std::map<const Timer*, RegionData>::const_iterator it = s_regions.begin(); it != s_regions.end(); ++it)
+    {
+        if (it->second.num_calls > 0) sorted_regions[it->second.name] = &it->second;
+    }
+    if (sorted_regions.empty())
+    {
+        os << "  no regions have been sampled\n";
+        return;
+    }
+
+    static const char* const EVENT_NAMES[NUM_EVENTS] = { "cycles", "instructions", "LLC misses", "FP ops" };
+    for (std::map<std::string, const RegionData*>::const_iterator it = sorted_regions.begin();
+         it != sorted_regions.end();
+         ++it)
+    {
+        const RegionData& region = *it->second;
+        const double time_enabled = static_cast<double>(region.total_values[0]);
+        const double time_running = static_cast<double>(region.total_values[1]);
+
+        // Scale the event counts to account for counter multiplexing.
+        double event_values[NUM_EVENTS];
+        bool event_available[NUM_EVENTS];
+        for (int k = 0; k < NUM_EVENTS; ++k)
+        {
+            event_available[k] = s_event_slots[k] >= 0 && time_running > 0.0;
+            event_values[k] = event_available[k] ?
+                                  static_cast<double>(region.total_values[2 + k]) * time_enabled / time_running :
+                                  0.0;
+        }
+
+        os << "  " << region.name << "\n";
+        os << "    calls = " << region.num_calls << ", wall time = " << 1.0e-9 * time_enabled << " s";
+        if (time_running < time_enabled)
+        {
+            os << " (counters active " << 100.0 * time_running / std::max(time_enabled, 1.0) << "% of the time)";
+        }
+        os << "\n";
+        os << "   ";
+        for (int k = 0; k < NUM_EVENTS; ++k)
+        {
+            os << " " << EVENT_NAMES[k] << " = ";
+            if (event_available[k])
+                os << event_values[k];
+            else
+                os << "n/a";
+            os << (k < NUM_EVENTS - 1 ? "," : "\n");
+        }
+        if (event_available[CYCLES] && event_available[INSTRUCTIONS] && event_values[CYCLES] > 0.0)
+        {
+            os << "    instructions per cycle = " << event_values[INSTRUCTIONS] / event_values[CYCLES];
+            if (event_available[LLC_MISSES] && event_values[INSTRUCTIONS] > 0.0)
+            {
+                os << ", LLC misses per 1000 instructions = "
+                   << 1000.0 * event_values[LLC_MISSES] / event_values[INSTRUCTIONS];
+            }
+            if (event_available[FP_OPS])
+            {
+                os << ", FP ops per cycle = " << event_values[FP_OPS] / event_values[CYCLES];
+            }
+            os << "\n";
+        }
+    }
+    return;
+} // printReport
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -77,7 +77,10 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/PatchDataMemoryManager.h"
+#include "ibtk/PerformanceTelemetry.h"
 #include "ibtk/RefinePatchStrategySet.h"
+#include "ibtk/WorkloadReport.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -145,6 +148,9 @@ HierarchyIntegrator::HierarchyIntegrator(const std::string& object_name,
     d_regrid_interval = 1;
     d_regrid_mode = STANDARD;
     d_enable_logging = false;
+    d_enable_telemetry = false;
+    d_enable_workload_report = false;
+    d_enable_memory_report = false;
     d_bdry_extrap_type = "LINEAR";
     d_manage_hier_math_ops = true;
     d_tag_buffer.resizeArray(1);
@@ -163,6 +169,24 @@ HierarchyIntegrator::HierarchyIntegrator(const std::string& object_name,
     }
     if (input_db) getFromInput(input_db, from_restart);
 
+    // Setup the performance telemetry object.
+    if (d_enable_telemetry)
+    {
+        d_telemetry = new PerformanceTelemetry(d_object_name + "::PerformanceTelemetry", d_telemetry_db);
+        d_telemetry->registerPhase("regrid");
+        d_telemetry->registerPhase("preprocess");
+        d_telemetry->registerPhase("integrate");
+        d_telemetry->registerPhase("postprocess");
+        d_telemetry->registerPhase("synchronize");
+        d_telemetry->registerCounter("eulerian_cells");
+    }
+
+    // Setup the workload report object.
+    if (d_enable_workload_report)
+    {
+        d_workload_report = new WorkloadReport(d_object_name + "::WorkloadReport", d_workload_report_db);
+    }
+
     // Initialize all variable contexts.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     d_current_context = var_db->getContext(d_object_name + "::CURRENT");
@@ -314,16 +338,65 @@ void HierarchyIntegrator::advanceHierarchy(double dt)
     if (d_enable_logging)
         plog << d_object_name << "::advanceHierarchy(): time interval = [" << current_time << "," << new_time
              << "], dt = " << dt << "\n";
+    Pointer<PerformanceTelemetry> telemetry = getPerformanceTelemetry();
+    if (telemetry) telemetry->beginStep(d_integrator_step, current_time, dt);
 
     // Regrid the patch hierarchy.
     if (atRegridPoint())
     {
         if (d_enable_logging)
             plog << d_object_name << "::advanceHierarchy(): regridding prior to timestep " << d_integrator_step << "\n";
+
+        // Report the memory allocated for patch data prior to regridding, while
+        // the data used during the preceding time steps (including solver and
+        // operator scratch data) remain allocated.
+        if (d_enable_memory_report)
+        {
+            PatchDataMemoryManager* memory_manager = PatchDataMemoryManager::getManager();
+            memory_manager->computeMemoryUsage(d_hierarchy);
+            memory_manager->printReport(plog);
+        }
+
+        startTelemetryPhase("regrid");
         d_regridding_hierarchy = true;
         regridHierarchy();
         d_regridding_hierarchy = false;
         d_at_regrid_time_step = true;
+        stopTelemetryPhase("regrid");
+
+        // Report the distribution of work across processes, including the
+        // measured phase times accumulated since the preceding report.
+        Pointer<WorkloadReport> workload_report = getWorkloadReport();
+        if (workload_report)
+        {
+            if (telemetry)
+            {
+                std::vector<std::string> phase_names;
+                std::vector<double> phase_times;
+                telemetry->getAccumulatedPhaseTimes(phase_names, phase_times);
+                for (unsigned int k = 0; k < phase_names.size(); ++k)
+                {
+                    workload_report->addPhaseTime(phase_names[k], phase_times[k]);
+                }
+                telemetry->resetAccumulatedValues();
+            }
+            workload_report->generateReport(d_hierarchy, d_integrator_step, current_time);
+        }
+    }
+
+    // Record the number of Eulerian grid cells assigned to this process.
+    if (telemetry)
+    {
+        double num_local_cells = 0.0;
+        for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                num_local_cells += static_cast<double>(level->getPatch(p())->getBox().size());
+            }
+        }
+        telemetry->addCount("eulerian_cells", num_local_cells);
     }
 
     // Determine the number of cycles and the time step size.
@@ -333,12 +406,15 @@ void HierarchyIntegrator::advanceHierarchy(double dt)
     // Execute the preprocessing method of the parent integrator, and
     // recursively execute all preprocessing callbacks registered with the
     // parent and child integrators.
+    startTelemetryPhase("preprocess");
     preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+    stopTelemetryPhase("preprocess");
 
     // Perform one or more cycles.  In each cycle, execute the integration
     // method of the parent integrator, and recursively execute all integration
     // callbacks registered with the parent and child integrators.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): integrating hierarchy\n";
+    startTelemetryPhase("integrate");
     for (int cycle_num = 0; cycle_num < d_current_num_cycles; ++cycle_num)
     {
         if (d_enable_logging && d_current_num_cycles != 1)
@@ -349,12 +425,15 @@ void HierarchyIntegrator::advanceHierarchy(double dt)
         }
         integrateHierarchy(current_time, new_time, cycle_num);
     }
+    stopTelemetryPhase("integrate");
 
     // Execute the postprocessing method of the parent integrator, and
     // recursively execute all postprocessing callbacks registered with the
     // parent and child integrators.
     static const bool skip_synchronize_new_state_data = true;
+    startTelemetryPhase("postprocess");
     postprocessIntegrateHierarchy(current_time, new_time, skip_synchronize_new_state_data, d_current_num_cycles);
+    stopTelemetryPhase("postprocess");
 
     // Ensure that the current values of num_cycles, cycle_num, and dt are
     // reset.
@@ -372,11 +451,13 @@ void HierarchyIntegrator::advanceHierarchy(double dt)
 
     // Synchronize the updated data.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): synchronizing updated data\n";
+    startTelemetryPhase("synchronize");
     synchronizeHierarchyData(NEW_DATA);
 
     // Reset all time dependent data.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): resetting time dependent data\n";
     resetTimeDependentHierarchyData(new_time);
+    stopTelemetryPhase("synchronize");
 
     // Reset the regrid indicator.
     d_at_regrid_time_step = false;
@@ -980,6 +1061,20 @@ void HierarchyIntegrator::putToDatabase(Pointer<Database> db)
     return;
 } // putToDatabase
 
+Pointer<PerformanceTelemetry> HierarchyIntegrator::getPerformanceTelemetry() const
+{
+    const HierarchyIntegrator* integrator = this;
+    while (integrator->d_parent_integrator) integrator = integrator->d_parent_integrator;
+    return integrator->d_telemetry;
+} // getPerformanceTelemetry
+
+Pointer<WorkloadReport> HierarchyIntegrator::getWorkloadReport() const
+{
+    const HierarchyIntegrator* integrator = this;
+    while (integrator->d_parent_integrator) integrator = integrator->d_parent_integrator;
+    return integrator->d_workload_report;
+} // getWorkloadReport
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 double HierarchyIntegrator::getMinimumTimeStepSizeSpecialized()
@@ -1238,6 +1333,12 @@ void HierarchyIntegrator::registerVariable(int& current_idx,
     scratch_idx = var_db->registerVariableAndContext(variable, getScratchContext(), scratch_ghosts);
     d_scratch_data.setFlag(scratch_idx);
 
+    // Record the ownership of the patch data.
+    PatchDataMemoryManager* memory_manager = PatchDataMemoryManager::getManager();
+    memory_manager->registerPatchDataOwner(current_idx, d_object_name);
+    memory_manager->registerPatchDataOwner(new_idx, d_object_name);
+    memory_manager->registerPatchDataOwner(scratch_idx, d_object_name);
+
     // Get the data transfer operators.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
     Pointer<RefineOperator<NDIM> > refine_operator = grid_geom->lookupRefineOperator(variable, refine_name);
@@ -1279,6 +1380,7 @@ void HierarchyIntegrator::registerVariable(int& idx,
 
     // Setup the scratch context.
     idx = var_db->registerVariableAndContext(variable, ctx, ghosts);
+    PatchDataMemoryManager::getManager()->registerPatchDataOwner(idx, d_object_name);
     if (*ctx == *getCurrentContext())
     {
         d_current_data.setFlag(idx);
@@ -1447,6 +1549,41 @@ void HierarchyIntegrator::setupTagBuffer(Pointer<GriddingAlgorithm<NDIM> > gridd
     return;
 } // setupTagBuffer
 
+void HierarchyIntegrator::registerTelemetryPhase(const std::string& phase_name)
+{
+    Pointer<PerformanceTelemetry> telemetry = getPerformanceTelemetry();
+    if (telemetry) telemetry->registerPhase(phase_name);
+    return;
+} // registerTelemetryPhase
+
+void HierarchyIntegrator::registerTelemetryCounter(const std::string& counter_name)
+{
+    Pointer<PerformanceTelemetry> telemetry = getPerformanceTelemetry();
+    if (telemetry) telemetry->registerCounter(counter_name);
+    return;
+} // registerTelemetryCounter
+
+void HierarchyIntegrator::startTelemetryPhase(const std::string& phase_name)
+{
+    Pointer<PerformanceTelemetry> telemetry = getPerformanceTelemetry();
+    if (telemetry) telemetry->startPhase(phase_name);
+    return;
+} // startTelemetryPhase
+
+void HierarchyIntegrator::stopTelemetryPhase(const std::string& phase_name)
+{
+    Pointer<PerformanceTelemetry> telemetry = getPerformanceTelemetry();
+    if (telemetry) telemetry->stopPhase(phase_name);
+    return;
+} // stopTelemetryPhase
+
+void HierarchyIntegrator::addTelemetryCount(const std::string& counter_name, const double value)
+{
+    Pointer<PerformanceTelemetry> telemetry = getPerformanceTelemetry();
+    if (telemetry) telemetry->addCount(counter_name, value);
+    return;
+} // addTelemetryCount
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
@@ -1468,6 +1605,11 @@ void HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restar
     if (db->keyExists("regrid_interval")) d_regrid_interval = db->getInteger("regrid_interval");
     if (db->keyExists("regrid_mode")) d_regrid_mode = string_to_enum<RegridMode>(db->getString("regrid_mode"));
     if (db->keyExists("enable_logging")) d_enable_logging = db->getBool("enable_logging");
+    if (db->keyExists("enable_telemetry")) d_enable_telemetry = db->getBool("enable_telemetry");
+    if (db->isDatabase("telemetry_db")) d_telemetry_db = db->getDatabase("telemetry_db");
+    if (db->keyExists("enable_workload_report")) d_enable_workload_report = db->getBool("enable_workload_report");
+    if (db->isDatabase("workload_report_db")) d_workload_report_db = db->getDatabase("workload_report_db");
+    if (db->keyExists("enable_memory_report")) d_enable_memory_report = db->getBool("enable_memory_report");
     if (db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = db->getString("bdry_extrap_type");
     if (db->keyExists("tag_buffer")) d_tag_buffer = db->getIntegerArray("tag_buffer");
     return;
@@ -0,0 +1,385 @@
+// Filename: PatchDataMemoryManager.cpp
+// Created on 18 Oct 2026 by agent
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include "Box.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "Variable.h"
+#include "VariableContext.h"
+#include "VariableDatabase.h"
+#include "ibtk/PatchDataMemoryManager.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Conversion factor from bytes to megabytes.
+static const double BYTES_PER_MB = 1024.0 * 1024.0;
+
+// Return the name of the variable context associated with a patch data index,
+// or an empty string if the index is not associated with a context (e.g.,
+// because it was obtained by cloning another patch data index).
+std::string getContextName(const int data_idx)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > var;
+    Pointer<VariableContext> ctx;
+    if (!var_db->mapIndexToVariableAndContext(data_idx, var, ctx) || !ctx) return "";
+    return ctx->getName();
+} // getContextName
+
+// Return the owner prefix of the name of a variable context.
+std::string getContextOwner(const std::string& ctx_name)
+{
+    const std::string::size_type pos = ctx_name.rfind("::");
+    return pos == std::string::npos ? ctx_name : ctx_name.substr(0, pos);
+} // getContextOwner
+
+// Return the name of the variable context associated with a patch data index,
+// with the owner prefix (if any) removed.
+std::string getContextLabel(const int data_idx)
+{
+    const std::string ctx_name = getContextName(data_idx);
+    if (ctx_name.empty()) return "(cloned)";
+    const std::string::size_type pos = ctx_name.rfind("::");
+    return pos == std::string::npos ? ctx_name : ctx_name.substr(pos + 2);
+} // getContextLabel
+
+// Return the name of the variable associated with a patch data index.
+std::string getVariableName(const int data_idx)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > var;
+    if (var_db->mapIndexToVariable(data_idx, var) && var) return var->getName();
+    return var_db->getPatchDescriptor()->mapIndexToName(data_idx);
+} // getVariableName
+}
+
+PatchDataMemoryManager* PatchDataMemoryManager::s_data_manager_instance = NULL;
+bool PatchDataMemoryManager::s_registered_callback = false;
+unsigned char PatchDataMemoryManager::s_shutdown_priority = 200;
+
+PatchDataMemoryManager* PatchDataMemoryManager::getManager()
+{
+    if (!s_data_manager_instance)
+    {
+        s_data_manager_instance = new PatchDataMemoryManager();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freeManager, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_data_manager_instance;
+} // getManager
+
+void PatchDataMemoryManager::freeManager()
+{
+    delete s_data_manager_instance;
+    s_data_manager_instance = NULL;
+    return;
+} // freeManager
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void PatchDataMemoryManager::registerPatchDataOwner(const int data_idx, const std::string& owner_name)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(data_idx >= 0);
+#endif
+    d_owner_names[data_idx] = owner_name;
+    return;
+} // registerPatchDataOwner
+
+void PatchDataMemoryManager::unregisterPatchDataOwner(const int data_idx)
+{
+    d_owner_names.erase(data_idx);
+    return;
+} // unregisterPatchDataOwner
+
+std::string PatchDataMemoryManager::getPatchDataOwner(const int data_idx) const
+{
+    std::map<int, std::string>::const_iterator it = d_owner_names.find(data_idx);
+    if (it != d_owner_names.end()) return it->second;
+    const std::string ctx_name = getContextName(data_idx);
+    if (!ctx_name.empty()) return getContextOwner(ctx_name);
+
+    // Indices obtained by cloning another patch data index (e.g., the vectors
+    // cloned by Krylov solvers) share the variable of the cloned index but are
+    // not associated with a context.  Such indices are attributed to the owner
+    // of another index of the same variable.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > var;
+    if (!var_db->mapIndexToVariable(data_idx, var) || !var) return "(unknown)";
+    const int num_data_idxs = var_db->getPatchDescriptor()->getMaxNumberRegisteredComponents();
+    for (int idx = 0; idx < num_data_idxs; ++idx)
+    {
+        Pointer<Variable<NDIM> > idx_var;
+        if (idx == data_idx || !var_db->mapIndexToVariable(idx, idx_var) || idx_var.getPointer() != var.getPointer())
+        {
+            continue;
+        }
+        it = d_owner_names.find(idx);
+        if (it != d_owner_names.end()) return it->second;
+        const std::string idx_ctx_name = getContextName(idx);
+        if (!idx_ctx_name.empty()) return getContextOwner(idx_ctx_name);
+    }
+    return "(unknown)";
+} // getPatchDataOwner
+
+void PatchDataMemoryManager::computeMemoryUsage(Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+#endif
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = VariableDatabase<NDIM>::getDatabase()->getPatchDescriptor();
+    d_num_data_idxs = patch_descriptor->getMaxNumberRegisteredComponents();
+    d_num_levels = hierarchy->getNumberOfLevels();
+    std::vector<Pointer<PatchDataFactory<NDIM> > > factories(d_num_data_idxs);
+    for (int data_idx = 0; data_idx < d_num_data_idxs; ++data_idx)
+    {
+        factories[data_idx] = patch_descriptor->getPatchDataFactory(data_idx);
+    }
+
+    // The values for each patch data index on each level are followed by the
+    // total for each level and by the total over all levels, so that the
+    // largest per-process totals can be computed by the same reduction.
+    const int level_offset = d_num_data_idxs * d_num_levels;
+    const int total_offset = level_offset + d_num_levels;
+    std::vector<double> local_bytes(total_offset + 1, 0.0);
+    for (int ln = 0; ln < d_num_levels; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            for (int data_idx = 0; data_idx < d_num_data_idxs; ++data_idx)
+            {
+                if (!factories[data_idx] || !patch->checkAllocated(data_idx)) continue;
+                const double bytes = static_cast<double>(factories[data_idx]->getSizeOfMemory(patch_box));
+                local_bytes[data_idx * d_num_levels + ln] += bytes;
+                local_bytes[level_offset + ln] += bytes;
+                local_bytes[total_offset] += bytes;
+            }
+        }
+    }
+    d_total_bytes = local_bytes;
+    d_max_bytes = local_bytes;
+    SAMRAI_MPI::sumReduction(&d_total_bytes[0], static_cast<int>(d_total_bytes.size()));
+    SAMRAI_MPI::maxReduction(&d_max_bytes[0], static_cast<int>(d_max_bytes.size()));
+
+    // Update the high-water marks.
+    d_high_water_bytes.resize(std::max(static_cast<int>(d_high_water_bytes.size()), d_num_data_idxs), 0.0);
+    for (int data_idx = 0; data_idx < d_num_data_idxs; ++data_idx)
+    {
+        d_high_water_bytes[data_idx] = std::max(d_high_water_bytes[data_idx], getAllocatedBytes(data_idx));
+    }
+
+    // Determine the range of peak resident set sizes.
+    const double peak_rss = getPeakResidentSetSize();
+    d_min_peak_rss = SAMRAI_MPI::minReduction(peak_rss);
+    d_max_peak_rss = SAMRAI_MPI::maxReduction(peak_rss);
+    d_mean_peak_rss = SAMRAI_MPI::sumReduction(peak_rss) / static_cast<double>(SAMRAI_MPI::getNodes());
+    return;
+} // computeMemoryUsage
+
+double PatchDataMemoryManager::getAllocatedBytes(const int data_idx, const int level_number) const
+{
+    if (data_idx < 0 || data_idx >= d_num_data_idxs || level_number >= d_num_levels) return 0.0;
+    if (level_number >= 0) return d_total_bytes[data_idx * d_num_levels + level_number];
+    double bytes = 0.0;
+    for (int ln = 0; ln < d_num_levels; ++ln)
+    {
+        bytes += d_total_bytes[data_idx * d_num_levels + ln];
+    }
+    return bytes;
+} // getAllocatedBytes
+
+double PatchDataMemoryManager::getAllocatedBytesForOwner(const std::string& owner_name) const
+{
+    double bytes = 0.0;
+    for (int data_idx = 0; data_idx < d_num_data_idxs; ++data_idx)
+    {
+        if (getPatchDataOwner(data_idx) == owner_name) bytes += getAllocatedBytes(data_idx);
+    }
+    return bytes;
+} // getAllocatedBytesForOwner
+
+double PatchDataMemoryManager::getAllocatedBytesForLevel(const int level_number) const
+{
+    if (level_number >= d_num_levels || d_total_bytes.empty()) return 0.0;
+    const int level_offset = d_num_data_idxs * d_num_levels;
+    if (level_number >= 0) return d_total_bytes[level_offset + level_number];
+    return d_total_bytes[level_offset + d_num_levels];
+} // getAllocatedBytesForLevel
+
+double PatchDataMemoryManager::getPeakResidentSetSize()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0.0;
+#if defined(__APPLE__)
+    // ru_maxrss is reported in bytes on OS X...
+    return static_cast<double>(usage.ru_maxrss);
+#else
+    // ...and in kilobytes on other systems.
+    return 1024.0 * static_cast<double>(usage.ru_maxrss);
+#endif
+#else
+    return 0.0;
+#endif
+} // getPeakResidentSetSize
+
+void PatchDataMemoryManager::printReport(std::ostream& os) const
+{
+    if (SAMRAI_MPI::getRank() != 0) return;
+    if (d_total_bytes.empty())
+    {
+        os << "PatchDataMemoryManager::printReport(): memory usage has not been computed\n";
+        return;
+    }
+
+    const int level_offset = d_num_data_idxs * d_num_levels;
+    const int total_offset = level_offset + d_num_levels;
+    os << std::fixed << std::setprecision(1);
+    os << "PatchDataMemoryManager::printReport(): patch data memory usage (MB)\n";
+    os << "  peak resident set size per process: min = " << d_min_peak_rss / BYTES_PER_MB
+       << ", max = " << d_max_peak_rss / BYTES_PER_MB << ", mean = " << d_mean_peak_rss / BYTES_PER_MB << "\n";
+    os << "  allocated patch data: total = " << d_total_bytes[total_offset] / BYTES_PER_MB
+       << ", max per process = " << d_max_bytes[total_offset] / BYTES_PER_MB << "\n";
+
+    // Report the data allocated on each level.
+    os << "  by level:\n";
+    for (int ln = 0; ln < d_num_levels; ++ln)
+    {
+        os << "    level " << std::setw(2) << ln << ": total = " << std::setw(10)
+           << d_total_bytes[level_offset + ln] / BYTES_PER_MB << ", max per process = " << std::setw(10)
+           << d_max_bytes[level_offset + ln] / BYTES_PER_MB << "\n";
+    }
+
+    // Report the data owned by each object, largest first.
+    std::map<std::string, double> owner_bytes;
+    std::vector<std::pair<double, int> > sorted_idxs;
+    for (int data_idx = 0; data_idx < d_num_data_idxs; ++data_idx)
+    {
+        const double bytes = getAllocatedBytes(data_idx);
+        if (bytes <= 0.0) continue;
+        owner_bytes[getPatchDataOwner(data_idx)] += bytes;
+        sorted_idxs.push_back(std::make_pair(-bytes, data_idx));
+    }
+    std::vector<std::pair<double, std::string> > sorted_owners;
+    for (std::map<std::string, double>::const_iterator it = owner_bytes.begin(); it != owner_bytes.end(); ++it)
+    {
+        sorted_owners.push_back(std::make_pair(-it->second, it->first));
+    }
+    std::sort(sorted_owners.begin(), sorted_owners.end());
+    std::sort(sorted_idxs.begin(), sorted_idxs.end());
+    os << "  by owner:\n";
+    for (unsigned int k = 0; k < sorted_owners.size(); ++k)
+    {
+        os << "    " << std::setw(10) << -sorted_owners[k].first / BYTES_PER_MB << "  " << sorted_owners[k].second
+           << "\n";
+    }
+
+    // Report the data allocated for each patch data index, largest first.
+    os << "  by patch data index:\n";
+    os << "    " << std::setw(5) << "index" << std::setw(12) << "total" << std::setw(12) << "max/proc" << std::setw(12)
+       << "high-water"
+       << "  variable (owner, context)\n";
+    for (unsigned int k = 0; k < sorted_idxs.size(); ++k)
+    {
+        const int data_idx = sorted_idxs[k].second;
+        double max_bytes = 0.0;
+        for (int ln = 0; ln < d_num_levels; ++ln)
+        {
+            max_bytes = std::max(max_bytes, d_max_bytes[data_idx * d_num_levels + ln]);
+        }
+        os << "    " << std::setw(5) << data_idx << std::setw(12) << -sorted_idxs[k].first / BYTES_PER_MB
+           << std::setw(12) << max_bytes / BYTES_PER_MB << std::setw(12) << d_high_water_bytes[data_idx] / BYTES_PER_MB
+           << "  " << getVariableName(data_idx) << " (" << getPatchDataOwner(data_idx) << ", "
+           << getContextLabel(data_idx) << ")\n";
+    }
+    os.unsetf(std::ios_base::floatfield);
+    os << std::setprecision(6);
+    return;
+} // printReport
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+PatchDataMemoryManager::PatchDataMemoryManager()
+    : d_owner_names(), d_num_data_idxs(0), d_num_levels(0), d_total_bytes(), d_max_bytes(), d_high_water_bytes(),
+      d_min_peak_rss(0.0), d_max_peak_rss(0.0), d_mean_peak_rss(0.0)
+{
+    // intentionally blank
+    return;
+} // PatchDataMemoryManager
+
+PatchDataMemoryManager::~PatchDataMemoryManager()
+{
+    // intentionally blank
+    return;
+} // ~PatchDataMemoryManager
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
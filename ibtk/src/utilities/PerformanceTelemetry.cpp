@@ -0,0 +1,379 @@
+// Filename: PerformanceTelemetry.cpp
+// Created on 18 Oct 2026 by agent
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibtk/PerformanceTelemetry.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Database.h"
+#include "tbox/MathUtilities.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Name of the phase that records the total wall-clock time of each time step.
+static const std::string TOTAL_PHASE_NAME = "total";
+
+// Reduction operation that computes the minimum, maximum, and sum of triples
+// of values.
+void minMaxSumReduction(void* in_vec, void* inout_vec, int* len, MPI_Datatype* /*datatype*/)
+{
+    const double* in = static_cast<const double*>(in_vec);
+    double* inout = static_cast<double*>(inout_vec);
+    for (int k = 0; k < *len; ++k, in += 3, inout += 3)
+    {
+        inout[0] = std::min(inout[0], in[0]);
+        inout[1] = std::max(inout[1], in[1]);
+        inout[2] += in[2];
+    }
+    return;
+} // minMaxSumReduction
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PerformanceTelemetry::PerformanceTelemetry(const std::string& object_name, Pointer<Database> input_db)
+    : d_object_name(object_name), d_flush_interval(10), d_file_name("telemetry.csv"), d_use_json(false), d_names(),
+      d_is_phase(), d_value_idxs(), d_phase_start_times(), d_values_are_frozen(false), d_step_is_open(false),
+      d_step_num(-1), d_step_time(std::numeric_limits<double>::quiet_NaN()),
+      d_step_dt(std::numeric_limits<double>::quiet_NaN()), d_step_values(), d_buffered_step_nums(),
+      d_buffered_step_times(), d_buffered_step_dts(), d_buffered_values(), d_accumulated_values(),
+      d_output_stream()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!object_name.empty());
+#endif
+    if (input_db)
+    {
+        if (input_db->keyExists("flush_interval")) d_flush_interval = input_db->getInteger("flush_interval");
+        if (input_db->keyExists("file_name")) d_file_name = input_db->getString("file_name");
+        if (input_db->keyExists("format"))
+        {
+            const std::string format = input_db->getString("format");
+            if (format == "CSV")
+            {
+                d_use_json = false;
+            }
+            else if (format == "JSON")
+            {
+                d_use_json = true;
+            }
+            else
+            {
+                TBOX_ERROR(d_object_name << "::PerformanceTelemetry():\n"
+                                         << "  unsupported telemetry format: " << format << "\n"
+                                         << "  supported formats are: CSV, JSON" << std::endl);
+            }
+        }
+    }
+    if (d_flush_interval < 1)
+    {
+        TBOX_ERROR(d_object_name << "::PerformanceTelemetry():\n"
+                                 << "  flush_interval must be positive" << std::endl);
+    }
+    registerPhase(TOTAL_PHASE_NAME);
+    return;
+} // PerformanceTelemetry
+
+PerformanceTelemetry::~PerformanceTelemetry()
+{
+    int mpi_is_finalized = 0;
+    MPI_Finalized(&mpi_is_finalized);
+    if (!mpi_is_finalized) flush();
+    if (d_output_stream.is_open()) d_output_stream.close();
+    return;
+} // ~PerformanceTelemetry
+
+void PerformanceTelemetry::registerPhase(const std::string& phase_name)
+{
+    registerValue(phase_name, /*is_phase*/ true);
+    return;
+} // registerPhase
+
+void PerformanceTelemetry::registerCounter(const std::string& counter_name)
+{
+    registerValue(counter_name, /*is_phase*/ false);
+    return;
+} // registerCounter
+
+void PerformanceTelemetry::beginStep(const int step_num, const double time, const double dt)
+{
+    endStep();
+    d_step_is_open = true;
+    d_step_num = step_num;
+    d_step_time = time;
+    d_step_dt = dt;
+    d_step_values.assign(d_names.size(), 0.0);
+    d_phase_start_times.assign(d_names.size(), std::numeric_limits<double>::quiet_NaN());
+    startPhase(TOTAL_PHASE_NAME);
+    return;
+} // beginStep
+
+void PerformanceTelemetry::startPhase(const std::string& phase_name)
+{
+    if (!d_step_is_open) return;
+    const int idx = getValueIndex(phase_name, /*is_phase*/ true);
+    d_phase_start_times[idx] = MPI_Wtime();
+    return;
+} // startPhase
+
+void PerformanceTelemetry::stopPhase(const std::string& phase_name)
+{
+    if (!d_step_is_open) return;
+    const int idx = getValueIndex(phase_name, /*is_phase*/ true);
+    if (MathUtilities<double>::isNaN(d_phase_start_times[idx]))
+    {
+        TBOX_ERROR(d_object_name << "::stopPhase():\n"
+                                 << "  phase " << phase_name << " has not been started" << std::endl);
+    }
+    d_step_values[idx] += MPI_Wtime() - d_phase_start_times[idx];
+    d_phase_start_times[idx] = std::numeric_limits<double>::quiet_NaN();
+    return;
+} // stopPhase
+
+void PerformanceTelemetry::addCount(const std::string& counter_name, const double value)
+{
+    if (!d_step_is_open) return;
+    const int idx = getValueIndex(counter_name, /*is_phase*/ false);
+    d_step_values[idx] += value;
+    return;
+} // addCount
+
+void PerformanceTelemetry::flush()
+{
+    endStep();
+    d_values_are_frozen = true;
+    const int num_steps = static_cast<int>(d_buffered_step_nums.size());
+    if (num_steps == 0) return;
+
+    // Reduce the minimum, maximum, and sum of all buffered values over all
+    // processes in a single reduction.
+    const int num_values = static_cast<int>(d_buffered_values.size());
+    std::vector<double> local_values(3 * num_values), reduced_values(3 * num_values);
+    for (int k = 0; k < num_values; ++k)
+    {
+        local_values[3 * k] = d_buffered_values[k];
+        local_values[3 * k + 1] = d_buffered_values[k];
+        local_values[3 * k + 2] = d_buffered_values[k];
+    }
+    if (num_values > 0)
+    {
+        MPI_Datatype triple_type;
+        MPI_Type_contiguous(3, MPI_DOUBLE, &triple_type);
+        MPI_Type_commit(&triple_type);
+        MPI_Op min_max_sum_op;
+        MPI_Op_create(&minMaxSumReduction, /*commute*/ 1, &min_max_sum_op);
+        MPI_Reduce(&local_values[0],
+                   &reduced_values[0],
+                   num_values,
+                   triple_type,
+                   min_max_sum_op,
+                   0,
+                   SAMRAI_MPI::getCommunicator());
+        MPI_Op_free(&min_max_sum_op);
+        MPI_Type_free(&triple_type);
+    }
+    if (SAMRAI_MPI::getRank() == 0) writeData(reduced_values);
+
+    d_buffered_step_nums.clear();
+    d_buffered_step_times.clear();
+    d_buffered_step_dts.clear();
+    d_buffered_values.clear();
+    return;
+} // flush
+
+void PerformanceTelemetry::getAccumulatedPhaseTimes(std::vector<std::string>& phase_names,
+                                                    std::vector<double>& phase_times) const
+{
+    phase_names.clear();
+    phase_times.clear();
+    for (unsigned int k = 0; k < d_names.size(); ++k)
+    {
+        if (!d_is_phase[k]) continue;
+        phase_names.push_back(d_names[k]);
+        phase_times.push_back(k < d_accumulated_values.size() ? d_accumulated_values[k] : 0.0);
+    }
+    return;
+} // getAccumulatedPhaseTimes
+
+void PerformanceTelemetry::resetAccumulatedValues()
+{
+    d_accumulated_values.assign(d_names.size(), 0.0);
+    return;
+} // resetAccumulatedValues
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void PerformanceTelemetry::registerValue(const std::string& name, const bool is_phase)
+{
+    std::map<std::string, int>::const_iterator it = d_value_idxs.find(name);
+    if (it != d_value_idxs.end())
+    {
+        if (d_is_phase[it->second] != is_phase)
+        {
+            TBOX_ERROR(d_object_name << "::registerValue():\n"
+                                     << "  " << name << " is registered as both a phase and a counter" << std::endl);
+        }
+        return;
+    }
+    if (d_values_are_frozen)
+    {
+        TBOX_ERROR(d_object_name << "::registerValue():\n"
+                                 << "  " << name << " must be registered before telemetry data are first written"
+                                 << std::endl);
+    }
+    d_value_idxs[name] = static_cast<int>(d_names.size());
+    d_names.push_back(name);
+    d_is_phase.push_back(is_phase);
+    if (d_step_is_open)
+    {
+        d_step_values.push_back(0.0);
+        d_phase_start_times.push_back(std::numeric_limits<double>::quiet_NaN());
+    }
+    return;
+} // registerValue
+
+int PerformanceTelemetry::getValueIndex(const std::string& name, const bool is_phase) const
+{
+    std::map<std::string, int>::const_iterator it = d_value_idxs.find(name);
+    if (it == d_value_idxs.end() || d_is_phase[it->second] != is_phase)
+    {
+        TBOX_ERROR(d_object_name << "::getValueIndex():\n"
+                                 << "  " << (is_phase ? "phase " : "counter ") << name << " is not registered"
+                                 << std::endl);
+    }
+    return it->second;
+} // getValueIndex
+
+void PerformanceTelemetry::endStep()
+{
+    if (!d_step_is_open) return;
+    stopPhase(TOTAL_PHASE_NAME);
+    d_step_is_open = false;
+    d_values_are_frozen = true;
+    d_buffered_step_nums.push_back(d_step_num);
+    d_buffered_step_times.push_back(d_step_time);
+    d_buffered_step_dts.push_back(d_step_dt);
+    d_buffered_values.insert(d_buffered_values.end(), d_step_values.begin(), d_step_values.end());
+    d_accumulated_values.resize(d_names.size(), 0.0);
+    for (unsigned int k = 0; k < d_names.size(); ++k) d_accumulated_values[k] += d_step_values[k];
+    if (static_cast<int>(d_buffered_step_nums.size()) >= d_flush_interval) flush();
+    return;
+} // endStep
+
+void PerformanceTelemetry::writeData(const std::vector<double>& reduced_values)
+{
+    const double num_procs = static_cast<double>(SAMRAI_MPI::getNodes());
+    const unsigned int num_names = d_names.size();
+    if (!d_output_stream.is_open())
+    {
+        d_output_stream.open(d_file_name.c_str(), std::ios::out);
+        if (!d_output_stream.is_open())
+        {
+            TBOX_ERROR(d_object_name << "::writeData():\n"
+                                     << "  could not open file " << d_file_name << " for writing" << std::endl);
+        }
+        d_output_stream.precision(8);
+        if (!d_use_json)
+        {
+            d_output_stream << "step,time,dt";
+            for (unsigned int k = 0; k < num_names; ++k)
+            {
+                d_output_stream << "," << d_names[k] << "_min," << d_names[k] << "_max," << d_names[k] << "_mean";
+            }
+            d_output_stream << "\n";
+        }
+    }
+    for (unsigned int s = 0; s < d_buffered_step_nums.size(); ++s)
+    {
+        const double* const vals = &reduced_values[3 * s * num_names];
+        if (d_use_json)
+        {
+            d_output_stream << "{\"step\":" << d_buffered_step_nums[s] << ",\"time\":" << d_buffered_step_times[s]
+                            << ",\"dt\":" << d_buffered_step_dts[s];
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                const bool write_phases = (pass == 0);
+                d_output_stream << ",\"" << (write_phases ? "phases" : "counters") << "\":{";
+                bool first = true;
+                for (unsigned int k = 0; k < num_names; ++k)
+                {
+                    if (d_is_phase[k] != write_phases) continue;
+                    if (!first) d_output_stream << ",";
+                    first = false;
+                    d_output_stream << "\"" << d_names[k] << "\":{\"min\":" << vals[3 * k]
+                                    << ",\"max\":" << vals[3 * k + 1] << ",\"mean\":" << vals[3 * k + 2] / num_procs
+                                    << "}";
+                }
+                d_output_stream << "}";
+            }
+            d_output_stream << "}\n";
+        }
+        else
+        {
+            d_output_stream << d_buffered_step_nums[s] << "," << d_buffered_step_times[s] << ","
+                            << d_buffered_step_dts[s];
+            for (unsigned int k = 0; k < num_names; ++k)
+            {
+                d_output_stream << "," << vals[3 * k] << "," << vals[3 * k + 1] << "," << vals[3 * k + 2] / num_procs;
+            }
+            d_output_stream << "\n";
+        }
+    }
+    d_output_stream.flush();
+    return;
+} // writeData
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,331 @@
+// Filename: WorkloadReport.cpp
+// Created on 18 Oct 2026 by agent
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "CellData.h"
+#include "CellIndex.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
+#include "ibtk/WorkloadReport.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Width of the quantity name column of the report.
+static const int NAME_WIDTH = 36;
+
+// Width of the numerical columns of the report.
+static const int VALUE_WIDTH = 14;
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+WorkloadReport::WorkloadReport(const std::string& object_name, Pointer<Database> input_db)
+    : d_object_name(object_name), d_num_histogram_bins(10), d_write_patch_workload_map(false),
+      d_patch_workload_map_file_name("workload"), d_level_counts(), d_phase_times(), d_workload_data_idx(-1)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!object_name.empty());
+#endif
+    if (input_db)
+    {
+        if (input_db->keyExists("num_histogram_bins"))
+            d_num_histogram_bins = input_db->getInteger("num_histogram_bins");
+        if (input_db->keyExists("write_patch_workload_map"))
+            d_write_patch_workload_map = input_db->getBool("write_patch_workload_map");
+        if (input_db->keyExists("patch_workload_map_file_name"))
+            d_patch_workload_map_file_name = input_db->getString("patch_workload_map_file_name");
+    }
+    if (d_num_histogram_bins < 1)
+    {
+        TBOX_ERROR(d_object_name << "::WorkloadReport():\n"
+                                 << "  num_histogram_bins must be positive" << std::endl);
+    }
+    return;
+} // WorkloadReport
+
+WorkloadReport::~WorkloadReport()
+{
+    // intentionally blank
+    return;
+} // ~WorkloadReport
+
+void WorkloadReport::addLevelCount(const std::string& count_name, const int level_number, const double local_count)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number >= 0);
+#endif
+    std::vector<double>& counts = d_level_counts[count_name];
+    if (static_cast<int>(counts.size()) <= level_number) counts.resize(level_number + 1, 0.0);
+    counts[level_number] += local_count;
+    return;
+} // addLevelCount
+
+void WorkloadReport::addPhaseTime(const std::string& phase_name, const double local_time)
+{
+    d_phase_times.push_back(std::make_pair(phase_name, local_time));
+    return;
+} // addPhaseTime
+
+void WorkloadReport::setWorkloadDataIndex(const int workload_data_idx)
+{
+    d_workload_data_idx = workload_data_idx;
+    return;
+} // setWorkloadDataIndex
+
+void WorkloadReport::generateReport(Pointer<PatchHierarchy<NDIM> > hierarchy, const int step_num, const double time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+#endif
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+
+    // Count the local cells, patches, and workload on each level.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        double num_local_cells = 0.0, num_local_patches = 0.0, local_workload = 0.0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            num_local_cells += static_cast<double>(patch_box.size());
+            num_local_patches += 1.0;
+            if (d_workload_data_idx != -1)
+            {
+                Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(d_workload_data_idx);
+                for (Box<NDIM>::Iterator b(patch_box); b; b++)
+                {
+                    local_workload += (*workload_data)(b());
+                }
+            }
+        }
+        addLevelCount("cells", ln, num_local_cells);
+        addLevelCount("patches", ln, num_local_patches);
+        if (d_workload_data_idx != -1) addLevelCount("workload", ln, local_workload);
+    }
+
+    // Setup the names and local values of all reported quantities.  Per-level
+    // counts are reported on each level and in total.
+    std::vector<std::string> names;
+    std::vector<double> local_values;
+    for (std::map<std::string, std::vector<double> >::iterator it = d_level_counts.begin();
+         it != d_level_counts.end();
+         ++it)
+    {
+        std::vector<double>& counts = it->second;
+        counts.resize(finest_ln + 1, 0.0);
+        double total = 0.0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            std::ostringstream name;
+            name << it->first << " (level " << ln << ")";
+            names.push_back(name.str());
+            local_values.push_back(counts[ln]);
+            total += counts[ln];
+        }
+        names.push_back(it->first + " (total)");
+        local_values.push_back(total);
+    }
+    for (unsigned int k = 0; k < d_phase_times.size(); ++k)
+    {
+        names.push_back(d_phase_times[k].first + " time");
+        local_values.push_back(d_phase_times[k].second);
+    }
+
+    // Gather the values from all processes.
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int mpi_nodes = SAMRAI_MPI::getNodes();
+    const int num_values = static_cast<int>(local_values.size());
+    std::vector<double> values(mpi_rank == 0 ? mpi_nodes * num_values : 1);
+    MPI_Gather(&local_values[0],
+               num_values,
+               MPI_DOUBLE,
+               &values[0],
+               num_values,
+               MPI_DOUBLE,
+               0,
+               SAMRAI_MPI::getCommunicator());
+
+    // Report the statistics of each quantity.
+    if (mpi_rank == 0)
+    {
+        plog << d_object_name << "::generateReport(): workload distribution at step " << step_num
+             << ", time = " << time << ", on " << mpi_nodes << " processes\n";
+        plog << "  " << std::left << std::setw(NAME_WIDTH) << "quantity" << std::right << std::setw(VALUE_WIDTH)
+             << "min" << std::setw(VALUE_WIDTH) << "max" << std::setw(VALUE_WIDTH) << "mean"
+             << std::setw(VALUE_WIDTH) << "max/mean"
+             << "  histogram (" << d_num_histogram_bins << " bins from min to max)\n";
+        for (int k = 0; k < num_values; ++k)
+        {
+            double min_val = values[k], max_val = values[k], sum_val = 0.0;
+            for (int r = 0; r < mpi_nodes; ++r)
+            {
+                const double val = values[r * num_values + k];
+                min_val = std::min(min_val, val);
+                max_val = std::max(max_val, val);
+                sum_val += val;
+            }
+            const double mean_val = sum_val / static_cast<double>(mpi_nodes);
+            const double imbalance = (mean_val > 0.0 ? max_val / mean_val : 1.0);
+            std::vector<int> histogram(d_num_histogram_bins, 0);
+            for (int r = 0; r < mpi_nodes; ++r)
+            {
+                const double val = values[r * num_values + k];
+                int bin = 0;
+                if (max_val > min_val)
+                {
+                    bin = static_cast<int>(static_cast<double>(d_num_histogram_bins) * (val - min_val) /
+                                           (max_val - min_val));
+                    bin = std::min(bin, d_num_histogram_bins - 1);
+                }
+                ++histogram[bin];
+            }
+            plog << "  " << std::left << std::setw(NAME_WIDTH) << names[k] << std::right << std::setw(VALUE_WIDTH)
+                 << min_val << std::setw(VALUE_WIDTH) << max_val << std::setw(VALUE_WIDTH) << mean_val
+                 << std::setw(VALUE_WIDTH) << imbalance << " ";
+            for (int b = 0; b < d_num_histogram_bins; ++b) plog << " " << histogram[b];
+            plog << "\n";
+        }
+    }
+
+    // Optionally write the per-patch workload map.
+    if (d_write_patch_workload_map) writePatchWorkloadMap(hierarchy, step_num);
+
+    // Reset the data for the next report.
+    d_level_counts.clear();
+    d_phase_times.clear();
+    d_workload_data_idx = -1;
+    return;
+} // generateReport
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void WorkloadReport::writePatchWorkloadMap(Pointer<PatchHierarchy<NDIM> > hierarchy, const int step_num)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+
+    // Determine the total workload of each patch.  The patch boxes and their
+    // assignments to processes are known on all processes, so only the
+    // workloads need to be communicated.
+    std::vector<int> level_offsets(finest_ln + 2, 0);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        level_offsets[ln + 1] = level_offsets[ln] + hierarchy->getPatchLevel(ln)->getNumberOfPatches();
+    }
+    std::vector<double> patch_workloads(level_offsets[finest_ln + 1], 0.0);
+    if (d_workload_data_idx != -1 && !patch_workloads.empty())
+    {
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(d_workload_data_idx);
+                double& patch_workload = patch_workloads[level_offsets[ln] + p()];
+                for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+                {
+                    patch_workload += (*workload_data)(b());
+                }
+            }
+        }
+        SAMRAI_MPI::sumReduction(&patch_workloads[0], static_cast<int>(patch_workloads.size()));
+    }
+    if (SAMRAI_MPI::getRank() != 0) return;
+
+    std::ostringstream file_name;
+    file_name << d_patch_workload_map_file_name << "." << std::setw(6) << std::setfill('0') << step_num << ".csv";
+    std::ofstream file_stream(file_name.str().c_str(), std::ios::out);
+    if (!file_stream.is_open())
+    {
+        TBOX_ERROR(d_object_name << "::writePatchWorkloadMap():\n"
+                                 << "  could not open file " << file_name.str() << " for writing" << std::endl);
+    }
+    file_stream << "level,patch,rank";
+    for (unsigned int d = 0; d < NDIM; ++d) file_stream << ",lower_" << d;
+    for (unsigned int d = 0; d < NDIM; ++d) file_stream << ",upper_" << d;
+    file_stream << ",cells" << (d_workload_data_idx != -1 ? ",workload" : "") << "\n";
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& boxes = level->getBoxes();
+        const ProcessorMapping& mapping = level->getProcessorMapping();
+        for (int p = 0; p < level->getNumberOfPatches(); ++p)
+        {
+            const Box<NDIM>& box = boxes[p];
+            file_stream << ln << "," << p << "," << mapping.getProcessorAssignment(p);
+            for (unsigned int d = 0; d < NDIM; ++d) file_stream << "," << box.lower()(d);
+            for (unsigned int d = 0; d < NDIM; ++d) file_stream << "," << box.upper()(d);
+            file_stream << "," << box.size();
+            if (d_workload_data_idx != -1) file_stream << "," << patch_workloads[level_offsets[ln] + p];
+            file_stream << "\n";
+        }
+    }
+    return;
+} // writePatchWorkloadMap
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -225,6 +225,81 @@ public:
     virtual void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
 protected:
+    /*!
+     * \brief Set the time-independent body-frame layout of the structure.
+     *
+     * The Lagrangian points of the structure are grouped into consecutive
+     * sections (e.g. cross sections of a swimmer).  All points of a section
+     * share a reference arc length, and each point has fixed body-frame
+     * coordinates relative to the reference point of its section.  The layout
+     * is cached so that the kinematics can be evaluated once per section and
+     * then applied to contiguous arrays of points at every time step.
+     *
+     * \param section_arc_length Reference arc length of each section.
+     *
+     * \param section_num_pts Number of Lagrangian points in each section.
+     *
+     * \param body_frame_coords Body-frame coordinates of all points, stored as
+     * one contiguous array per component.
+     */
+    void setBodyLayout(const std::vector<double>& section_arc_length,
+                       const std::vector<int>& section_num_pts,
+                       const std::vector<std::vector<double> >& body_frame_coords);
+
+    /*!
+     * \brief Get the number of sections of the cached body layout.
+     */
+    inline int getNumberOfSections() const
+    {
+        return static_cast<int>(d_section_arc_length.size());
+    } // getNumberOfSections
+
+    /*!
+     * \brief Get the reference arc length of each section.
+     */
+    inline const std::vector<double>& getSectionArcLength() const
+    {
+        return d_section_arc_length;
+    } // getSectionArcLength
+
+    /*!
+     * \brief Get the offset of the first point of each section.  The last
+     * entry is the total number of points in the layout.
+     */
+    inline const std::vector<int>& getSectionOffsets() const
+    {
+        return d_section_offsets;
+    } // getSectionOffsets
+
+    /*!
+     * \brief Get the body-frame coordinates of the points of the layout.
+     */
+    inline const std::vector<std::vector<double> >& getBodyFrameCoordinates() const
+    {
+        return d_body_frame_coords;
+    } // getBodyFrameCoordinates
+
+    /*!
+     * \brief Set point_data[d][i] = section_data[d][k] for all points i in
+     * section k.
+     */
+    void spreadSectionData(const std::vector<std::vector<double> >& section_data,
+                           std::vector<std::vector<double> >& point_data) const;
+
+    /*!
+     * \brief Set shape[d][i] = section_origin[d][k] + X_body[d][i] for all
+     * points i in section k, in which X_body are the body-frame coordinates of
+     * the cached layout.
+     */
+    void setShapeFromSections(const std::vector<std::vector<double> >& section_origin,
+                              std::vector<std::vector<double> >& shape) const;
+
+    /*!
+     * \brief Shift the shape so that its center of mass is at the origin and
+     * rotate it by the given angle about the z axis.
+     */
+    void centerAndRotateShape(std::vector<std::vector<double> >& shape, double angle) const;
+
     /*!
      * Name of the object.
      */
@@ -255,6 +330,13 @@ private:
      * \brief Object enclosing all the parameters of the structure.
      */
     StructureParameters d_struct_param;
+
+    /*!
+     * \brief Cached body layout.
+     */
+    std::vector<double> d_section_arc_length;
+    std::vector<int> d_section_offsets;
+    std::vector<std::vector<double> > d_body_frame_coords;
 };
 } // namespace IBAMR
 
@@ -228,10 +228,11 @@ private:
     void calculateKinematicsVelocity();
 
     /*!
-     * \brief Calculate momentum of kinematics velocity. This is extraneous momentum
-     * that needs to be subtracted from the kinematics velocity.
+     * \brief Calculate momentum of kinematics velocity of all self-translating
+     * structures. This is extraneous momentum that needs to be subtracted from
+     * the kinematics velocity.
      */
-    void calculateMomentumOfKinematicsVelocity(const int position_handle);
+    void calculateMomentumOfKinematicsVelocity();
 
     /*!
      * \brief Calculate volume element associated with material points.
@@ -268,15 +269,21 @@ private:
     void interpolateFluidSolveVelocity();
 
     /*!
-     * \brief Calculate the rigid translational velocity.
+     * \brief Accumulate the local part of the rigid translational momentum.
      */
     void calculateRigidTranslationalMomentum();
 
     /*!
-     * \brief Calculate the rigid rotational velocity.
+     * \brief Accumulate the local part of the rigid rotational momentum.
      */
     void calculateRigidRotationalMomentum();
 
+    /*!
+     * \brief Sum the rigid momenta over all processors and compute the rigid
+     * translational and rotational velocities.
+     */
+    void finalizeRigidMomentum();
+
     /*!
      * \brief Calculate current velocity on the material points.
      */
@@ -315,19 +322,30 @@ private:
     void calculateMidPointVelocity();
 
     /*!
-     * \brief Calculate hydrodynamic drag on the immersed structures.
+     * \brief Calculate and output the requested drag, torque, and power
+     * diagnostics of all structures using a single reduction.
+     */
+    void calculateStructureDiagnostics();
+
+    /*!
+     * \brief Accumulate the local part of the hydrodynamic drag on the immersed
+     * structures.
      */
-    void calculateDrag();
+    void calculateDrag(std::vector<std::vector<double> >& inertia_force,
+                       std::vector<std::vector<double> >& constraint_force);
 
     /*!
-     * \brief Calculate hydrodynamic torque on the immersed structures.
+     * \brief Accumulate the local part of the hydrodynamic torque on the
+     * immersed structures.
      */
-    void calculateTorque();
+    void calculateTorque(std::vector<std::vector<double> >& inertia_torque,
+                         std::vector<std::vector<double> >& constraint_torque);
 
     /*!
-     * \brief Calculate power spent during swimming.
+     * \brief Accumulate the local part of the power spent during swimming.
      */
-    void calculatePower();
+    void calculatePower(std::vector<std::vector<double> >& inertia_power,
+                        std::vector<std::vector<double> >& constraint_power);
 
     /*!
      * \brief Calculate Eulerian Momentum.
@@ -70,6 +70,23 @@ namespace IBAMR
 /*!
  * \brief Class IBExplicitHierarchyIntegrator is an implementation of a formally
  * second-order accurate, semi-implicit version of the immersed boundary method.
+ *
+ * When the input database key \p num_lagrangian_substeps is set to a value
+ * k > 1 (and the midpoint rule is used), the Lagrangian structure is advanced in
+ * k substeps within each cycle of the time step, using velocities interpolated
+ * from a frozen Eulerian velocity field, and the time-averaged Lagrangian force
+ * is spread to the Eulerian grid once per cycle.  The first cycle uses the
+ * Eulerian velocity at the beginning of the time step; subsequent cycles use
+ * the midpoint approximation to the velocity obtained by the preceding cycle.
+ * See IBStrategy::computeSubcycledLagrangianForce().
+ *
+ * When the input database key \p overlap_lagrangian_force is set to TRUE, the
+ * Lagrangian forces that depend only on known positions (the force at the
+ * beginning of the time step and, when a single cycle is used, the force at the
+ * predicted midpoint or updated positions) are computed before the fluid solver
+ * is prepared to advance the data, and the communication required to spread
+ * those forces is overlapped with that preparation.  See
+ * IBStrategy::beginSpreadForce().
  */
 class IBExplicitHierarchyIntegrator : public IBHierarchyIntegrator
 {
@@ -163,6 +180,19 @@ private:
      * members.
      */
     void getFromRestart();
+
+    /*
+     * The number of substeps used to compute the time-averaged Lagrangian force
+     * in each time step.
+     */
+    int d_num_lagrangian_substeps;
+
+    /*
+     * Whether to compute the Lagrangian forces that depend only on known
+     * positions before preparing the fluid solver, and whether the force used
+     * in the current cycle has already been computed.
+     */
+    bool d_overlap_lagrangian_force, d_cycle_force_is_precomputed;
 };
 } // namespace IBAMR
 
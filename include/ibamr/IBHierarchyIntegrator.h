@@ -192,6 +192,16 @@ protected:
                           SAMRAI::tbox::Pointer<INSHierarchyIntegrator> ins_hier_integrator,
                           bool register_for_restart = true);
 
+    /*!
+     * Return the maximum stable time step size.
+     *
+     * When a Lagrangian CFL number is specified, the time step size is also
+     * limited by the Lagrangian CFL number times the stable time step size
+     * estimated by the IB method implementation object from the stiffness of
+     * the structure.
+     */
+    double getMaximumTimeStepSizeSpecialized();
+
     /*!
      * Function to determine whether regridding should occur at the current time
      * step.
@@ -266,6 +276,14 @@ protected:
      */
     double d_regrid_cfl_interval, d_regrid_cfl_estimate;
 
+    /*
+     * The Lagrangian CFL number limits the time step size to a multiple of the
+     * stable time step size of an explicit treatment of the elastic forces.  A
+     * non-positive value indicates that the time step size is not limited by
+     * the stiffness of the structure.
+     */
+    double d_lag_cfl_max;
+
     /*
      * IB method implementation object.
      */
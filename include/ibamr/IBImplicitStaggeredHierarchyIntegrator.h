@@ -81,6 +81,25 @@ namespace IBAMR
  * \brief Class IBImplicitStaggeredHierarchyIntegrator is an implementation of a
  * formally second-order accurate, nonlinearly-implicit version of the immersed
  * boundary method.
+ *
+ * The nonlinear and Schur complement solvers are reused from one time step to
+ * the next, and are recreated only when the patch hierarchy is regridded or the
+ * layout of the solution vectors changes.  The Lagrangian part of the
+ * nonlinear solve is initialized with the positions computed at the end of the
+ * previous time step.  The input database key \p jacobian_lag sets the number of nonlinear iterations between
+ * updates of the linearized Lagrangian operator used by both the Jacobian and
+ * the preconditioner (see SNESSetLagJacobian()).  Its value must be at least 1.
+ * The linearized operator is always updated at the first nonlinear iteration of
+ * each time step, because the linearization data are freed at the end of each
+ * time step.
+ *
+ * When the input database key \p use_schur_preconditioner is set to TRUE, the
+ * Lagrangian Schur complement solver is preconditioned by an assembled
+ * approximation to the Schur complement of the form I-beta*A, in which A is the
+ * assembled Jacobian of the Lagrangian force (see
+ * IBImplicitStrategy::getLinearizedForceJacobian()).  The approximation is
+ * updated whenever the Jacobian is updated, and the preconditioner type may be
+ * selected using the PETSc options prefix "ib_schur_".
  */
 class IBImplicitStaggeredHierarchyIntegrator : public IBHierarchyIntegrator
 {
@@ -140,6 +159,12 @@ public:
      */
     int getNumberOfCycles() const;
 
+    /*!
+     * Deallocate the nonlinear and linear solver objects and regrid the patch
+     * hierarchy.
+     */
+    void regridHierarchy();
+
 protected:
     /*!
      * Write out specialized object state to the given database.
@@ -182,6 +207,24 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * Create the nonlinear and linear solver objects, or reuse those created in
+     * a previous time step when the layout of the solution vectors has not
+     * changed.
+     */
+    void initializeSolvers(Vec composite_sol_petsc_vec, Vec lag_sol_petsc_vec);
+
+    /*!
+     * Deallocate the nonlinear and linear solver objects.
+     */
+    void deallocateSolvers();
+
+    /*!
+     * Update the assembled approximation to the Lagrangian Schur complement
+     * used to precondition the Schur complement solver.
+     */
+    void updateSchurPreconditioner(Vec X);
+
     /*!
      * Static function for implicit formulation.
      */
@@ -235,7 +278,12 @@ private:
 
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     SAMRAI::tbox::Pointer<StaggeredStokesOperator> d_stokes_op;
+    SNES d_snes;
+    Mat d_jac, d_schur;
     KSP d_schur_solver;
+    Mat d_schur_pc_mat;
+    bool d_use_schur_pc;
+    int d_jacobian_lag;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_u_scratch_vec, d_f_scratch_vec;
 };
 } // namespace IBAMR
@@ -38,6 +38,7 @@
 #include <vector>
 
 #include "ibamr/IBStrategy.h"
+#include "petscmat.h"
 #include "petscvec.h"
 
 namespace IBTK
@@ -140,6 +141,15 @@ public:
         const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
         double data_time) = 0;
 
+    /*!
+     * Return the Jacobian of the Lagrangian force, evaluated at the position
+     * most recently set by setLinearizedPosition(), in assembled form, or NULL
+     * if an assembled Jacobian is not available.
+     *
+     * A default implementation is provided that returns NULL.
+     */
+    virtual Mat getLinearizedForceJacobian();
+
 protected:
 private:
     /*!
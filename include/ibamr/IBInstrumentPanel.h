@@ -35,9 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
-#include <functional>
 #include <iosfwd>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -239,46 +237,33 @@ private:
     std::vector<double> d_flow_values, d_mean_pres_values, d_point_pres_values;
 
     /*!
-     * \brief Data structures employed to manage mappings between cell indices
-     * and web patch data (i.e., patch centroids and area-weighted normals) and
-     * meter centroid data.
+     * \brief Data structures employed to manage the web patch data (i.e., patch
+     * centroids and area-weighted normals) and meter centroid data that are
+     * assigned to the cells of each local patch.
+     *
+     * These lists are indexed by level number and then by patch number, and
+     * each entry records the Cartesian grid cell to which the web patch or
+     * centroid is assigned, so that reading the instrument data only touches
+     * those cells that actually contain meter data.
      */
-    struct IndexFortranOrder : public std::binary_function<SAMRAI::hier::Index<NDIM>, SAMRAI::hier::Index<NDIM>, bool>
-    {
-        inline bool operator()(const SAMRAI::hier::Index<NDIM>& lhs, const SAMRAI::hier::Index<NDIM>& rhs) const
-        {
-
-            return (lhs(0) < rhs(0)
-#if (NDIM > 1)
-                    ||
-                    (lhs(0) == rhs(0) && lhs(1) < rhs(1))
-#if (NDIM > 2)
-                    ||
-                    (lhs(0) == rhs(0) && lhs(1) == rhs(1) && lhs(2) < rhs(2))
-#endif
-#endif
-                        );
-        } // operator()
-    };
-
     struct WebPatch
     {
         int meter_num;
+        SAMRAI::hier::Index<NDIM> i;
         const IBTK::Vector* X;
         const IBTK::Vector* dA;
     };
 
-    typedef std::multimap<SAMRAI::hier::Index<NDIM>, WebPatch, IndexFortranOrder> WebPatchMap;
-    std::vector<WebPatchMap> d_web_patch_map;
+    std::vector<std::vector<std::vector<WebPatch> > > d_web_patch_lists;
 
     struct WebCentroid
     {
         int meter_num;
+        SAMRAI::hier::Index<NDIM> i;
         const IBTK::Vector* X;
     };
 
-    typedef std::multimap<SAMRAI::hier::Index<NDIM>, WebCentroid, IndexFortranOrder> WebCentroidMap;
-    std::vector<WebCentroidMap> d_web_centroid_map;
+    std::vector<std::vector<std::vector<WebCentroid> > > d_web_centroid_lists;
 
     /*
      * The directory where data is to be dumped and the most recent timestep
@@ -75,6 +75,10 @@ namespace IBAMR
  *
  * \note Class IBKirchhoffRodForceGen DOES NOT correct for periodic
  * displacements of IB points.
+ *
+ * \note The rod segments are processed in blocks of contiguous segments.  When
+ * IBAMR is compiled with OpenMP support, the blocks are processed concurrently
+ * by the threads available to each MPI process.
  */
 class IBKirchhoffRodForceGen : public virtual SAMRAI::tbox::DescribedClass
 {
@@ -200,6 +200,13 @@ public:
      */
     void setLinearizedPosition(Vec& X_vec);
 
+    /*!
+     * Return the assembled Jacobian of the Lagrangian force when the input
+     * database key use_assembled_force_jacobian is set to TRUE, or NULL
+     * otherwise.
+     */
+    Mat getLinearizedForceJacobian();
+
     /*!
      * Compute the residual on the specified level of the patch hierarchy.
      */
@@ -262,12 +269,50 @@ public:
      */
     void computeLagrangianForce(double data_time);
 
+    /*!
+     * Compute the time-averaged Lagrangian force over the current time interval
+     * by advancing the Lagrangian structure in \a num_substeps substeps, using
+     * the (frozen) Eulerian velocity \a u_data_idx.
+     *
+     * Each substep is a midpoint-rule step in which the velocity is
+     * interpolated from the frozen Eulerian velocity field, and the force is
+     * evaluated at the midpoint of the substep.  The time-averaged force is
+     * stored as the force at the midpoint of the time interval, and the
+     * positions at the end of the final substep are stored as the predicted
+     * updated positions.
+     */
+    void computeSubcycledLagrangianForce(
+        int u_data_idx,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > >& u_synch_scheds,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
+        double current_time,
+        double new_time,
+        int num_substeps);
+
+    /*!
+     * Estimate the largest time step size for which an explicit treatment of
+     * the Lagrangian elastic forces remains stable.
+     *
+     * The largest eigenvalue lambda of the Jacobian of the Lagrangian force is
+     * estimated by a few iterations of matrix-free power iteration, and the
+     * estimate is sqrt(m/lambda), in which m = rho*h^NDIM is the mass of the
+     * fluid in a single Cartesian grid cell.
+     */
+    double getStableTimestep();
+
     /*!
      * Compute the Lagrangian force of the linearized problem for the specified
      * configuration of the updated position vector.
      */
     void computeLinearizedLagrangianForce(Vec& X_vec, double data_time);
 
+    /*!
+     * Reset the Lagrangian force at anchored nodes and begin the ghost node
+     * updates of the Lagrangian force and position data required to spread the
+     * force at the specified time within the current time interval.
+     */
+    void beginSpreadForce(double data_time);
+
     /*!
      * Spread the Lagrangian force to the Cartesian grid at the specified time
      * within the current time interval.
@@ -474,6 +519,11 @@ protected:
     void
     resetAnchorPointValues(std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > U_data, int coarsest_ln, int finest_ln);
 
+    /*!
+     * Complete any ghost node updates begun by beginSpreadForce().
+     */
+    void endPendingGhostUpdates();
+
     /*
      * PETSc function for evaluating Lagrangian force.
      */
@@ -486,6 +536,19 @@ protected:
      */
     bool d_do_log;
 
+    /*
+     * Indicates whether the Lagrangian nodes are ordered along a space-filling
+     * curve when the Lagrangian data are redistributed.
+     */
+    bool d_use_sfc_ordering;
+
+    /*
+     * Indicates whether the Jacobian of the Lagrangian force is assembled
+     * explicitly (via the force strategy) instead of being approximated by
+     * finite differences of the force.
+     */
+    bool d_use_assembled_force_jac;
+
     /*
      * Pointers to the patch hierarchy and gridding algorithm objects associated
      * with this object.
@@ -523,6 +586,18 @@ protected:
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_U_current_data, d_U_new_data, d_U_half_data, d_U_jac_data;
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_F_current_data, d_F_new_data, d_F_half_data, d_F_jac_data;
 
+    /*
+     * Estimate of the dominant eigenvector of the Jacobian of the Lagrangian
+     * force, used to warm start the estimate of the stable time step size.
+     */
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_stable_dt_eigvec_data;
+
+    /*
+     * Lagrangian data with ghost node updates that have been begun by
+     * beginSpreadForce() but that have not yet been completed.
+     */
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_pending_ghost_update_data;
+
     /*
      * List of local indices of local anchor points.
      *
@@ -79,6 +79,18 @@ namespace IBAMR
  * force function with any function that implements the interface required by
  * registerSpringForceFunction().  Users may also specify additional force
  * functions that may be associated with arbitrary integer indices.
+ *
+ * \note Springs that use default_spring_force() (regardless of the index with
+ * which it is registered) are evaluated by a specialized kernel that does not
+ * call through the force function pointer.  Springs that use any other force
+ * function are evaluated via the registered function.
+ *
+ * \note When IBAMR is compiled with OpenMP support, spring and beam forces are
+ * accumulated concurrently by the threads available to each MPI process.  The
+ * springs and beams are colored when the level data are initialized so that
+ * springs (or beams) of the same color do not share any nodes.  The colors are
+ * processed one at a time, so the results do not depend on the number of
+ * threads.
  */
 class IBStandardForceGen : public IBLagrangianForceStrategy
 {
@@ -108,6 +120,21 @@ public:
                                      const SpringForceFcnPtr spring_force_fcn_ptr,
                                      const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr = NULL);
 
+    /*!
+     * \brief Indicate whether the forces should be computed by a fused kernel
+     * that makes a single pass over the local nodes.
+     *
+     * When the fused kernel is used, the springs, beams, and target points
+     * associated with each local node are processed together, so that the data
+     * associated with each node is loaded only once.  This is intended for
+     * structures that combine several types of force specifications.
+     *
+     * \note The fused kernel is not threaded, and it does not overlap the
+     * communication of ghost node positions with computation.  By default, the
+     * fused kernel is not used.
+     */
+    void setUseFusedForceKernel(bool use_fused_force_kernel);
+
     /*!
      * \brief Setup the data needed to compute the forces on the specified level
      * of the patch hierarchy.
@@ -137,6 +164,12 @@ public:
      * \brief Compute the non-zero structure of the force Jacobian matrix.
      *
      * \note Elements indices must be global PETSc indices.
+     *
+     * \note The number of nonzero NDIM x NDIM blocks in each block row of the
+     * matrix is added to each of the NDIM corresponding entries of \a d_nnz and
+     * \a o_nnz.  The nonzero structure is cached, and it is recomputed only
+     * after the level data are reinitialized (e.g., following the
+     * redistribution of the Lagrangian data).
      */
     void
     computeLagrangianForceJacobianNonzeroStructure(std::vector<int>& d_nnz,
@@ -151,6 +184,11 @@ public:
      *
      * \note The elements of the Jacobian should be "accumulated" in the
      * provided matrix J.
+     *
+     * \note The matrix must have a block size of NDIM.  Values are inserted
+     * via MatSetValuesBlocked() into the nonzero structure computed by
+     * computeLagrangianForceJacobianNonzeroStructure(), so that the Jacobian
+     * may be refilled in place (e.g., following a call to MatZeroEntries()).
      */
     void computeLagrangianForceJacobian(Mat& J_mat,
                                         MatAssemblyType assembly_type,
@@ -206,6 +244,19 @@ private:
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+
+        // The interior springs (whose nodes are all local) are stored before
+        // the boundary springs (which involve ghost nodes), so that the
+        // interior spring forces may be computed while the ghost node
+        // positions are being communicated.  Within each set, springs that use
+        // default_spring_force() are stored first, so that they may be
+        // evaluated without calling through the force function pointers.
+        int num_interior_springs, num_interior_linear_springs, num_boundary_linear_springs;
+
+        // Each of these sets of springs is further sorted by color.  Springs
+        // of the same color do not share any nodes.  Color c consists of the
+        // springs with indices in [color_offsets[c], color_offsets[c+1]).
+        std::vector<int> color_offsets;
     };
     std::vector<SpringData> d_spring_data;
 
@@ -214,6 +265,15 @@ private:
         std::vector<int> petsc_mastr_node_idxs, petsc_next_node_idxs, petsc_prev_node_idxs;
         std::vector<const double*> rigidities;
         std::vector<const IBTK::Vector*> curvatures;
+
+        // The interior beams (whose nodes are all local) are stored before the
+        // boundary beams (which involve ghost nodes).
+        int num_interior_beams;
+
+        // Each of these sets of beams is further sorted by color.  Beams of
+        // the same color do not share any nodes.  Color c consists of the
+        // beams with indices in [color_offsets[c], color_offsets[c+1]).
+        std::vector<int> color_offsets;
     };
     std::vector<BeamData> d_beam_data;
 
@@ -227,10 +287,51 @@ private:
 
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_X_ghost_data, d_F_ghost_data, d_dX_data;
     std::vector<bool> d_is_initialized;
+
+    /*
+     * The global PETSc indices of the ghost nodes, which are used to map the
+     * cached (local) PETSc indices back to global indices when assembling the
+     * force Jacobian, and the cached nonzero structure of the force Jacobian.
+     */
+    std::vector<std::vector<int> > d_nonlocal_petsc_idxs;
+    std::vector<std::vector<int> > d_jac_d_nnz, d_jac_o_nnz;
+    std::vector<bool> d_jac_nnz_is_cached;
+
+    struct FusedData
+    {
+        // The springs, beams, and target points grouped by their (local)
+        // master nodes.  The springs and beams whose master node is local node
+        // m are spring_idxs[spring_offsets[m]], ...,
+        // spring_idxs[spring_offsets[m+1]-1] and beam_idxs[beam_offsets[m]],
+        // ..., beam_idxs[beam_offsets[m+1]-1], and the target point at local
+        // node m (if any) is target_point_idxs[m] (or -1 if there is none).
+        std::vector<int> spring_offsets, spring_idxs;
+        std::vector<int> beam_offsets, beam_idxs;
+        std::vector<int> target_point_idxs;
+    };
+    std::vector<FusedData> d_fused_data;
     //\}
 
+    /*!
+     * Fused force routines.
+     *
+     * The initialization routine groups the cached springs, beams, and target
+     * points by node, and the compute routine computes all of the forces in a
+     * single pass over the local nodes.
+     */
+    void initializeFusedLevelData(int level_number, IBTK::LDataManager* l_data_manager);
+    void computeLagrangianFusedForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
+                                     SAMRAI::tbox::Pointer<IBTK::LData> X_data,
+                                     SAMRAI::tbox::Pointer<IBTK::LData> U_data,
+                                     int level_number,
+                                     IBTK::LDataManager* l_data_manager);
+
     /*!
      * Spring force routines.
+     *
+     * The compute routine computes the forces generated by either the interior
+     * springs (whose nodes are all local) or the boundary springs (which involve
+     * ghost nodes).
      */
     void initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_set,
                                    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
@@ -243,10 +344,15 @@ private:
                                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                       int level_number,
                                       double data_time,
-                                      IBTK::LDataManager* l_data_manager);
+                                      IBTK::LDataManager* l_data_manager,
+                                      bool interior);
 
     /*!
      * Beam force routines.
+     *
+     * The compute routine computes the forces generated by either the interior
+     * beams (whose nodes are all local) or the boundary beams (which involve
+     * ghost nodes).
      */
     void initializeBeamLevelData(std::set<int>& nonlocal_petsc_idx_set,
                                  SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
@@ -259,7 +365,8 @@ private:
                                     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                     int level_number,
                                     double data_time,
-                                    IBTK::LDataManager* l_data_manager);
+                                    IBTK::LDataManager* l_data_manager,
+                                    bool interior);
 
     /*!
      * TargetPoint force routines.
@@ -283,6 +390,11 @@ private:
      */
     std::map<int, SpringForceFcnPtr> d_spring_force_fcn_map;
     std::map<int, SpringForceDerivFcnPtr> d_spring_force_deriv_fcn_map;
+
+    /*!
+     * \brief Whether to use the fused force kernel.
+     */
+    bool d_use_fused_force_kernel;
 };
 } // namespace IBAMR
 
@@ -421,6 +421,82 @@ namespace IBAMR
  D2_x_2   D2_y_2   D2_z_2  # coordinates of director D2 associated with vertex 2
  ...
  \endverbatim
+ *
+ * <HR>
+ *
+ * <B>Binary file format</B>
+ *
+ * If the input database entry <TT>use_binary_structure_files</TT> is set to
+ * <TT>TRUE</TT>, each of the input files described above may alternatively be
+ * provided in a binary format in a file with the additional extension
+ * <TT>".bin"</TT> (e.g., <TT>"structure.vertex.bin"</TT>).  If a binary file is
+ * found, it is used in place of the corresponding ASCII file.  Binary files are
+ * read collectively via MPI-IO, with each MPI process reading a contiguous slice
+ * of the records in the file.  File batons are not used for binary files.
+ *
+ * If all of the vertex files on a level of the locally refined Cartesian grid
+ * are binary files, the structure data on that level are distributed rather
+ * than replicated.  Each process initially holds the vertices in its slices of
+ * the vertex files, and each record of the other binary files on the level is
+ * sent (via \p MPI_Alltoallv) to the process that holds the vertex that the
+ * record is associated with.  When the patch hierarchy is tagged for initial
+ * refinement and when the level is initialized, the data associated with each
+ * vertex are sent to the process that owns the patch that contains the vertex.
+ * ASCII files on such levels are read by all processes, but each process keeps
+ * only the data associated with the vertices that it holds.  The spring,
+ * crosslink spring, and rod connectivity data are gathered onto MPI process 0
+ * when they are registered with a Lagrangian Silo data writer.
+ *
+ * On levels with any ASCII vertex file, the slices of each binary file are
+ * gathered onto all of the processes.
+ *
+ * Binary files use native byte ordering and have the following layout:
+ \verbatim
+ char[8]   "IBSTRUCT"      # magic string
+ int32     version         # file format version (currently 1)
+ int32     NDIM            # spatial dimension of the model
+ int32     n_int           # number of int32 fields per record
+ int32     n_double        # number of float64 fields per record
+ int32     n_names         # number of names (instrument and source files only)
+ int32     n_values        # number of header values (source radii; source files only)
+ int64     M               # number of records in the file
+ int64     data_offset     # offset in bytes of the first record
+ n_names * (int32 length, char[length])  # names
+ n_values * float64                      # header values
+ M * (int32[n_int], float64[n_double])   # packed records starting at data_offset
+ \endverbatim
+ *
+ * The record fields for each type of file are:
+ \verbatim
+ .vertex    n_int = 0, n_double = NDIM   # X
+ .spring    n_int = 3, n_double >= 2     # i, j, fcn_idx; kappa, length, additional parameters
+ .xspring   n_int = 3, n_double >= 2     # i, j, fcn_idx; kappa, length, additional parameters
+ .beam      n_int = 3, n_double = 1+NDIM # i, j, k; kappa, curvature
+ .rod       n_int = 2, n_double = 10     # i, j; ds, a1, a2, a3, b1, b2, b3, kappa1, kappa2, tau
+ .target    n_int = 1, n_double = 2      # i; kappa, eta
+ .anchor    n_int = 1, n_double = 0      # i
+ .mass      n_int = 1, n_double = 2      # i; mass, kappa
+ .director  n_int = 0, n_double = 9      # D0, D1, D2
+ .inst      n_int = 3, n_double = 0      # i, meter_idx, meter_node_idx; meter names stored as names
+ .source    n_int = 2, n_double = 0      # i, source_idx; source names and radii stored as names and values
+ \endverbatim
+ *
+ * \see src/tools/convert_structure_to_binary.pl
+ *
+ * <HR>
+ *
+ * <B>Retaining only local structure data</B>
+ *
+ * By default, every MPI process retains all of the structure data read from
+ * the input files for the lifetime of the initializer.  If the input database
+ * entry <TT>retain_only_local_structure_data</TT> is set to <TT>TRUE</TT>, the
+ * connectivity and force specification data associated with a level of the
+ * locally refined Cartesian grid are freed as soon as the Lagrangian data on
+ * that level have been initialized, and the vertex positions and the boundary
+ * mass and director data are pruned to the vertices that are local to each
+ * process.  In this mode, a Lagrangian Silo data writer must be registered
+ * before the patch hierarchy is initialized, and the Lagrangian data on a level
+ * cannot be re-initialized from the initializer.
 */
 class IBStandardInitializer : public IBTK::LInitStrategy
 {
@@ -585,6 +661,36 @@ private:
      */
     void initializeLSiloDataWriter(int level_number);
 
+    /*!
+     * \brief Free the structure data associated with the specified level that
+     * have been stored in the Lagrangian node data, and prune the remaining
+     * per-vertex data to the specified local vertices.
+     */
+    void pruneStructureData(int level_number, const std::vector<std::pair<int, int> >& local_vertices);
+
+    /*!
+     * \brief Send the distributed structure data associated with the specified
+     * level to the processes that own the patches of the specified patch level
+     * that contain the vertices.
+     *
+     * \note This is a collective operation.
+     */
+    void redistributeStructureData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                   int patch_level_number,
+                                   int level_number);
+
+    /*!
+     * \brief Append the structure data associated with the specified vertex to
+     * a buffer.
+     */
+    void packVertexData(std::vector<char>& buffer, const std::pair<int, int>& point_index, int level_number) const;
+
+    /*!
+     * \brief Add the structure data associated with a vertex that have been
+     * packed by packVertexData() to the data retained by this process.
+     */
+    void unpackVertexData(const char* buffer, int level_number);
+
     /*!
      * \brief Read the vertex data from one or more input files.
      */
@@ -653,11 +759,53 @@ private:
                           const double* domain_x_upper,
                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift) const;
 
+    /*!
+     * \brief Uniform binning of the vertices assigned to a level of the
+     * Cartesian grid, with bins sized in terms of the grid spacing of the patch
+     * level being queried.
+     */
+    struct VertexBinning
+    {
+        IBTK::Vector dx, bin_width;
+        SAMRAI::hier::IntVector<NDIM> num_bins, periodic_shift;
+        std::vector<int> bin_offset;
+        std::vector<std::pair<int, int> > bin_vertices;
+    };
+
+    /*!
+     * \brief Get the binning of the vertices assigned to the specified level
+     * with respect to a patch level with grid spacing \a dx, building it if
+     * necessary.
+     */
+    const VertexBinning& getVertexBinning(int level_number,
+                                          const double* dx,
+                                          const double* domain_x_lower,
+                                          const double* domain_x_upper,
+                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift) const;
+
     /*!
      * \return The canonical Lagrangian index of the specified vertex.
      */
     int getCanonicalLagrangianIndex(const std::pair<int, int>& point_index, int level_number) const;
 
+    /*!
+     * \return The (structure, vertex) index of the vertex with the specified
+     * canonical Lagrangian index.
+     */
+    std::pair<int, int> getPointIndex(int lag_idx, int level_number) const;
+
+    /*!
+     * \return Whether the per-vertex data associated with the specified vertex
+     * are retained by this process.
+     */
+    bool isLocalVertex(const std::pair<int, int>& point_index, int level_number) const;
+
+    /*!
+     * \return The index of the specified vertex in the per-vertex data
+     * retained by this process.
+     */
+    int getLocalVertexIndex(const std::pair<int, int>& point_index, int level_number) const;
+
     /*!
      * \return The initial position of the specified vertex.
      */
@@ -741,6 +889,28 @@ private:
      */
     bool d_use_file_batons;
 
+    /*
+     * The boolean value determines whether binary versions of the input files
+     * are read collectively via MPI-IO when they are available.
+     */
+    bool d_use_binary_structure_files;
+
+    /*
+     * The boolean value determines whether only the structure data required by
+     * the local MPI process are retained once a level has been initialized,
+     * along with a vector of boolean values indicating whether the data
+     * associated with a particular level have been pruned.
+     */
+    bool d_retain_only_local_structure_data;
+    std::vector<bool> d_level_data_is_pruned;
+
+    /*
+     * A vector of boolean values indicating whether the structure data
+     * associated with a particular level are distributed among the MPI
+     * processes rather than replicated.
+     */
+    std::vector<bool> d_level_data_is_distributed;
+
     /*
      * The maximum number of levels in the Cartesian grid patch hierarchy and a
      * vector of boolean values indicating whether a particular level has been
@@ -781,6 +951,15 @@ private:
     std::vector<std::vector<int> > d_num_vertex, d_vertex_offset;
     std::vector<std::vector<std::vector<IBTK::Point> > > d_vertex_posn;
 
+    /*
+     * The sorted indices of the vertices whose data are retained by this
+     * process on levels that have been pruned or that are distributed.  On such
+     * levels, the per-vertex data (positions and target point, anchor point,
+     * boundary mass, and director data) are stored only for these vertices, in
+     * the same order.
+     */
+    std::vector<std::vector<std::vector<int> > > d_local_vertex_idx;
+
     /*
      * Edge data structures.
      */
@@ -941,6 +1120,14 @@ private:
      * purposes.
      */
     std::vector<unsigned int> d_global_index_offset;
+
+    /*
+     * Cached vertex binnings used to find the vertices located within a patch,
+     * indexed by the level number of the vertices.  There is typically one
+     * binning for each patch level that is queried.  The binnings associated
+     * with a level are freed when the structure data on that level are pruned.
+     */
+    mutable std::vector<std::vector<VertexBinning> > d_vertex_binning;
 };
 } // namespace IBAMR
 
@@ -237,6 +237,47 @@ public:
      */
     virtual void computeLagrangianForce(double data_time) = 0;
 
+    /*!
+     * Compute the time-averaged Lagrangian force over the current time interval
+     * by advancing the Lagrangian structure in \a num_substeps substeps, using
+     * the (frozen) Eulerian velocity \a u_data_idx.  The time-averaged force is
+     * stored as the force at the midpoint of the time interval, and the
+     * positions at the end of the final substep are stored as the predicted
+     * updated positions.
+     *
+     * A default implementation is provided that emits an unrecoverable
+     * exception.
+     */
+    virtual void computeSubcycledLagrangianForce(
+        int u_data_idx,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > >& u_synch_scheds,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
+        double current_time,
+        double new_time,
+        int num_substeps);
+
+    /*!
+     * Estimate the largest time step size for which an explicit treatment of
+     * the Lagrangian elastic forces remains stable.  The estimate is based on
+     * the stiffness of the current configuration of the structure and the
+     * effective mass associated with each Lagrangian node.
+     *
+     * A default implementation is provided that returns
+     * std::numeric_limits<double>::max().
+     */
+    virtual double getStableTimestep();
+
+    /*!
+     * Begin any communication required to spread the Lagrangian force at the
+     * specified time within the current time interval, so that it may be
+     * overlapped with other work.  The communication is completed by the next
+     * call to spreadForce().  The Lagrangian data must not be modified between
+     * the two calls, except by computeLagrangianForce() at other times.
+     *
+     * A default implementation is provided that does nothing.
+     */
+    virtual void beginSpreadForce(double data_time);
+
     /*!
      * Spread the Lagrangian force to the Cartesian grid at the specified time
      * within the current time interval.
@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/HardwareCounters.h"
 #include "tbox/PIO.h"
 
 /////////////////////////////// MACRO DEFINITIONS ////////////////////////////
@@ -89,13 +90,21 @@ static const bool ENABLE_TIMERS = true;
 #define IBAMR_TIMER_START(timer)                                                                                       \
     do                                                                                                                 \
     {                                                                                                                  \
-        if (IBAMR::ENABLE_TIMERS) timer->start();                                                                      \
+        if (IBAMR::ENABLE_TIMERS)                                                                                      \
+        {                                                                                                              \
+            timer->start();                                                                                            \
+            if (IBTK::HardwareCounters::isEnabled()) IBTK::HardwareCounters::startRegion(&*timer);                     \
+        }                                                                                                              \
     } while (0);
 
 #define IBAMR_TIMER_STOP(timer)                                                                                        \
     do                                                                                                                 \
     {                                                                                                                  \
-        if (IBAMR::ENABLE_TIMERS) timer->stop();                                                                       \
+        if (IBAMR::ENABLE_TIMERS)                                                                                      \
+        {                                                                                                              \
+            if (IBTK::HardwareCounters::isEnabled()) IBTK::HardwareCounters::stopRegion(&*timer);                      \
+            timer->stop();                                                                                             \
+        }                                                                                                              \
     } while (0);
 
 /////////////////////////////// FUNCTION DEFINITIONS /////////////////////////
@@ -32,6 +32,8 @@
 
 /////////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include "tbox/Utilities.h"
 #include "ibamr/namespaces.h"
@@ -166,6 +168,114 @@ void ConstraintIBKinematics::putToDatabase(Pointer<Database> /*db*/)
     return;
 }
 
+void ConstraintIBKinematics::setBodyLayout(const std::vector<double>& section_arc_length,
+                                           const std::vector<int>& section_num_pts,
+                                           const std::vector<std::vector<double> >& body_frame_coords)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(section_arc_length.size() == section_num_pts.size());
+    TBOX_ASSERT(body_frame_coords.size() == NDIM);
+#endif
+    d_section_arc_length = section_arc_length;
+    d_section_offsets.resize(section_num_pts.size() + 1);
+    d_section_offsets[0] = 0;
+    for (unsigned int k = 0; k < section_num_pts.size(); ++k)
+    {
+        d_section_offsets[k + 1] = d_section_offsets[k] + section_num_pts[k];
+    }
+    for (int d = 0; d < NDIM; ++d)
+    {
+        if (static_cast<int>(body_frame_coords[d].size()) != d_section_offsets.back())
+        {
+            TBOX_ERROR(d_object_name << "::setBodyLayout():\n"
+                                     << "  number of body-frame coordinates does not match the number of points in "
+                                        "the sections."
+                                     << std::endl);
+        }
+    }
+    d_body_frame_coords = body_frame_coords;
+    return;
+} // setBodyLayout
+
+void ConstraintIBKinematics::spreadSectionData(const std::vector<std::vector<double> >& section_data,
+                                               std::vector<std::vector<double> >& point_data) const
+{
+    const int num_sections = getNumberOfSections();
+    for (unsigned int d = 0; d < section_data.size(); ++d)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(static_cast<int>(section_data[d].size()) == num_sections);
+        TBOX_ASSERT(static_cast<int>(point_data[d].size()) >= d_section_offsets.back());
+#endif
+        for (int k = 0; k < num_sections; ++k)
+        {
+            std::fill(point_data[d].begin() + d_section_offsets[k],
+                      point_data[d].begin() + d_section_offsets[k + 1],
+                      section_data[d][k]);
+        }
+    }
+    return;
+} // spreadSectionData
+
+void ConstraintIBKinematics::setShapeFromSections(const std::vector<std::vector<double> >& section_origin,
+                                                  std::vector<std::vector<double> >& shape) const
+{
+    const int num_sections = getNumberOfSections();
+    for (int d = 0; d < NDIM; ++d)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(static_cast<int>(section_origin[d].size()) == num_sections);
+        TBOX_ASSERT(static_cast<int>(shape[d].size()) >= d_section_offsets.back());
+#endif
+        const double* const X_body = d_body_frame_coords[d].empty() ? NULL : &d_body_frame_coords[d][0];
+        double* const X = shape[d].empty() ? NULL : &shape[d][0];
+        for (int k = 0; k < num_sections; ++k)
+        {
+            const double X_origin = section_origin[d][k];
+            for (int i = d_section_offsets[k]; i < d_section_offsets[k + 1]; ++i)
+            {
+                X[i] = X_origin + X_body[i];
+            }
+        }
+    }
+    return;
+} // setShapeFromSections
+
+void ConstraintIBKinematics::centerAndRotateShape(std::vector<std::vector<double> >& shape, const double angle) const
+{
+    const int total_lag_pts = static_cast<int>(shape[0].size());
+    if (total_lag_pts == 0) return;
+
+    // Shift the center of mass to the origin.
+    for (int d = 0; d < NDIM; ++d)
+    {
+        double center_of_mass = 0.0;
+        for (std::vector<double>::const_iterator cit = shape[d].begin(); cit != shape[d].end(); ++cit)
+        {
+            center_of_mass += *cit;
+        }
+        center_of_mass /= total_lag_pts;
+        for (std::vector<double>::iterator it = shape[d].begin(); it != shape[d].end(); ++it)
+        {
+            *it -= center_of_mass;
+        }
+    }
+
+    // Rotate the shape about the origin.
+    const double cos_angle = std::cos(angle);
+    const double sin_angle = std::sin(angle);
+    double* const X = &shape[0][0];
+    double* const Y = &shape[1][0];
+    for (int i = 0; i < total_lag_pts; ++i)
+    {
+        const double x_rotated = X[i] * cos_angle - Y[i] * sin_angle;
+        const double y_rotated = X[i] * sin_angle + Y[i] * cos_angle;
+        X[i] = x_rotated;
+        Y[i] = y_rotated;
+    }
+    return;
+} // centerAndRotateShape
+
 } // IBAMR
 
 //////////////////////////////////////////////////////////////////////////////
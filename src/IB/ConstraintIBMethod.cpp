@@ -138,6 +138,35 @@ inline int find_struct_handle_position(itr begin, itr end, const T& value)
     return -1;
 }
 
+// Sum the leading components of several collections of per-structure data over
+// all processors with a single reduction.
+inline void sumReduceStructureData(const std::vector<std::vector<std::vector<double> >*>& struct_data, const int depth)
+{
+    std::vector<double> buffer;
+    for (unsigned int k = 0; k < struct_data.size(); ++k)
+    {
+        const std::vector<std::vector<double> >& data = *struct_data[k];
+        for (unsigned int struct_no = 0; struct_no < data.size(); ++struct_no)
+        {
+            buffer.insert(buffer.end(), data[struct_no].begin(), data[struct_no].begin() + depth);
+        }
+    }
+    if (buffer.empty()) return;
+
+    SAMRAI_MPI::sumReduction(&buffer[0], static_cast<int>(buffer.size()));
+
+    std::vector<double>::const_iterator cit = buffer.begin();
+    for (unsigned int k = 0; k < struct_data.size(); ++k)
+    {
+        std::vector<std::vector<double> >& data = *struct_data[k];
+        for (unsigned int struct_no = 0; struct_no < data.size(); ++struct_no, cit += depth)
+        {
+            std::copy(cit, cit + depth, data[struct_no].begin());
+        }
+    }
+    return;
+}
+
 #if (NDIM == 3)
 // Routine to solve 3X3 equation to get rigid body rotational velocity.
 inline void solveSystemOfEqns(std::vector<double>& ang_mom, const Eigen::Matrix3d& inertiaTensor)
@@ -413,6 +442,7 @@ void ConstraintIBMethod::postprocessSolveFluidEquations(double current_time, dou
     IBTK_TIMER_START(t_calculateRigidMomentum);
     calculateRigidTranslationalMomentum();
     calculateRigidRotationalMomentum();
+    finalizeRigidMomentum();
     IBTK_TIMER_STOP(t_calculateRigidMomentum);
 
     IBTK_TIMER_START(t_correctVelocityOnLagrangianMesh);
@@ -430,10 +460,8 @@ void ConstraintIBMethod::postprocessSolveFluidEquations(double current_time, dou
         IBTK_TIMER_STOP(t_applyProjection);
     }
 
-    if (d_output_drag) calculateDrag();
-    if (d_output_torque) calculateTorque();
+    if (d_output_drag || d_output_torque || d_output_power) calculateStructureDiagnostics();
     if (d_output_eul_mom) calculateEulerianMomentum();
-    if (d_output_power) calculatePower();
 
     IBTK_TIMER_STOP(t_postprocessSolveFluidEquation);
 
@@ -760,8 +788,6 @@ void ConstraintIBMethod::getFromRestart()
 
 void ConstraintIBMethod::setInitialLagrangianVelocity()
 {
-    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
-
     calculateCOMandMOIOfStructures();
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -771,10 +797,12 @@ void ConstraintIBMethod::setInitialLagrangianVelocity()
                                                           d_center_of_mass_current[struct_no],
                                                           d_tagged_pt_position[struct_no]);
         d_ib_kinematics[struct_no]->setShape(0.0, d_incremented_angle_from_reference_axis[struct_no]);
+    }
 
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
+    calculateMomentumOfKinematicsVelocity();
 
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
         d_vel_com_def_current[struct_no] = d_vel_com_def_new[struct_no];
         d_omega_com_def_current[struct_no] = d_omega_com_def_new[struct_no];
     }
@@ -863,24 +891,22 @@ void ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     }
 
+    // Sum the COM and tagged point data of all structures in a single reduction.
+    std::vector<std::vector<std::vector<double> >*> com_data;
+    com_data.push_back(&d_center_of_mass_current);
+    com_data.push_back(&d_center_of_mass_new);
+    com_data.push_back(&tagged_position);
+    sumReduceStructureData(com_data, 3);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         const int total_nodes = struct_param.getTotalNodes();
-
-        SAMRAI_MPI::sumReduction(&d_center_of_mass_current[struct_no][0], NDIM);
-        SAMRAI_MPI::sumReduction(&d_center_of_mass_new[struct_no][0], NDIM);
-
         for (int i = 0; i < 3; ++i)
         {
             d_center_of_mass_current[struct_no][i] /= total_nodes;
             d_center_of_mass_new[struct_no][i] /= total_nodes;
         }
-    }
-
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        SAMRAI_MPI::sumReduction(&tagged_position[struct_no][0], 3);
         d_tagged_pt_position[struct_no] = tagged_position[struct_no];
     }
 
@@ -983,13 +1009,29 @@ void ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     } // all levels
 
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    // Sum the inertia tensors of all structures in a single reduction.  The
+    // tensors of structures that are not self-rotating remain zero.
+    if (d_no_structures > 0)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        if (struct_param.getStructureIsSelfRotating())
+        std::vector<double> moi_buffer(18 * d_no_structures);
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+        {
+            std::copy(d_moment_of_inertia_current[struct_no].data(),
+                      d_moment_of_inertia_current[struct_no].data() + 9,
+                      &moi_buffer[18 * struct_no]);
+            std::copy(d_moment_of_inertia_new[struct_no].data(),
+                      d_moment_of_inertia_new[struct_no].data() + 9,
+                      &moi_buffer[18 * struct_no + 9]);
+        }
+        SAMRAI_MPI::sumReduction(&moi_buffer[0], 18 * d_no_structures);
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
         {
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
+            std::copy(&moi_buffer[18 * struct_no],
+                      &moi_buffer[18 * struct_no] + 9,
+                      d_moment_of_inertia_current[struct_no].data());
+            std::copy(&moi_buffer[18 * struct_no + 9],
+                      &moi_buffer[18 * struct_no + 9] + 9,
+                      d_moment_of_inertia_new[struct_no].data());
         }
     }
 
@@ -1039,13 +1081,10 @@ void ConstraintIBMethod::calculateCOMandMOIOfStructures()
 
 void ConstraintIBMethod::calculateKinematicsVelocity()
 {
-    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
     const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
     // Theta_new = Theta_old + Omega_old*dt
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-
         for (int d = 0; d < 3; ++d)
             d_incremented_angle_from_reference_axis[struct_no][d] +=
                 (d_rigid_rot_vel_current[struct_no][d] - d_omega_com_def_current[struct_no][d]) * dt;
@@ -1056,77 +1095,64 @@ void ConstraintIBMethod::calculateKinematicsVelocity()
                                                           d_tagged_pt_position[struct_no]);
 
         d_ib_kinematics[struct_no]->setShape(d_FuRMoRP_new_time, d_incremented_angle_from_reference_axis[struct_no]);
-
-        if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
     }
 
+    calculateMomentumOfKinematicsVelocity();
+
     return;
 } // calculateKinematicsVelocity
 
-void ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_handle)
+void ConstraintIBMethod::calculateMomentumOfKinematicsVelocity()
 {
     typedef ConstraintIBKinematics::StructureParameters StructureParameters;
-    Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
-    const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-    Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
-    Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
-    const int coarsest_ln = struct_param.getCoarsestLevelNumber();
-    const int finest_ln = struct_param.getFinestLevelNumber();
-    const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
-    const int total_nodes = struct_param.getTotalNodes();
+    std::vector<std::vector<double> > U_com_def(d_no_structures, std::vector<double>(3, 0.0));
+    std::vector<std::vector<double> > R_cross_U_def(d_no_structures, std::vector<double>(3, 0.0));
 
-    // Zero out linear momentum of kinematics velocity of the structure.
-    for (int d = 0; d < 3; ++d) d_vel_com_def_new[position_handle][d] = 0.0;
-
-    // Calculate linear momentum
-    for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size(); ++ln, ++itr)
+    // Accumulate the local contributions to the linear and angular momentum of
+    // the kinematics velocity of each self-translating structure.
+    for (int position_handle = 0; position_handle < d_no_structures; ++position_handle)
     {
+        Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
+        const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
+        if (!struct_param.getStructureIsSelfTranslating()) continue;
+
+        const int coarsest_ln = struct_param.getCoarsestLevelNumber();
+        const int finest_ln = struct_param.getFinestLevelNumber();
+        const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
+
+        // Calculate linear momentum
+        for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size();
+             ++ln, ++itr)
+        {
 #if !defined(NDEBUG)
-        TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
+            TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
 #endif
 
-        std::pair<int, int> lag_idx_range = range[itr];
-        const int offset = lag_idx_range.first;
-        double U_com_def[NDIM] = { 0.0 };
+            std::pair<int, int> lag_idx_range = range[itr];
+            const int offset = lag_idx_range.first;
 
-        // Get LMesh corresponding to the present position of the structures
-        // on this level.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+            // Get LMesh corresponding to the present position of the structures
+            // on this level.
+            const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
+            const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+            const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
 
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-        {
-            const LNode* const node_idx = *cit;
-            const int lag_idx = node_idx->getLagrangianIndex();
-            if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
-                for (unsigned int d = 0; d < NDIM; ++d)
+                const LNode* const node_idx = *cit;
+                const int lag_idx = node_idx->getLagrangianIndex();
+                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
                 {
-                    U_com_def[d] += def_vel[d][lag_idx - offset];
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        U_com_def[position_handle][d] += def_vel[d][lag_idx - offset];
+                    }
                 }
             }
         }
-        for (int d = 0; d < NDIM; ++d)
-        {
-            d_vel_com_def_new[position_handle][d] += U_com_def[d];
-        }
-    }
-    SAMRAI_MPI::sumReduction(&d_vel_com_def_new[position_handle][0], NDIM);
 
-    for (int d = 0; d < 3; ++d)
-    {
-        if (calculate_trans_mom[d])
-            d_vel_com_def_new[position_handle][d] /= total_nodes;
-        else
-            d_vel_com_def_new[position_handle][d] = 0.0;
-    }
-
-    // Calculate angular momentum.
-    if (struct_param.getStructureIsSelfRotating())
-    {
-        // Zero out angular momentum of kinematics velocity of the structure.
-        for (int d = 0; d < 3; ++d) d_omega_com_def_new[position_handle][d] = 0.0;
+        // Calculate angular momentum.
+        if (!struct_param.getStructureIsSelfRotating()) continue;
 
         for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size();
              ++ln, ++itr)
@@ -1137,7 +1163,6 @@ void ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int positio
 
             std::pair<int, int> lag_idx_range = range[itr];
             const int offset = lag_idx_range.first;
-            double R_cross_U_def[3] = { 0.0 };
 
             // Get LData corresponding to the present position of the structures.
             Pointer<LData> ptr_x_lag_data;
@@ -1154,6 +1179,7 @@ void ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int positio
             const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
             const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
             const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+            std::vector<double>& R_cross_U = R_cross_U_def[position_handle];
 
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
@@ -1166,7 +1192,7 @@ void ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int positio
 #if (NDIM == 2)
                     double x = X[0] - d_center_of_mass_new[position_handle][0];
                     double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
+                    R_cross_U[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
 
 #endif
 
@@ -1175,21 +1201,45 @@ void ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int positio
                     double y = X[1] - d_center_of_mass_new[position_handle][1];
                     double z = X[2] - d_center_of_mass_new[position_handle][2];
 
-                    R_cross_U_def[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
+                    R_cross_U[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
 
-                    R_cross_U_def[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
+                    R_cross_U[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
 
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
+                    R_cross_U[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
 #endif
                 }
             }
-            for (int d = 0; d < 3; ++d)
-            {
-                d_omega_com_def_new[position_handle][d] += R_cross_U_def[d];
-            }
             ptr_x_lag_data->restoreArrays();
         } // all levels
-        SAMRAI_MPI::sumReduction(&d_omega_com_def_new[position_handle][0], 3);
+    }     // all structs
+
+    // Sum the linear and angular momentum of all structures in a single
+    // reduction.
+    std::vector<std::vector<std::vector<double> >*> mom_data;
+    mom_data.push_back(&U_com_def);
+    mom_data.push_back(&R_cross_U_def);
+    sumReduceStructureData(mom_data, 3);
+
+    for (int position_handle = 0; position_handle < d_no_structures; ++position_handle)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[position_handle]->getStructureParameters();
+        if (!struct_param.getStructureIsSelfTranslating()) continue;
+
+        Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
+        Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
+        const int total_nodes = struct_param.getTotalNodes();
+
+        for (int d = 0; d < 3; ++d)
+        {
+            if (calculate_trans_mom[d])
+                d_vel_com_def_new[position_handle][d] = U_com_def[position_handle][d] / total_nodes;
+            else
+                d_vel_com_def_new[position_handle][d] = 0.0;
+        }
+
+        if (!struct_param.getStructureIsSelfRotating()) continue;
+
+        d_omega_com_def_new[position_handle] = R_cross_U_def[position_handle];
 
 // Find angular velocity of deformational velocity.
 #if (NDIM == 2)
@@ -1201,7 +1251,7 @@ void ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int positio
         for (int d = 0; d < 3; ++d)
             if (!calculate_rot_mom[d]) d_omega_com_def_new[position_handle][d] = 0.0;
 #endif
-    } // if struct is rotating
+    }
 
     return;
 } // calculateMomentumOfKinematicsVelocity
@@ -1398,35 +1448,6 @@ void ConstraintIBMethod::calculateRigidTranslationalMomentum()
         d_l_data_U_interp[ln]->restoreArrays();
     } // all levels
 
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        if (struct_param.getStructureIsSelfTranslating())
-        {
-            SAMRAI_MPI::sumReduction(&d_rigid_trans_vel_new[struct_no][0], NDIM);
-            Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
-            for (int d = 0; d < NDIM; ++d)
-            {
-                if (calculate_trans_mom[d])
-                    d_rigid_trans_vel_new[struct_no][d] /= struct_param.getTotalNodes();
-                else
-                    d_rigid_trans_vel_new[struct_no][d] = 0.0;
-            }
-        }
-    }
-
-    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_trans_vel && (d_timestep_counter % d_output_interval) == 0)
-    {
-        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-        {
-            *d_trans_vel_stream[struct_no]
-                << d_FuRMoRP_new_time << '\t' << d_rigid_trans_vel_new[struct_no][0] << '\t'
-                << d_rigid_trans_vel_new[struct_no][1] << '\t' << d_rigid_trans_vel_new[struct_no][2] << '\t'
-                << d_vel_com_def_new[struct_no][0] << '\t' << d_vel_com_def_new[struct_no][1] << '\t'
-                << d_vel_com_def_new[struct_no][2] << std::endl;
-        }
-    }
-
     return;
 
 } // calculateRigidTranslationalMomentum
@@ -1503,12 +1524,54 @@ void ConstraintIBMethod::calculateRigidRotationalMomentum()
         d_l_data_X_half_Euler[ln]->restoreArrays();
     } // all levels
 
+    return;
+
+} // calculateRigidRotationalMomentum
+
+void ConstraintIBMethod::finalizeRigidMomentum()
+{
+    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
+
+    // Sum the rigid translational and rotational momentum of all structures in
+    // a single reduction.
+    std::vector<std::vector<std::vector<double> >*> rigid_mom_data;
+    rigid_mom_data.push_back(&d_rigid_trans_vel_new);
+    rigid_mom_data.push_back(&d_rigid_rot_vel_new);
+    sumReduceStructureData(rigid_mom_data, 3);
+
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfTranslating())
+        {
+            Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
+            for (int d = 0; d < NDIM; ++d)
+            {
+                if (calculate_trans_mom[d])
+                    d_rigid_trans_vel_new[struct_no][d] /= struct_param.getTotalNodes();
+                else
+                    d_rigid_trans_vel_new[struct_no][d] = 0.0;
+            }
+        }
+    }
+
+    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_trans_vel && (d_timestep_counter % d_output_interval) == 0)
+    {
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+        {
+            *d_trans_vel_stream[struct_no]
+                << d_FuRMoRP_new_time << '\t' << d_rigid_trans_vel_new[struct_no][0] << '\t'
+                << d_rigid_trans_vel_new[struct_no][1] << '\t' << d_rigid_trans_vel_new[struct_no][2] << '\t'
+                << d_vel_com_def_new[struct_no][0] << '\t' << d_vel_com_def_new[struct_no][1] << '\t'
+                << d_vel_com_def_new[struct_no][2] << std::endl;
+        }
+    }
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
@@ -1537,7 +1600,7 @@ void ConstraintIBMethod::calculateRigidRotationalMomentum()
 
     return;
 
-} // calculateRigidRotationalMomentum
+} // finalizeRigidMomentum
 
 void ConstraintIBMethod::calculateCurrentLagrangianVelocity()
 {
@@ -2215,14 +2278,11 @@ void ConstraintIBMethod::calculateMidPointVelocity()
 
 } // calculateMidPointVelocity
 
-void ConstraintIBMethod::calculateDrag()
+void ConstraintIBMethod::calculateDrag(std::vector<std::vector<double> >& inertia_force,
+                                       std::vector<std::vector<double> >& constraint_force)
 {
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
-
-    std::vector<std::vector<double> > inertia_force(d_no_structures, std::vector<double>(3, 0.0));
-    std::vector<std::vector<double> > constraint_force(d_no_structures, std::vector<double>(3, 0.0));
 
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -2272,39 +2332,14 @@ void ConstraintIBMethod::calculateDrag()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        SAMRAI_MPI::sumReduction(&inertia_force[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_force[struct_no][0], 3);
-        for (int d = 0; d < NDIM; ++d)
-        {
-            inertia_force[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
-            constraint_force[struct_no][d] *= (d_rho_fluid / dt);
-        }
-    }
-
-    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_drag && (d_timestep_counter % d_output_interval) == 0)
-    {
-        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-        {
-            *d_drag_force_stream[struct_no]
-                << d_FuRMoRP_new_time << '\t' << inertia_force[struct_no][0] << '\t' << inertia_force[struct_no][1]
-                << '\t' << inertia_force[struct_no][2] << '\t' << constraint_force[struct_no][0] << '\t'
-                << constraint_force[struct_no][1] << '\t' << constraint_force[struct_no][2] << std::endl;
-        }
-    }
-
     return;
 } // calculateDrag
 
-void ConstraintIBMethod::calculateTorque()
+void ConstraintIBMethod::calculateTorque(std::vector<std::vector<double> >& inertia_torque,
+                                         std::vector<std::vector<double> >& constraint_torque)
 {
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
-
-    std::vector<std::vector<double> > inertia_torque(d_no_structures, std::vector<double>(3, 0.0));
-    std::vector<std::vector<double> > constraint_torque(d_no_structures, std::vector<double>(3, 0.0));
     double R_cross_U_inertia[3] = { 0.0 }, R_cross_U_constraint[3] = { 0.0 };
 
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
@@ -2381,39 +2416,14 @@ void ConstraintIBMethod::calculateTorque()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        SAMRAI_MPI::sumReduction(&inertia_torque[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_torque[struct_no][0], 3);
-        for (int d = 0; d < NDIM; ++d)
-        {
-            inertia_torque[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
-            constraint_torque[struct_no][d] *= (d_rho_fluid / dt);
-        }
-    }
-
-    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_torque && (d_timestep_counter % d_output_interval) == 0)
-    {
-        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-        {
-            *d_torque_stream[struct_no] << d_FuRMoRP_new_time << '\t' << inertia_torque[struct_no][0] << '\t'
-                                        << inertia_torque[struct_no][1] << '\t' << inertia_torque[struct_no][2] << '\t'
-                                        << constraint_torque[struct_no][0] << '\t' << constraint_torque[struct_no][1]
-                                        << '\t' << constraint_torque[struct_no][2] << std::endl;
-        }
-    }
-
     return;
 } // calculateTorque
 
-void ConstraintIBMethod::calculatePower()
+void ConstraintIBMethod::calculatePower(std::vector<std::vector<double> >& inertia_power,
+                                        std::vector<std::vector<double> >& constraint_power)
 {
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
-
-    std::vector<std::vector<double> > inertia_power(d_no_structures, std::vector<double>(3, 0.0));
-    std::vector<std::vector<double> > constraint_power(d_no_structures, std::vector<double>(3, 0.0));
 
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -2463,10 +2473,86 @@ void ConstraintIBMethod::calculatePower()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    return;
+} // calculatePower
+
+void ConstraintIBMethod::calculateStructureDiagnostics()
+{
+    const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
+
+    std::vector<std::vector<double> > inertia_force(d_no_structures, std::vector<double>(3, 0.0));
+    std::vector<std::vector<double> > constraint_force(d_no_structures, std::vector<double>(3, 0.0));
+    std::vector<std::vector<double> > inertia_torque(d_no_structures, std::vector<double>(3, 0.0));
+    std::vector<std::vector<double> > constraint_torque(d_no_structures, std::vector<double>(3, 0.0));
+    std::vector<std::vector<double> > inertia_power(d_no_structures, std::vector<double>(3, 0.0));
+    std::vector<std::vector<double> > constraint_power(d_no_structures, std::vector<double>(3, 0.0));
+
+    // Accumulate the local contributions to the requested diagnostics.
+    std::vector<std::vector<std::vector<double> >*> diagnostic_data;
+    if (d_output_drag)
+    {
+        calculateDrag(inertia_force, constraint_force);
+        diagnostic_data.push_back(&inertia_force);
+        diagnostic_data.push_back(&constraint_force);
+    }
+    if (d_output_torque)
+    {
+        calculateTorque(inertia_torque, constraint_torque);
+        diagnostic_data.push_back(&inertia_torque);
+        diagnostic_data.push_back(&constraint_torque);
+    }
+    if (d_output_power)
+    {
+        calculatePower(inertia_power, constraint_power);
+        diagnostic_data.push_back(&inertia_power);
+        diagnostic_data.push_back(&constraint_power);
+    }
+
+    // Sum the diagnostics of all structures in a single reduction.
+    sumReduceStructureData(diagnostic_data, 3);
+
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        for (int d = 0; d < NDIM; ++d)
+        {
+            inertia_force[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
+            constraint_force[struct_no][d] *= (d_rho_fluid / dt);
+        }
+    }
+
+    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_drag && (d_timestep_counter % d_output_interval) == 0)
+    {
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+        {
+            *d_drag_force_stream[struct_no]
+                << d_FuRMoRP_new_time << '\t' << inertia_force[struct_no][0] << '\t' << inertia_force[struct_no][1]
+                << '\t' << inertia_force[struct_no][2] << '\t' << constraint_force[struct_no][0] << '\t'
+                << constraint_force[struct_no][1] << '\t' << constraint_force[struct_no][2] << std::endl;
+        }
+    }
+
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        for (int d = 0; d < NDIM; ++d)
+        {
+            inertia_torque[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
+            constraint_torque[struct_no][d] *= (d_rho_fluid / dt);
+        }
+    }
+
+    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_torque && (d_timestep_counter % d_output_interval) == 0)
+    {
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+        {
+            *d_torque_stream[struct_no] << d_FuRMoRP_new_time << '\t' << inertia_torque[struct_no][0] << '\t'
+                                        << inertia_torque[struct_no][1] << '\t' << inertia_torque[struct_no][2] << '\t'
+                                        << constraint_torque[struct_no][0] << '\t' << constraint_torque[struct_no][1]
+                                        << '\t' << constraint_torque[struct_no][2] << std::endl;
+        }
+    }
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_power[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_power[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_power[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
@@ -2474,7 +2560,7 @@ void ConstraintIBMethod::calculatePower()
         }
     }
 
-    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_drag && (d_timestep_counter % d_output_interval) == 0)
+    if (!SAMRAI_MPI::getRank() && d_print_output && d_output_power && (d_timestep_counter % d_output_interval) == 0)
     {
         for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
         {
@@ -2486,6 +2572,6 @@ void ConstraintIBMethod::calculatePower()
     }
 
     return;
-} // calculatePower
+} // calculateStructureDiagnostics
 
 } // IBAMR
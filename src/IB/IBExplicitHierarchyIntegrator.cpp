@@ -99,9 +99,36 @@ IBExplicitHierarchyIntegrator::IBExplicitHierarchyIntegrator(const std::string&
                                                              bool register_for_restart)
     : IBHierarchyIntegrator(object_name, input_db, ib_method_ops, ins_hier_integrator, register_for_restart)
 {
+    // Set some default values.
+    d_num_lagrangian_substeps = 1;
+    d_overlap_lagrangian_force = false;
+    d_cycle_force_is_precomputed = false;
+
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
     if (from_restart) getFromRestart();
+    if (input_db && input_db->keyExists("num_lagrangian_substeps"))
+    {
+        d_num_lagrangian_substeps = input_db->getInteger("num_lagrangian_substeps");
+    }
+    if (input_db && input_db->keyExists("overlap_lagrangian_force"))
+    {
+        d_overlap_lagrangian_force = input_db->getBool("overlap_lagrangian_force");
+    }
+
+    // Check the choice of the number of Lagrangian substeps.
+    if (d_num_lagrangian_substeps < 1)
+    {
+        TBOX_ERROR(d_object_name << "::IBExplicitHierarchyIntegrator():\n"
+                                 << "  num_lagrangian_substeps = " << d_num_lagrangian_substeps
+                                 << " but num_lagrangian_substeps must be >= 1\n");
+    }
+    if (d_num_lagrangian_substeps > 1 && d_time_stepping_type != MIDPOINT_RULE)
+    {
+        TBOX_ERROR(d_object_name << "::IBExplicitHierarchyIntegrator():\n"
+                                 << "  num_lagrangian_substeps = " << d_num_lagrangian_substeps
+                                 << " requires time_stepping_type = MIDPOINT_RULE\n");
+    }
     return;
 } // IBExplicitHierarchyIntegrator
 
@@ -173,6 +200,50 @@ void IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double cu
                                     "use the same number of cycles,\n"
                                  << "  or that the IB solver use only a single cycle.\n");
     }
+
+    // When requested, compute all of the Lagrangian forces that depend only on
+    // known positions before initializing the fluid solver, and overlap the
+    // communication required to spread those forces with the initialization
+    // of the fluid solver.
+    //
+    // NOTE: The forces are computed in a different order than usual, but all
+    // of the forces computed here depend only on the current positions or on
+    // the forward Euler prediction of the updated positions.
+    d_cycle_force_is_precomputed = false;
+    const bool predict_positions = (d_time_stepping_type == MIDPOINT_RULE || d_time_stepping_type == TRAPEZOIDAL_RULE);
+    if (d_overlap_lagrangian_force)
+    {
+        if (predict_positions && num_cycles == 1)
+        {
+            if (d_enable_logging)
+                plog << d_object_name << "::preprocessIntegrateHierarchy(): performing Lagrangian "
+                                         "forward Euler step\n";
+            d_ib_method_ops->eulerStep(current_time, new_time);
+        }
+        if (d_time_stepping_type == FORWARD_EULER || d_time_stepping_type == TRAPEZOIDAL_RULE)
+        {
+            if (d_enable_logging)
+                plog << d_object_name << "::preprocessIntegrateHierarchy(): computing Lagrangian force\n";
+            startTelemetryPhase("lagrangian_force");
+            d_ib_method_ops->computeLagrangianForce(current_time);
+            d_ib_method_ops->beginSpreadForce(current_time);
+            stopTelemetryPhase("lagrangian_force");
+        }
+        if (predict_positions && num_cycles == 1 && d_num_lagrangian_substeps == 1)
+        {
+            const double data_time =
+                (d_time_stepping_type == MIDPOINT_RULE ? current_time + 0.5 * (new_time - current_time) : new_time);
+            if (d_enable_logging)
+                plog << d_object_name << "::preprocessIntegrateHierarchy(): computing Lagrangian force\n";
+            startTelemetryPhase("lagrangian_force");
+            d_ib_method_ops->computeLagrangianForce(data_time);
+            d_ib_method_ops->beginSpreadForce(data_time);
+            stopTelemetryPhase("lagrangian_force");
+            d_cycle_force_is_precomputed = true;
+        }
+    }
+
+    // Prepare the fluid solver to advance the data.
     d_ins_hier_integrator->preprocessIntegrateHierarchy(current_time, new_time, ins_num_cycles);
 
     // Compute the Lagrangian forces and spread them to the Eulerian grid.
@@ -180,15 +251,23 @@ void IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double cu
     {
     case FORWARD_EULER:
     case TRAPEZOIDAL_RULE:
-        if (d_enable_logging) plog << d_object_name << "::preprocessIntegrateHierarchy(): computing Lagrangian force\n";
-        d_ib_method_ops->computeLagrangianForce(current_time);
+        if (!d_overlap_lagrangian_force)
+        {
+            if (d_enable_logging)
+                plog << d_object_name << "::preprocessIntegrateHierarchy(): computing Lagrangian force\n";
+            startTelemetryPhase("lagrangian_force");
+            d_ib_method_ops->computeLagrangianForce(current_time);
+            stopTelemetryPhase("lagrangian_force");
+        }
         if (d_enable_logging)
             plog << d_object_name << "::preprocessIntegrateHierarchy(): spreading Lagrangian force "
                                      "to the Eulerian grid\n";
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
         d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
+        startTelemetryPhase("spread");
         d_ib_method_ops->spreadForce(
             d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), current_time);
+        stopTelemetryPhase("spread");
         d_hier_velocity_data_ops->copyData(d_f_current_idx, d_f_idx);
         break;
     case MIDPOINT_RULE:
@@ -214,7 +293,7 @@ void IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double cu
         break;
     case MIDPOINT_RULE:
     case TRAPEZOIDAL_RULE:
-        if (num_cycles == 1)
+        if (num_cycles == 1 && !d_overlap_lagrangian_force)
         {
             if (d_enable_logging)
                 plog << d_object_name << "::preprocessIntegrateHierarchy(): performing Lagrangian "
@@ -263,14 +342,51 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         }
         break;
     case MIDPOINT_RULE:
-        if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
-        d_ib_method_ops->computeLagrangianForce(half_time);
+        if (d_num_lagrangian_substeps > 1)
+        {
+            if (d_enable_logging)
+                plog << d_object_name << "::integrateHierarchy(): computing time-averaged Lagrangian force using "
+                     << d_num_lagrangian_substeps << " substeps\n";
+
+            // The first cycle advances the structure using the velocity at the
+            // beginning of the time step.  Subsequent cycles use the midpoint
+            // approximation to the velocity computed by the preceding cycle, so
+            // that each cycle improves the prediction of the structure motion.
+            if (cycle_num > 0)
+            {
+                d_hier_velocity_data_ops->linearSum(d_u_idx, 0.5, u_current_idx, 0.5, u_new_idx);
+            }
+            else
+            {
+                d_hier_velocity_data_ops->copyData(d_u_idx, u_current_idx);
+            }
+            d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
+            startTelemetryPhase("lagrangian_force");
+            d_ib_method_ops->computeSubcycledLagrangianForce(
+                d_u_idx,
+                getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
+                getGhostfillRefineSchedules(d_object_name + "::u"),
+                current_time,
+                new_time,
+                d_num_lagrangian_substeps);
+            stopTelemetryPhase("lagrangian_force");
+        }
+        else if (!d_cycle_force_is_precomputed)
+        {
+            if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+            startTelemetryPhase("lagrangian_force");
+            d_ib_method_ops->computeLagrangianForce(half_time);
+            stopTelemetryPhase("lagrangian_force");
+        }
         if (d_enable_logging)
             plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
         d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
+        startTelemetryPhase("spread");
         d_ib_method_ops->spreadForce(
             d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time);
+        stopTelemetryPhase("spread");
+        d_cycle_force_is_precomputed = false;
         break;
     case TRAPEZOIDAL_RULE:
         if (d_current_num_cycles == 1 || cycle_num > 0)
@@ -279,16 +395,25 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
             // force computed here would be the same as that computed above
             // in preprocessIntegrateHierarchy(), so we don't bother to
             // recompute it.
-            if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
-            d_ib_method_ops->computeLagrangianForce(new_time);
+            if (!d_cycle_force_is_precomputed)
+            {
+                if (d_enable_logging)
+                    plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+                startTelemetryPhase("lagrangian_force");
+                d_ib_method_ops->computeLagrangianForce(new_time);
+                stopTelemetryPhase("lagrangian_force");
+            }
             if (d_enable_logging)
                 plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force "
                                          "to the Eulerian grid\n";
             d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
             d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
+            startTelemetryPhase("spread");
             d_ib_method_ops->spreadForce(
                 d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), new_time);
+            stopTelemetryPhase("spread");
             d_hier_velocity_data_ops->linearSum(d_f_idx, 0.5, d_f_current_idx, 0.5, d_f_idx);
+            d_cycle_force_is_precomputed = false;
         }
         break;
     default:
@@ -314,6 +439,7 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
     }
 
     // Solve the incompressible Navier-Stokes equations.
+    startTelemetryPhase("ins_solve");
     d_ib_method_ops->preprocessSolveFluidEquations(current_time, new_time, cycle_num);
     if (d_enable_logging)
         plog << d_object_name << "::integrateHierarchy(): solving the incompressible Navier-Stokes equations\n";
@@ -333,6 +459,7 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         }
     }
     d_ib_method_ops->postprocessSolveFluidEquations(current_time, new_time, cycle_num);
+    stopTelemetryPhase("ins_solve");
 
     // Interpolate the Eulerian velocity to the curvilinear mesh.
     switch (d_time_stepping_type)
@@ -346,10 +473,12 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
             plog << d_object_name << "::integrateHierarchy(): interpolating Eulerian velocity to "
                                      "the Lagrangian mesh\n";
         d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
+        startTelemetryPhase("interp");
         d_ib_method_ops->interpolateVelocity(d_u_idx,
                                              getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                              getGhostfillRefineSchedules(d_object_name + "::u"),
                                              half_time);
+        stopTelemetryPhase("interp");
         break;
     case TRAPEZOIDAL_RULE:
         d_hier_velocity_data_ops->copyData(d_u_idx, u_new_idx);
@@ -357,10 +486,12 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
             plog << d_object_name << "::integrateHierarchy(): interpolating Eulerian velocity to "
                                      "the Lagrangian mesh\n";
         d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
+        startTelemetryPhase("interp");
         d_ib_method_ops->interpolateVelocity(d_u_idx,
                                              getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                              getGhostfillRefineSchedules(d_object_name + "::u"),
                                              new_time);
+        stopTelemetryPhase("interp");
         break;
     default:
         TBOX_ERROR(d_object_name << "::integrateHierarchy():\n"
@@ -526,6 +657,13 @@ void IBExplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchH
     // Setup the fluid solver for explicit coupling.
     d_ins_hier_integrator->registerBodyForceFunction(new IBEulerianForceFunction(this));
 
+    // Register the phases of the time step that are recorded by the
+    // performance telemetry object.
+    registerTelemetryPhase("lagrangian_force");
+    registerTelemetryPhase("spread");
+    registerTelemetryPhase("ins_solve");
+    registerTelemetryPhase("interp");
+
     // Finish initializing the hierarchy integrator.
     IBHierarchyIntegrator::initializeHierarchyIntegrator(hierarchy, gridding_alg);
     return;
@@ -64,6 +64,7 @@
 #include "VariableDatabase.h"
 #include "boost/multi_array.hpp"
 #include "ibamr/IBFEMethod.h"
+#include "ibamr/IBHierarchyIntegrator.h"
 #include "ibamr/INSHierarchyIntegrator.h"
 #include "ibamr/StokesSpecifications.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
@@ -72,6 +73,7 @@
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadReport.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 #include "libmesh/auto_ptr.h"
@@ -883,6 +885,18 @@ void IBFEMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
         {
             d_fe_data_managers[part]->reinitElementMappings();
         }
+
+        // Report the distribution of the element quadrature points.
+        Pointer<WorkloadReport> workload_report = d_ib_solver->getWorkloadReport();
+        if (workload_report)
+        {
+            for (unsigned int part = 0; part < d_num_parts; ++part)
+            {
+                workload_report->addLevelCount("fe_quad_points",
+                                               d_fe_data_managers[part]->getLevelNumber(),
+                                               d_fe_data_managers[part]->getNumberOfLocalQuadPoints());
+            }
+        }
     }
     return;
 } // endDataRedistribution
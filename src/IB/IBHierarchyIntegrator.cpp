@@ -73,7 +73,9 @@
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/LMarkerSetVariable.h"
 #include "ibtk/LMarkerUtilities.h"
+#include "ibtk/PatchDataMemoryManager.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadReport.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
@@ -206,6 +208,7 @@ void IBHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy
     if (d_time_stepping_type == TRAPEZOIDAL_RULE)
     {
         d_f_current_idx = var_db->registerClonedPatchDataIndex(d_f_var, d_f_idx);
+        PatchDataMemoryManager::getManager()->registerPatchDataOwner(d_f_current_idx, d_object_name);
     }
     else
     {
@@ -429,6 +432,15 @@ void IBHierarchyIntegrator::regridHierarchy()
     if (d_enable_logging) plog << d_object_name << "::regridHierarchy(): finishing Lagrangian data movement\n";
     d_ib_method_ops->endDataRedistribution(d_hierarchy, d_gridding_alg);
 
+    // Provide updated workload estimates to the workload report.
+    Pointer<WorkloadReport> workload_report = getWorkloadReport();
+    if (workload_report && d_load_balancer)
+    {
+        d_hier_cc_data_ops->setToScalar(d_workload_idx, 1.0);
+        d_ib_method_ops->updateWorkloadEstimates(d_hierarchy, d_workload_idx);
+        workload_report->setWorkloadDataIndex(d_workload_idx);
+    }
+
     // Prune any duplicated markers located in the "invalid" regions of coarser
     // levels of the patch hierarchy.
     if (d_mark_var)
@@ -478,6 +490,7 @@ IBHierarchyIntegrator::IBHierarchyIntegrator(const std::string& object_name,
     d_time_stepping_type = MIDPOINT_RULE;
     d_regrid_cfl_interval = 0.0;
     d_regrid_cfl_estimate = 0.0;
+    d_lag_cfl_max = 0.0;
     d_error_on_dt_change = true;
     d_warn_on_dt_change = false;
 
@@ -492,6 +505,16 @@ IBHierarchyIntegrator::IBHierarchyIntegrator(const std::string& object_name,
     return;
 } // IBHierarchyIntegrator
 
+double IBHierarchyIntegrator::getMaximumTimeStepSizeSpecialized()
+{
+    double dt = HierarchyIntegrator::getMaximumTimeStepSizeSpecialized();
+    if (d_lag_cfl_max > 0.0)
+    {
+        dt = std::min(dt, d_lag_cfl_max * d_ib_method_ops->getStableTimestep());
+    }
+    return dt;
+} // getMaximumTimeStepSizeSpecialized
+
 bool IBHierarchyIntegrator::atRegridPointSpecialized() const
 {
     const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
@@ -605,6 +628,7 @@ void IBHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
 void IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
 {
     if (db->keyExists("regrid_cfl_interval")) d_regrid_cfl_interval = db->getDouble("regrid_cfl_interval");
+    if (db->keyExists("lagrangian_cfl_max")) d_lag_cfl_max = db->getDouble("lagrangian_cfl_max");
     if (db->keyExists("error_on_dt_change"))
         d_error_on_dt_change = db->getBool("error_on_dt_change");
     else if (db->keyExists("error_on_timestep_change"))
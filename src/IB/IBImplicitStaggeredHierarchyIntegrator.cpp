@@ -125,15 +125,35 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
     // operators.
     d_ib_implicit_ops->setUseFixedLEOperators(true);
 
+    // Set some default values.
+    d_snes = NULL;
+    d_jac = NULL;
+    d_schur = NULL;
+    d_schur_solver = NULL;
+    d_schur_pc_mat = NULL;
+    d_use_schur_pc = false;
+    d_jacobian_lag = 1;
+
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
     if (from_restart) getFromRestart();
+    if (input_db)
+    {
+        if (input_db->keyExists("jacobian_lag")) d_jacobian_lag = input_db->getInteger("jacobian_lag");
+        if (input_db->keyExists("use_schur_preconditioner"))
+            d_use_schur_pc = input_db->getBool("use_schur_preconditioner");
+    }
+    if (d_jacobian_lag < 1)
+    {
+        TBOX_ERROR(d_object_name << "::IBImplicitStaggeredHierarchyIntegrator():\n"
+                                 << "  jacobian_lag = " << d_jacobian_lag << " but jacobian_lag must be >= 1\n");
+    }
     return;
 } // IBImplicitStaggeredHierarchyIntegrator
 
 IBImplicitStaggeredHierarchyIntegrator::~IBImplicitStaggeredHierarchyIntegrator()
 {
-    // intentionally blank
+    deallocateSolvers();
     return;
 } // ~IBImplicitStaggeredHierarchyIntegrator
 
@@ -199,7 +219,6 @@ void IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy(const double cur
     TBOX_ASSERT(ins_hier_integrator);
 
     PetscErrorCode ierr;
-    int n_local;
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -277,71 +296,10 @@ void IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy(const double cur
     // Solve the implicit IB equations.
     d_ib_implicit_ops->preprocessSolveFluidEquations(current_time, new_time, cycle_num);
 
-    SNES snes;
-    ierr = SNESCreate(PETSC_COMM_WORLD, &snes);
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESSetFunction(snes, composite_res_petsc_vec, compositeIBFunction_SAMRAI, this);
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESSetOptionsPrefix(snes, "ib_");
-    IBTK_CHKERRQ(ierr);
-
-    Mat jac;
-    ierr = VecGetLocalSize(composite_sol_petsc_vec, &n_local);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatCreateShell(PETSC_COMM_WORLD, n_local, n_local, PETSC_DETERMINE, PETSC_DETERMINE, this, &jac);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatShellSetOperation(jac, MATOP_MULT, reinterpret_cast<void (*)(void)>(compositeIBJacobianApply_SAMRAI));
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESSetJacobian(snes, jac, jac, compositeIBJacobianSetup_SAMRAI, this);
-    IBTK_CHKERRQ(ierr);
-
-    Mat schur;
-    ierr = VecGetLocalSize(lag_sol_petsc_vec, &n_local);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatCreateShell(PETSC_COMM_WORLD, n_local, n_local, PETSC_DETERMINE, PETSC_DETERMINE, this, &schur);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatShellSetOperation(schur, MATOP_MULT, reinterpret_cast<void (*)(void)>(lagrangianSchurApply_SAMRAI));
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPCreate(PETSC_COMM_WORLD, &d_schur_solver);
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPSetOptionsPrefix(d_schur_solver, "ib_schur_");
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPSetOperators(d_schur_solver, schur, schur, SAME_PRECONDITIONER);
-    IBTK_CHKERRQ(ierr);
-    PC schur_pc;
-    ierr = KSPGetPC(d_schur_solver, &schur_pc);
-    IBTK_CHKERRQ(ierr);
-    ierr = PCSetType(schur_pc, PCNONE);
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPSetFromOptions(d_schur_solver);
-    IBTK_CHKERRQ(ierr);
-
-    KSP snes_ksp;
-    ierr = SNESGetKSP(snes, &snes_ksp);
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPSetType(snes_ksp, KSPFGMRES);
-    IBTK_CHKERRQ(ierr);
-    PC snes_pc;
-    ierr = KSPGetPC(snes_ksp, &snes_pc);
-    IBTK_CHKERRQ(ierr);
-    ierr = PCSetType(snes_pc, PCSHELL);
-    IBTK_CHKERRQ(ierr);
-    ierr = PCShellSetContext(snes_pc, this);
-    IBTK_CHKERRQ(ierr);
-    ierr = PCShellSetApply(snes_pc, compositeIBPCApply_SAMRAI);
-    IBTK_CHKERRQ(ierr);
-
-    ierr = SNESSetFromOptions(snes);
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESSolve(snes, composite_rhs_petsc_vec, composite_sol_petsc_vec);
+    initializeSolvers(composite_sol_petsc_vec, lag_sol_petsc_vec);
+    ierr = SNESSetFunction(d_snes, composite_res_petsc_vec, compositeIBFunction_SAMRAI, this);
     IBTK_CHKERRQ(ierr);
-    ierr = SNESDestroy(&snes);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatDestroy(&jac);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatDestroy(&schur);
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPDestroy(&d_schur_solver);
+    ierr = SNESSolve(d_snes, composite_rhs_petsc_vec, composite_sol_petsc_vec);
     IBTK_CHKERRQ(ierr);
 
     d_ib_implicit_ops->postprocessSolveFluidEquations(current_time, new_time, cycle_num);
@@ -485,6 +443,16 @@ int IBImplicitStaggeredHierarchyIntegrator::getNumberOfCycles() const
     return d_ins_hier_integrator->getNumberOfCycles();
 } // getNumberOfCycles
 
+void IBImplicitStaggeredHierarchyIntegrator::regridHierarchy()
+{
+    // The solver objects retain work vectors that are defined on the current
+    // patch hierarchy and Lagrangian data layout, so they must be deallocated
+    // before the hierarchy is regridded.
+    deallocateSolvers();
+    IBHierarchyIntegrator::regridHierarchy();
+    return;
+} // regridHierarchy
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void IBImplicitStaggeredHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
@@ -518,6 +486,191 @@ void IBImplicitStaggeredHierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+void IBImplicitStaggeredHierarchyIntegrator::initializeSolvers(Vec composite_sol_petsc_vec, Vec lag_sol_petsc_vec)
+{
+    PetscErrorCode ierr;
+    int n_local, schur_n_local;
+    ierr = VecGetLocalSize(composite_sol_petsc_vec, &n_local);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGetLocalSize(lag_sol_petsc_vec, &schur_n_local);
+    IBTK_CHKERRQ(ierr);
+
+    // Reuse the solver objects from the previous time step unless the layout
+    // of the solution vectors has changed.
+    if (d_snes)
+    {
+        int jac_n_local, schur_jac_n_local;
+        ierr = MatGetLocalSize(d_jac, &jac_n_local, NULL);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatGetLocalSize(d_schur, &schur_jac_n_local, NULL);
+        IBTK_CHKERRQ(ierr);
+        const bool layout_has_changed =
+            SAMRAI_MPI::maxReduction((jac_n_local != n_local || schur_jac_n_local != schur_n_local) ? 1 : 0) != 0;
+        if (!layout_has_changed) return;
+        deallocateSolvers();
+    }
+
+    ierr = SNESCreate(PETSC_COMM_WORLD, &d_snes);
+    IBTK_CHKERRQ(ierr);
+    ierr = SNESSetOptionsPrefix(d_snes, "ib_");
+    IBTK_CHKERRQ(ierr);
+
+    ierr = MatCreateShell(PETSC_COMM_WORLD, n_local, n_local, PETSC_DETERMINE, PETSC_DETERMINE, this, &d_jac);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatShellSetOperation(d_jac, MATOP_MULT, reinterpret_cast<void (*)(void)>(compositeIBJacobianApply_SAMRAI));
+    IBTK_CHKERRQ(ierr);
+    ierr = SNESSetJacobian(d_snes, d_jac, d_jac, compositeIBJacobianSetup_SAMRAI, this);
+    IBTK_CHKERRQ(ierr);
+    ierr = SNESSetLagJacobian(d_snes, d_jacobian_lag);
+    IBTK_CHKERRQ(ierr);
+
+    ierr = MatCreateShell(
+        PETSC_COMM_WORLD, schur_n_local, schur_n_local, PETSC_DETERMINE, PETSC_DETERMINE, this, &d_schur);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatShellSetOperation(d_schur, MATOP_MULT, reinterpret_cast<void (*)(void)>(lagrangianSchurApply_SAMRAI));
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPCreate(PETSC_COMM_WORLD, &d_schur_solver);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetOptionsPrefix(d_schur_solver, "ib_schur_");
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetOperators(d_schur_solver, d_schur, d_schur, SAME_PRECONDITIONER);
+    IBTK_CHKERRQ(ierr);
+    if (!d_use_schur_pc)
+    {
+        PC schur_pc;
+        ierr = KSPGetPC(d_schur_solver, &schur_pc);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCSetType(schur_pc, PCNONE);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = KSPSetFromOptions(d_schur_solver);
+    IBTK_CHKERRQ(ierr);
+
+    KSP snes_ksp;
+    ierr = SNESGetKSP(d_snes, &snes_ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetType(snes_ksp, KSPFGMRES);
+    IBTK_CHKERRQ(ierr);
+    PC snes_pc;
+    ierr = KSPGetPC(snes_ksp, &snes_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCSetType(snes_pc, PCSHELL);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCShellSetContext(snes_pc, this);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCShellSetApply(snes_pc, compositeIBPCApply_SAMRAI);
+    IBTK_CHKERRQ(ierr);
+
+    ierr = SNESSetFromOptions(d_snes);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // initializeSolvers
+
+void IBImplicitStaggeredHierarchyIntegrator::deallocateSolvers()
+{
+    PetscErrorCode ierr;
+    if (d_snes)
+    {
+        ierr = SNESDestroy(&d_snes);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_jac)
+    {
+        ierr = MatDestroy(&d_jac);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_schur)
+    {
+        ierr = MatDestroy(&d_schur);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_schur_solver)
+    {
+        ierr = KSPDestroy(&d_schur_solver);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_schur_pc_mat)
+    {
+        ierr = MatDestroy(&d_schur_pc_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_snes = NULL;
+    d_jac = NULL;
+    d_schur = NULL;
+    d_schur_solver = NULL;
+    d_schur_pc_mat = NULL;
+    return;
+} // deallocateSolvers
+
+void IBImplicitStaggeredHierarchyIntegrator::updateSchurPreconditioner(Vec X)
+{
+    PetscErrorCode ierr;
+    Mat A = d_ib_implicit_ops->getLinearizedForceJacobian();
+    if (!A)
+    {
+        TBOX_ERROR(d_object_name << "::updateSchurPreconditioner():\n"
+                                 << "  use_schur_preconditioner = TRUE requires an assembled Lagrangian force "
+                                    "Jacobian;\n"
+                                 << "  set use_assembled_force_jacobian = TRUE for the IB method object.\n");
+    }
+
+    // The Schur complement is Sc = I-dt*J*inv(L)*S*A/4.  It is approximated by
+    // P = I-beta*A, in which beta is determined by a least-squares fit of
+    // (I-Sc)*w = beta*A*w for a random vector w with zero mean.  Because w has
+    // zero mean, the fit primarily captures the diagonal of J*inv(L)*S.
+    Vec w, Sc_w, A_w;
+    ierr = VecDuplicate(X, &w);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDuplicate(X, &Sc_w);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDuplicate(X, &A_w);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSetRandom(w, NULL);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecShift(w, -0.5);
+    IBTK_CHKERRQ(ierr);
+    lagrangianSchurApply(w, Sc_w);
+    ierr = VecAYPX(Sc_w, -1.0, w);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatMult(A, w, A_w);
+    IBTK_CHKERRQ(ierr);
+    double num, den;
+    ierr = VecDot(Sc_w, A_w, &num);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDot(A_w, A_w, &den);
+    IBTK_CHKERRQ(ierr);
+    const double beta = (den > 0.0 ? num / den : 0.0);
+    ierr = VecDestroy(&w);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&Sc_w);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&A_w);
+    IBTK_CHKERRQ(ierr);
+    if (d_enable_logging)
+        plog << d_object_name << "::updateSchurPreconditioner(): Schur complement scaling = " << beta << "\n";
+
+    // Assemble the approximate Schur complement.  The matrix is allocated once
+    // per layout of the Lagrangian data and is refilled whenever the Jacobian
+    // is updated, so that the setup of the preconditioner is reused across
+    // nonlinear iterations when the Jacobian is lagged.
+    if (!d_schur_pc_mat)
+    {
+        ierr = MatDuplicate(A, MAT_DO_NOT_COPY_VALUES, &d_schur_pc_mat);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatSetOption(d_schur_pc_mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = MatZeroEntries(d_schur_pc_mat);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatAXPY(d_schur_pc_mat, -beta, A, SUBSET_NONZERO_PATTERN);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatShift(d_schur_pc_mat, 1.0);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetOperators(d_schur_solver, d_schur, d_schur_pc_mat, SAME_NONZERO_PATTERN);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // updateSchurPreconditioner
+
 PetscErrorCode IBImplicitStaggeredHierarchyIntegrator::compositeIBFunction_SAMRAI(SNES snes, Vec x, Vec f, void* ctx)
 {
     IBImplicitStaggeredHierarchyIntegrator* ib_integrator = static_cast<IBImplicitStaggeredHierarchyIntegrator*>(ctx);
@@ -611,6 +764,7 @@ PetscErrorCode IBImplicitStaggeredHierarchyIntegrator::compositeIBJacobianSetup(
     IBTK_CHKERRQ(ierr);
     Vec X = component_sol_vecs[1];
     d_ib_implicit_ops->setLinearizedPosition(X);
+    if (d_use_schur_pc) updateSchurPreconditioner(X);
     return 0;
 } // compositeIBJacobianSetup
 
@@ -54,6 +54,11 @@ IBImplicitStrategy::~IBImplicitStrategy()
     return;
 } // ~IBImplicitStrategy
 
+Mat IBImplicitStrategy::getLinearizedForceJacobian()
+{
+    return NULL;
+} // getLinearizedForceJacobian
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
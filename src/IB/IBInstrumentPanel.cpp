@@ -38,7 +38,6 @@
 #include <algorithm>
 #include <fstream>
 #include <limits>
-#include <map>
 #include <string>
 #include <utility>
 #include <vector>
@@ -499,6 +498,29 @@ Vector linear_interp(const Point& X,
     }
     return U;
 } // linear_interp
+
+inline Point getCellCenter(const Index<NDIM>& i,
+                           const Index<NDIM>& patch_lower,
+                           const double* const x_lower,
+                           const double* const dx)
+{
+    return Point(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
+                 x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
+#if (NDIM == 3)
+                     ,
+                 x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
+#endif
+                     );
+} // getCellCenter
+
+int findLocalPatchNumber(const Pointer<PatchLevel<NDIM> > level, const Index<NDIM>& i)
+{
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        if (level->getPatch(p())->getBox().contains(i)) return p();
+    }
+    return -1;
+} // findLocalPatchNumber
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -507,8 +529,8 @@ IBInstrumentPanel::IBInstrumentPanel(const std::string& object_name, Pointer<Dat
     : d_object_name(object_name), d_initialized(false), d_num_meters(0), d_num_perimeter_nodes(), d_X_centroid(),
       d_X_perimeter(), d_X_web(), d_dA_web(), d_instrument_read_timestep_num(-1),
       d_instrument_read_time(std::numeric_limits<double>::quiet_NaN()), d_max_instrument_name_len(-1),
-      d_instrument_names(), d_flow_values(), d_mean_pres_values(), d_point_pres_values(), d_web_patch_map(),
-      d_web_centroid_map(), d_plot_directory_name(NDIM == 2 ? "viz_inst2d" : "viz_inst3d"), d_output_log_file(false),
+      d_instrument_names(), d_flow_values(), d_mean_pres_values(), d_point_pres_values(), d_web_patch_lists(),
+      d_web_centroid_lists(), d_plot_directory_name(NDIM == 2 ? "viz_inst2d" : "viz_inst3d"), d_output_log_file(false),
       d_log_file_name(NDIM == 2 ? "inst2d.log" : "inst3d.log"), d_log_file_stream(), d_flow_conv(1.0), d_pres_conv(1.0),
       d_flow_units(""), d_pres_units("")
 {
@@ -831,8 +853,7 @@ void IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHier
         init_meter_elements(d_X_web[m], d_dA_web[m], d_X_perimeter[m], d_X_centroid[m]);
     }
 
-    // Setup the mappings from cell indices to the web patch and web centroid
-    // data.
+    // Setup the per-patch lists of web patch and web centroid data.
     //
     // NOTE: Each meter web patch/centroid is assigned to precisely one
     // Cartesian grid cell in precisely one level.  In particular, each web
@@ -840,14 +861,17 @@ void IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHier
     // the region of physical space in which the centroid of the web patch is
     // located.  Similarly, each web centroid is assigned to which ever grid
     // cell is the finest cell that contains the region of physical space in
-    // which the web centroid is located.
-    d_web_patch_map.clear();
-    d_web_patch_map.resize(finest_ln + 1);
-    d_web_centroid_map.clear();
-    d_web_centroid_map.resize(finest_ln + 1);
+    // which the web centroid is located.  Only those web patches/centroids that
+    // are located in local patches are stored.
+    d_web_patch_lists.clear();
+    d_web_patch_lists.resize(finest_ln + 1);
+    d_web_centroid_lists.clear();
+    d_web_centroid_lists.resize(finest_ln + 1);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        d_web_patch_lists[ln].resize(level->getNumberOfPatches());
+        d_web_centroid_lists[ln].resize(level->getNumberOfPatches());
         const IntVector<NDIM>& ratio = level->getRatio();
         const Box<NDIM> domain_box_level = Box<NDIM>::refine(domain_box, ratio);
         const Index<NDIM>& domain_box_level_lower = domain_box_level.lower();
@@ -889,11 +913,14 @@ void IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHier
                     if (level->getBoxes().contains(i) &&
                         (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
                     {
+                        const int patch_num = findLocalPatchNumber(level, i);
+                        if (patch_num < 0) continue;
                         WebPatch p;
                         p.meter_num = l;
+                        p.i = i;
                         p.X = &d_X_web[l][m][n];
                         p.dA = &d_dA_web[l][m][n];
-                        d_web_patch_map[ln].insert(std::make_pair(i, p));
+                        d_web_patch_lists[ln][patch_num].push_back(p);
                     }
                 }
             }
@@ -910,10 +937,13 @@ void IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHier
                                                                      finer_domain_box_level_upper);
             if (level->getBoxes().contains(i) && (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
             {
+                const int patch_num = findLocalPatchNumber(level, i);
+                if (patch_num < 0) continue;
                 WebCentroid c;
                 c.meter_num = l;
+                c.i = i;
                 c.X = &d_X_centroid[l];
-                d_web_centroid_map[ln].insert(std::make_pair(i, c));
+                d_web_centroid_lists[ln][patch_num].push_back(c);
             }
         }
     }
@@ -966,6 +996,10 @@ void IBInstrumentPanel::readInstrumentData(const int U_data_idx,
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
+            const std::vector<WebPatch>& web_patches = d_web_patch_lists[ln][p()];
+            const std::vector<WebCentroid>& web_centroids = d_web_centroid_lists[ln][p()];
+            if (web_patches.empty() && web_centroids.empty()) continue;
+
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             const Box<NDIM>& patch_box = patch->getBox();
             const Index<NDIM>& patch_lower = patch_box.lower();
@@ -980,82 +1014,46 @@ void IBInstrumentPanel::readInstrumentData(const int U_data_idx,
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
 
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            for (std::vector<WebPatch>::const_iterator it = web_patches.begin(); it != web_patches.end(); ++it)
             {
-                const Index<NDIM>& i = b();
-                std::pair<WebPatchMap::const_iterator, WebPatchMap::const_iterator> patch_range =
-                    d_web_patch_map[ln].equal_range(i);
-                if (patch_range.first != patch_range.second)
+                const int& meter_num = it->meter_num;
+                const Index<NDIM>& i = it->i;
+                const Point& X = *(it->X);
+                const Vector& dA = *(it->dA);
+                const Point X_cell = getCellCenter(i, patch_lower, x_lower, dx);
+                if (U_cc_data)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                                           );
-                    if (U_cc_data)
-                    {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (U_sc_data)
-                    {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (P_cc_data)
-                    {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pres_values[meter_num] += P * dA.norm();
-                            A[meter_num] += dA.norm();
-                        }
-                    }
+                    const Vector U =
+                        linear_interp<NDIM>(X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_flow_values[meter_num] += U.dot(dA);
+                }
+                if (U_sc_data)
+                {
+                    const Vector U =
+                        linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_flow_values[meter_num] += U.dot(dA);
+                }
+                if (P_cc_data)
+                {
+                    const double P =
+                        linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_mean_pres_values[meter_num] += P * dA.norm();
+                    A[meter_num] += dA.norm();
                 }
+            }
 
-                std::pair<WebCentroidMap::const_iterator, WebCentroidMap::const_iterator> centroid_range =
-                    d_web_centroid_map[ln].equal_range(i);
-                if (centroid_range.first != centroid_range.second)
+            if (P_cc_data)
+            {
+                for (std::vector<WebCentroid>::const_iterator it = web_centroids.begin(); it != web_centroids.end();
+                     ++it)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                                           );
-                    if (P_cc_data)
-                    {
-                        for (WebCentroidMap::const_iterator it = centroid_range.first; it != centroid_range.second;
-                             ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_point_pres_values[meter_num] = P;
-                        }
-                    }
+                    const int& meter_num = it->meter_num;
+                    const Index<NDIM>& i = it->i;
+                    const Point& X = *(it->X);
+                    const Point X_cell = getCellCenter(i, patch_lower, x_lower, dx);
+                    const double P =
+                        linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_point_pres_values[meter_num] = P;
                 }
             }
         }
@@ -34,6 +34,8 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <ostream>
 #include <vector>
 
@@ -51,6 +53,7 @@
 #include "ibtk/LDataManager.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
+#include "ibtk/compiler_hints.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
@@ -398,74 +401,189 @@ void IBKirchhoffRodForceGen::computeLagrangianForceAndTorque(Pointer<LData> F_da
     std::vector<double> F_next_node_vals(NDIM * local_sz, 0.0);
     std::vector<double> N_next_node_vals(NDIM * local_sz, 0.0);
 
-    for (unsigned int k = 0; k < local_sz; ++k)
+    // The segments are processed in blocks.  For each block, the directors and
+    // positions are gathered into contiguous (structure-of-arrays) storage, the
+    // half-step directors and the forces and torques are computed in loops that
+    // do not involve any function calls (and that may therefore be vectorized
+    // by the compiler), and the results are scattered to the per-segment
+    // output arrays.  Each block writes only to its own segments, so that when
+    // threading is enabled, the blocks are processed concurrently.
+    //
+    // The half-step directors are obtained by applying sqrt(A) to the
+    // directors, in which A = sum_i D_next_i D_i^T.  When the directors are
+    // orthonormal, A is a rotation, and sqrt(A) is the rotation through half
+    // the angle about the same axis, which is computed via quaternions.
+    // Otherwise (or when the rotation angle is close to pi), sqrt(A) is
+    // computed by Eigen.
+    static const int BLOCKSIZE = 16; // this parameter needs to be tuned
+    static const double rotation_tol = std::sqrt(std::numeric_limits<double>::epsilon());
+    const int num_segments = static_cast<int>(local_sz);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int kstart = 0; kstart < num_segments; kstart += BLOCKSIZE)
     {
-        // Compute the forces applied by the rod to the "current" and "next"
-        // nodes.
-        const int D1_offset = 0;
-        Eigen::Map<const Vector3d> D1(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D1_offset]);
-        Eigen::Map<const Vector3d> D1_next(&D_next_vals[k * 3 * 3 + D1_offset]);
-
-        const int D2_offset = 3;
-        Eigen::Map<const Vector3d> D2(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D2_offset]);
-        Eigen::Map<const Vector3d> D2_next(&D_next_vals[k * 3 * 3 + D2_offset]);
-
-        const int D3_offset = 6;
-        Eigen::Map<const Vector3d> D3(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D3_offset]);
-        Eigen::Map<const Vector3d> D3_next(&D_next_vals[k * 3 * 3 + D3_offset]);
-
-        Eigen::Map<const Vector3d> X(&X_vals[(petsc_curr_node_idxs[k] - global_offset) * NDIM]);
-        Eigen::Map<const Vector3d> X_next(&X_next_vals[k * NDIM]);
-
-        boost::array<Eigen::Map<const Vector3d>*, 3> D = { { &D1, &D2, &D3 } };
-        boost::array<Eigen::Map<const Vector3d>*, 3> D_next = { { &D1_next, &D2_next, &D3_next } };
-        Matrix3d A(Matrix3d::Zero());
-        for (int i = 0; i < 3; ++i)
+        const int block_size = std::min(BLOCKSIZE, num_segments - kstart);
+        double D_block[3][3][BLOCKSIZE], D_next_block[3][3][BLOCKSIZE], D_half_block[3][3][BLOCKSIZE];
+        double dX_block[3][BLOCKSIZE];
+        bool is_rotation_block[BLOCKSIZE];
+
+        // Gather the directors and the segment displacements.
+        for (int kunroll = 0; kunroll < block_size; ++kunroll)
         {
-            A += (*D_next[i]) * (*D[i]).transpose();
+            const int k = kstart + kunroll;
+            const int curr_idx = petsc_curr_node_idxs[k] - global_offset;
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int d = 0; d < 3; ++d)
+                {
+                    D_block[i][d][kunroll] = D_vals[curr_idx * 3 * 3 + 3 * i + d];
+                    D_next_block[i][d][kunroll] = D_next_vals[k * 3 * 3 + 3 * i + d];
+                }
+            }
+            for (int d = 0; d < 3; ++d)
+            {
+                dX_block[d][kunroll] = X_next_vals[k * NDIM + d] - X_vals[curr_idx * NDIM + d];
+            }
         }
-        Matrix3d sqrt_A = A.sqrt();
-        Vector3d D1_half, D2_half, D3_half;
-        boost::array<Vector3d*, 3> D_half = { { &D1_half, &D2_half, &D3_half } };
-        for (int i = 0; i < 3; ++i)
+
+        // Compute the half-step directors.
+        for (int kunroll = 0; kunroll < block_size; ++kunroll)
         {
-            *D_half[i] = sqrt_A * (*D[i]);
+            double A[3][3], AtA_err = 0.0;
+            for (int a = 0; a < 3; ++a)
+            {
+                for (int b = 0; b < 3; ++b)
+                {
+                    A[a][b] = D_next_block[0][a][kunroll] * D_block[0][b][kunroll] +
+                              D_next_block[1][a][kunroll] * D_block[1][b][kunroll] +
+                              D_next_block[2][a][kunroll] * D_block[2][b][kunroll];
+                }
+            }
+            for (int a = 0; a < 3; ++a)
+            {
+                for (int b = 0; b < 3; ++b)
+                {
+                    const double AtA = A[0][a] * A[0][b] + A[1][a] * A[1][b] + A[2][a] * A[2][b];
+                    AtA_err = std::max(AtA_err, std::abs(AtA - (a == b ? 1.0 : 0.0)));
+                }
+            }
+            const double one_plus_trace = 1.0 + A[0][0] + A[1][1] + A[2][2];
+            is_rotation_block[kunroll] = AtA_err < rotation_tol && one_plus_trace > rotation_tol;
+
+            // The quaternion (qw,qx,qy,qz) corresponds to A, and the quaternion
+            // (hw,hx,hy,hz) corresponds to the rotation through half the angle.
+            const double qw = 0.5 * std::sqrt(std::max(one_plus_trace, rotation_tol));
+            const double qx = 0.25 * (A[2][1] - A[1][2]) / qw;
+            const double qy = 0.25 * (A[0][2] - A[2][0]) / qw;
+            const double qz = 0.25 * (A[1][0] - A[0][1]) / qw;
+            const double h_scale = 1.0 / std::sqrt((1.0 + qw) * (1.0 + qw) + qx * qx + qy * qy + qz * qz);
+            const double hw = (1.0 + qw) * h_scale, hx = qx * h_scale, hy = qy * h_scale, hz = qz * h_scale;
+            const double sqrt_A[3][3] = { { 1.0 - 2.0 * (hy * hy + hz * hz),
+                                            2.0 * (hx * hy - hz * hw),
+                                            2.0 * (hx * hz + hy * hw) },
+                                          { 2.0 * (hx * hy + hz * hw),
+                                            1.0 - 2.0 * (hx * hx + hz * hz),
+                                            2.0 * (hy * hz - hx * hw) },
+                                          { 2.0 * (hx * hz - hy * hw),
+                                            2.0 * (hy * hz + hx * hw),
+                                            1.0 - 2.0 * (hx * hx + hy * hy) } };
+            for (int i = 0; i < 3; ++i)
+            {
+                for (int a = 0; a < 3; ++a)
+                {
+                    D_half_block[i][a][kunroll] = sqrt_A[a][0] * D_block[i][0][kunroll] +
+                                                  sqrt_A[a][1] * D_block[i][1][kunroll] +
+                                                  sqrt_A[a][2] * D_block[i][2][kunroll];
+                }
+            }
+        }
+        for (int kunroll = 0; kunroll < block_size; ++kunroll)
+        {
+            if (LIKELY(is_rotation_block[kunroll])) continue;
+            Matrix3d A(Matrix3d::Zero());
+            for (int i = 0; i < 3; ++i)
+            {
+                const Vector3d D(D_block[i][0][kunroll], D_block[i][1][kunroll], D_block[i][2][kunroll]);
+                const Vector3d D_next(
+                    D_next_block[i][0][kunroll], D_next_block[i][1][kunroll], D_next_block[i][2][kunroll]);
+                A += D_next * D.transpose();
+            }
+            const Matrix3d sqrt_A = A.sqrt();
+            for (int i = 0; i < 3; ++i)
+            {
+                const Vector3d D(D_block[i][0][kunroll], D_block[i][1][kunroll], D_block[i][2][kunroll]);
+                const Vector3d D_half = sqrt_A * D;
+                for (int a = 0; a < 3; ++a)
+                {
+                    D_half_block[i][a][kunroll] = D_half[a];
+                }
+            }
         }
 
-        const double ds = material_params[k][0];
-        const double a1 = material_params[k][1];
-        const double a2 = material_params[k][2];
-        const double a3 = material_params[k][3];
-        const double b1 = material_params[k][4];
-        const double b2 = material_params[k][5];
-        const double b3 = material_params[k][6];
-        const double kappa1 = material_params[k][7];
-        const double kappa2 = material_params[k][8];
-        const double tau = material_params[k][9];
-
-        const Vector3d dX_ds((X_next - X) / ds);
-        const double F1 = b1 * D1_half.dot(dX_ds);
-        const double F2 = b2 * D2_half.dot(dX_ds);
-        const double F3 = b3 * (D3_half.dot(dX_ds) - 1.0);
-        const Vector3d F_half = F1 * D1_half + F2 * D2_half + F3 * D3_half;
-
-        const Vector3d dD1_ds((D1_next - D1) / ds);
-        const Vector3d dD2_ds((D2_next - D2) / ds);
-        const Vector3d dD3_ds((D3_next - D3) / ds);
-        const double N1 = a1 * (dD2_ds.dot(D3_half) - kappa1);
-        const double N2 = a2 * (dD3_ds.dot(D1_half) - kappa2);
-        const double N3 = a3 * (dD1_ds.dot(D2_half) - tau);
-        const Vector3d N_half = N1 * D1_half + N2 * D2_half + N3 * D3_half;
-
-        Eigen::Map<Vector3d> F_curr(&F_curr_node_vals[k * NDIM]);
-        Eigen::Map<Vector3d> F_next(&F_next_node_vals[k * NDIM]);
-        F_curr = F_half;
-        F_next = -F_half;
-
-        Eigen::Map<Vector3d> N_curr(&N_curr_node_vals[k * NDIM]);
-        Eigen::Map<Vector3d> N_next(&N_next_node_vals[k * NDIM]);
-        N_curr = N_half + 0.5 * (X_next - X).cross(F_half);
-        N_next = -N_half + 0.5 * (X_next - X).cross(F_half);
+        // Compute the forces and torques applied by the rod to the "current"
+        // and "next" nodes.
+        for (int kunroll = 0; kunroll < block_size; ++kunroll)
+        {
+            const int k = kstart + kunroll;
+            const double ds = material_params[k][0];
+            const double a1 = material_params[k][1];
+            const double a2 = material_params[k][2];
+            const double a3 = material_params[k][3];
+            const double b1 = material_params[k][4];
+            const double b2 = material_params[k][5];
+            const double b3 = material_params[k][6];
+            const double kappa1 = material_params[k][7];
+            const double kappa2 = material_params[k][8];
+            const double tau = material_params[k][9];
+
+            // Projections of dX/ds and of dD_i/ds onto the half-step directors.
+            double dX_ds_dot_D_half[3];
+            double dD1_ds_dot_D2_half = 0.0, dD2_ds_dot_D3_half = 0.0, dD3_ds_dot_D1_half = 0.0;
+            for (int i = 0; i < 3; ++i)
+            {
+                dX_ds_dot_D_half[i] = (dX_block[0][kunroll] * D_half_block[i][0][kunroll] +
+                                       dX_block[1][kunroll] * D_half_block[i][1][kunroll] +
+                                       dX_block[2][kunroll] * D_half_block[i][2][kunroll]) /
+                                      ds;
+            }
+            for (int d = 0; d < 3; ++d)
+            {
+                dD1_ds_dot_D2_half +=
+                    (D_next_block[0][d][kunroll] - D_block[0][d][kunroll]) * D_half_block[1][d][kunroll];
+                dD2_ds_dot_D3_half +=
+                    (D_next_block[1][d][kunroll] - D_block[1][d][kunroll]) * D_half_block[2][d][kunroll];
+                dD3_ds_dot_D1_half +=
+                    (D_next_block[2][d][kunroll] - D_block[2][d][kunroll]) * D_half_block[0][d][kunroll];
+            }
+            const double F1 = b1 * dX_ds_dot_D_half[0];
+            const double F2 = b2 * dX_ds_dot_D_half[1];
+            const double F3 = b3 * (dX_ds_dot_D_half[2] - 1.0);
+            const double N1 = a1 * (dD2_ds_dot_D3_half / ds - kappa1);
+            const double N2 = a2 * (dD3_ds_dot_D1_half / ds - kappa2);
+            const double N3 = a3 * (dD1_ds_dot_D2_half / ds - tau);
+
+            double F_half[3], N_half[3];
+            for (int d = 0; d < 3; ++d)
+            {
+                F_half[d] = F1 * D_half_block[0][d][kunroll] + F2 * D_half_block[1][d][kunroll] +
+                            F3 * D_half_block[2][d][kunroll];
+                N_half[d] = N1 * D_half_block[0][d][kunroll] + N2 * D_half_block[1][d][kunroll] +
+                            N3 * D_half_block[2][d][kunroll];
+            }
+            const double dX_cross_F_half[3] = {
+                dX_block[1][kunroll] * F_half[2] - dX_block[2][kunroll] * F_half[1],
+                dX_block[2][kunroll] * F_half[0] - dX_block[0][kunroll] * F_half[2],
+                dX_block[0][kunroll] * F_half[1] - dX_block[1][kunroll] * F_half[0]
+            };
+            for (int d = 0; d < 3; ++d)
+            {
+                F_curr_node_vals[k * NDIM + d] = F_half[d];
+                F_next_node_vals[k * NDIM + d] = -F_half[d];
+                N_curr_node_vals[k * NDIM + d] = N_half[d] + 0.5 * dX_cross_F_half[d];
+                N_next_node_vals[k * NDIM + d] = -N_half[d] + 0.5 * dX_cross_F_half[d];
+            }
+        }
     }
 
     ierr = VecRestoreArray(D_vec, &D_vals);
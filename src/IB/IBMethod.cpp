@@ -52,6 +52,7 @@
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "CellIndex.h"
+#include "CoarsenSchedule.h"
 #include "GriddingAlgorithm.h"
 #include "HierarchyDataOpsReal.h"
 #include "Index.h"
@@ -75,6 +76,8 @@
 #include "ibamr/IBLagrangianSourceStrategy.h"
 #include "ibamr/IBMethod.h"
 #include "ibamr/IBMethodPostProcessStrategy.h"
+#include "ibamr/INSHierarchyIntegrator.h"
+#include "ibamr/StokesSpecifications.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/IBTK_CHKERRQ.h"
@@ -86,6 +89,8 @@
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/PerformanceTelemetry.h"
+#include "ibtk/WorkloadReport.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
@@ -166,6 +171,8 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_ghosts = std::max(LEInteractor::getMinimumGhostWidth(d_interp_kernel_fcn),
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
     d_do_log = false;
+    d_use_sfc_ordering = false;
+    d_use_assembled_force_jac = false;
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -186,6 +193,7 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_l_data_manager = LDataManager::getManager(
         d_object_name + "::LDataManager", d_interp_kernel_fcn, d_spread_kernel_fcn, d_ghosts, d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setUseSpaceFillingCurveOrdering(d_use_sfc_ordering);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -416,8 +424,14 @@ void IBMethod::postprocessIntegrateData(double current_time, double new_time, in
     const double dt = new_time - current_time;
     const int integrator_step = d_ib_solver->getIntegratorStep();
 
+    // Complete any outstanding ghost node updates.
+    endPendingGhostUpdates();
+
     // Update the instrumentation data.
+    Pointer<PerformanceTelemetry> telemetry = d_ib_solver->getPerformanceTelemetry();
+    if (telemetry) telemetry->startPhase("instrumentation");
     updateIBInstrumentationData(integrator_step + 1, new_time);
+    if (telemetry) telemetry->stopPhase("instrumentation");
     if (d_instrument_panel->isInstrumented())
     {
         const std::vector<std::string>& instrument_name = d_instrument_panel->getInstrumentNames();
@@ -431,6 +445,18 @@ void IBMethod::postprocessIntegrateData(double current_time, double new_time, in
         }
     }
 
+    // Record the number of Lagrangian nodes assigned to this process.
+    if (telemetry)
+    {
+        double num_local_nodes = 0.0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+            num_local_nodes += static_cast<double>(d_l_data_manager->getNumberOfLocalNodes(ln));
+        }
+        telemetry->addCount("lagrangian_nodes", num_local_nodes);
+    }
+
     // Reset time-dependent Lagrangian data.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -519,6 +545,76 @@ void IBMethod::setLinearizedPosition(Vec& X_vec)
     ierr = VecCopy(X_vec, (*X_jac_data)[level_num]->getVec());
     IBTK_CHKERRQ(ierr);
     *X_jac_needs_ghost_fill = true;
+    if (d_use_assembled_force_jac)
+    {
+        // The Jacobian is stored in a BAIJ matrix with NDIM x NDIM blocks.  The
+        // matrix is allocated using the nonzero structure provided by the force
+        // strategy, and it is refilled in place until the Lagrangian data are
+        // redistributed.
+        if (!d_force_jac)
+        {
+            int n_local, n_global;
+            ierr = VecGetLocalSize(X_vec, &n_local);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecGetSize(X_vec, &n_global);
+            IBTK_CHKERRQ(ierr);
+            std::vector<int> d_nnz(n_local, 0), o_nnz(n_local, 0);
+            if (d_ib_force_fcn)
+            {
+                d_ib_force_fcn->computeLagrangianForceJacobianNonzeroStructure(
+                    d_nnz, o_nnz, d_hierarchy, level_num, d_l_data_manager);
+            }
+            const int n_local_blocks = n_local / NDIM;
+            std::vector<int> d_nnz_blocks(n_local_blocks), o_nnz_blocks(n_local_blocks);
+            for (int k = 0; k < n_local_blocks; ++k)
+            {
+                d_nnz_blocks[k] = std::max(d_nnz[NDIM * k], 1);
+                o_nnz_blocks[k] = o_nnz[NDIM * k];
+            }
+            ierr = MatCreateBAIJ(PETSC_COMM_WORLD,
+                                 NDIM,
+                                 n_local,
+                                 n_local,
+                                 n_global,
+                                 n_global,
+                                 0,
+                                 n_local_blocks > 0 ? &d_nnz_blocks[0] : NULL,
+                                 0,
+                                 n_local_blocks > 0 ? &o_nnz_blocks[0] : NULL,
+                                 &d_force_jac);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetOptionsPrefix(d_force_jac, "ib_");
+            IBTK_CHKERRQ(ierr);
+        }
+        else
+        {
+            ierr = MatZeroEntries(d_force_jac);
+            IBTK_CHKERRQ(ierr);
+        }
+        if (d_ib_force_fcn)
+        {
+            std::vector<Pointer<LData> >* U_data;
+            getVelocityData(&U_data, d_half_time);
+            d_ib_force_fcn->computeLagrangianForceJacobian(d_force_jac,
+                                                           MAT_FINAL_ASSEMBLY,
+                                                           1.0,
+                                                           (*X_jac_data)[level_num],
+                                                           0.0,
+                                                           (*U_data)[level_num],
+                                                           d_hierarchy,
+                                                           level_num,
+                                                           d_half_time,
+                                                           d_l_data_manager);
+        }
+        else
+        {
+            ierr = MatAssemblyBegin(d_force_jac, MAT_FINAL_ASSEMBLY);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatAssemblyEnd(d_force_jac, MAT_FINAL_ASSEMBLY);
+            IBTK_CHKERRQ(ierr);
+        }
+        return;
+    }
     if (!d_force_jac)
     {
         int n_local, n_global;
@@ -544,6 +640,11 @@ void IBMethod::setLinearizedPosition(Vec& X_vec)
     return;
 } // setLinearizedPosition
 
+Mat IBMethod::getLinearizedForceJacobian()
+{
+    return d_use_assembled_force_jac ? d_force_jac : NULL;
+} // getLinearizedForceJacobian
+
 void IBMethod::computeResidual(Vec& R_vec)
 {
     PetscErrorCode ierr;
@@ -590,6 +691,7 @@ void IBMethod::interpolateVelocity(const int u_data_idx,
 {
     std::vector<Pointer<LData> >* U_data, *X_LE_data;
     bool* X_LE_needs_ghost_fill;
+    endPendingGhostUpdates();
     getVelocityData(&U_data, data_time);
     getLECouplingPositionData(&X_LE_data, &X_LE_needs_ghost_fill, data_time);
     d_l_data_manager->interp(u_data_idx, *U_data, *X_LE_data, u_synch_scheds, u_ghost_fill_scheds, data_time);
@@ -707,6 +809,211 @@ void IBMethod::computeLagrangianForce(const double data_time)
     return;
 } // computeLagrangianForce
 
+void IBMethod::computeSubcycledLagrangianForce(const int u_data_idx,
+                                               const std::vector<Pointer<CoarsenSchedule<NDIM> > >& u_synch_scheds,
+                                               const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
+                                               const double current_time,
+                                               const double new_time,
+                                               const int num_substeps)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_substeps >= 1);
+#endif
+    int ierr;
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    const double dt = new_time - current_time;
+    const double dt_sub = dt / static_cast<double>(num_substeps);
+    endPendingGhostUpdates();
+    std::vector<Pointer<LData> >* F_half_data;
+    bool* F_half_needs_ghost_fill;
+    getForceData(&F_half_data, &F_half_needs_ghost_fill, current_time + 0.5 * dt);
+
+    // Setup the positions, velocities, and forces used for the substeps.
+    std::vector<Pointer<LData> > X_sub_data(finest_ln + 1), X_mid_data(finest_ln + 1), U_sub_data(finest_ln + 1),
+        F_sub_data(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        X_sub_data[ln] = d_l_data_manager->createLData("X_sub", ln, NDIM);
+        X_mid_data[ln] = d_l_data_manager->createLData("X_mid", ln, NDIM);
+        U_sub_data[ln] = d_l_data_manager->createLData("U_sub", ln, NDIM);
+        F_sub_data[ln] = d_l_data_manager->createLData("F_sub", ln, NDIM);
+        ierr = VecCopy(d_X_current_data[ln]->getVec(), X_sub_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+        ierr = VecSet((*F_half_data)[ln]->getVec(), 0.0);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Advance the structure in substeps.  The Eulerian velocity is frozen, so
+    // it needs to be synchronized and to have its ghost values filled only
+    // once.
+    const std::vector<Pointer<CoarsenSchedule<NDIM> > > no_synch_scheds;
+    const std::vector<Pointer<RefineSchedule<NDIM> > > no_ghost_fill_scheds;
+    for (int step = 0; step < num_substeps; ++step)
+    {
+        const double substep_half_time = current_time + (static_cast<double>(step) + 0.5) * dt_sub;
+
+        // Predict the positions at the midpoint of the substep.
+        d_l_data_manager->interp(u_data_idx,
+                                 U_sub_data,
+                                 X_sub_data,
+                                 step == 0 ? u_synch_scheds : no_synch_scheds,
+                                 step == 0 ? u_ghost_fill_scheds : no_ghost_fill_scheds,
+                                 current_time);
+        resetAnchorPointValues(U_sub_data, coarsest_ln, finest_ln);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+            ierr = VecWAXPY(X_mid_data[ln]->getVec(), 0.5 * dt_sub, U_sub_data[ln]->getVec(), X_sub_data[ln]->getVec());
+            IBTK_CHKERRQ(ierr);
+        }
+
+        // Compute the velocity and the force at the midpoint of the substep,
+        // accumulate the time-averaged force, and update the positions.
+        d_l_data_manager->interp(
+            u_data_idx, U_sub_data, X_mid_data, no_synch_scheds, no_ghost_fill_scheds, current_time);
+        resetAnchorPointValues(U_sub_data, coarsest_ln, finest_ln);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+            ierr = VecSet(F_sub_data[ln]->getVec(), 0.0);
+            IBTK_CHKERRQ(ierr);
+            if (d_ib_force_fcn)
+            {
+                d_ib_force_fcn->computeLagrangianForce(F_sub_data[ln],
+                                                       X_mid_data[ln],
+                                                       U_sub_data[ln],
+                                                       d_hierarchy,
+                                                       ln,
+                                                       substep_half_time,
+                                                       d_l_data_manager);
+            }
+            ierr = VecAXPY((*F_half_data)[ln]->getVec(), 1.0 / num_substeps, F_sub_data[ln]->getVec());
+            IBTK_CHKERRQ(ierr);
+            ierr = VecAXPY(X_sub_data[ln]->getVec(), dt_sub, U_sub_data[ln]->getVec());
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    // Use the positions at the end of the final substep as the predicted
+    // updated positions.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        ierr = VecCopy(X_sub_data[ln]->getVec(), d_X_new_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+    }
+    *F_half_needs_ghost_fill = true;
+    d_X_new_needs_ghost_fill = true;
+    d_X_half_needs_reinit = true;
+    return;
+} // computeSubcycledLagrangianForce
+
+double IBMethod::getStableTimestep()
+{
+    if (!d_ib_force_fcn) return std::numeric_limits<double>::max();
+
+    int ierr;
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    const double current_time = d_ib_solver->getIntegratorTime();
+    const double start_time = d_ib_solver->getStartTime();
+    const bool initial_time = MathUtilities<double>::equalEps(current_time, start_time);
+    if (d_ib_force_fcn_needs_init)
+    {
+        resetLagrangianForceFunction(current_time, initial_time);
+        d_ib_force_fcn_needs_init = false;
+    }
+
+    // The effective mass of each Lagrangian node is taken to be the mass of the
+    // fluid contained in a single Cartesian grid cell on the level on which the
+    // node is located.
+    const double rho = getINSHierarchyIntegrator()->getStokesSpecifications()->getRho();
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+
+    // Estimate the largest eigenvalue of the Jacobian of the Lagrangian force
+    // by power iteration, using finite differences to approximate the action
+    // of the Jacobian.  The eigenvector estimate from the previous call is
+    // used as the initial guess, so that only a few iterations are typically
+    // required.
+    double dt_stable = std::numeric_limits<double>::max();
+    d_stable_dt_eigvec_data.resize(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const IntVector<NDIM>& ratio = level->getRatio();
+        double h = std::numeric_limits<double>::max();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            h = std::min(h, dx_coarsest[d] / static_cast<double>(ratio(d)));
+        }
+        const double node_mass = rho * std::pow(h, NDIM);
+
+        Pointer<LData> X_data = d_l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        Pointer<LData> U_data = d_l_data_manager->getLData(LDataManager::VEL_DATA_NAME, ln);
+        Pointer<LData> X_eps_data = d_l_data_manager->createLData("X_eps", ln, NDIM);
+        Pointer<LData> F_data = d_l_data_manager->createLData("F", ln, NDIM);
+        Pointer<LData> F_eps_data = d_l_data_manager->createLData("F_eps", ln, NDIM);
+        const bool warm_start = !d_stable_dt_eigvec_data[ln].isNull();
+        if (!warm_start)
+        {
+            d_stable_dt_eigvec_data[ln] = d_l_data_manager->createLData("V_stable_dt", ln, NDIM);
+            ierr = VecSetRandom(d_stable_dt_eigvec_data[ln]->getVec(), NULL);
+            IBTK_CHKERRQ(ierr);
+        }
+        Vec V_vec = d_stable_dt_eigvec_data[ln]->getVec();
+        Vec X_vec = X_data->getVec();
+        Vec X_eps_vec = X_eps_data->getVec();
+        Vec F_vec = F_data->getVec();
+        Vec F_eps_vec = F_eps_data->getVec();
+
+        ierr = VecSet(F_vec, 0.0);
+        IBTK_CHKERRQ(ierr);
+        d_ib_force_fcn->computeLagrangianForce(
+            F_data, X_data, U_data, d_hierarchy, ln, current_time, d_l_data_manager);
+        double X_max_norm;
+        ierr = VecNorm(X_vec, NORM_INFINITY, &X_max_norm);
+        IBTK_CHKERRQ(ierr);
+        const double eps = std::sqrt(std::numeric_limits<double>::epsilon()) * std::max(1.0, X_max_norm);
+        const int num_iterations = warm_start ? 2 : 10;
+        double lambda = 0.0;
+        for (int k = 0; k < num_iterations; ++k)
+        {
+            double V_norm;
+            ierr = VecNorm(V_vec, NORM_2, &V_norm);
+            IBTK_CHKERRQ(ierr);
+            if (MathUtilities<double>::equalEps(V_norm, 0.0))
+            {
+                // The force does not depend on the configuration of the
+                // structure, so reset the eigenvector estimate.
+                ierr = VecSetRandom(V_vec, NULL);
+                IBTK_CHKERRQ(ierr);
+                lambda = 0.0;
+                break;
+            }
+            ierr = VecScale(V_vec, 1.0 / V_norm);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecWAXPY(X_eps_vec, eps, V_vec, X_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecSet(F_eps_vec, 0.0);
+            IBTK_CHKERRQ(ierr);
+            d_ib_force_fcn->computeLagrangianForce(
+                F_eps_data, X_eps_data, U_data, d_hierarchy, ln, current_time, d_l_data_manager);
+            ierr = VecWAXPY(V_vec, -1.0, F_vec, F_eps_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecScale(V_vec, 1.0 / eps);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecNorm(V_vec, NORM_2, &lambda);
+            IBTK_CHKERRQ(ierr);
+        }
+        if (lambda > 0.0) dt_stable = std::min(dt_stable, std::sqrt(node_mass / lambda));
+    }
+    return dt_stable;
+} // getStableTimestep
+
 void IBMethod::computeLinearizedLagrangianForce(Vec& X_vec, const double /*data_time*/)
 {
     PetscErrorCode ierr;
@@ -722,11 +1029,47 @@ void IBMethod::computeLinearizedLagrangianForce(Vec& X_vec, const double /*data_
     return;
 } // computeLinearizedLagrangianForce
 
+void IBMethod::beginSpreadForce(const double data_time)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    std::vector<Pointer<LData> >* F_data, *X_LE_data;
+    bool* F_needs_ghost_fill, *X_LE_needs_ghost_fill;
+    getForceData(&F_data, &F_needs_ghost_fill, data_time);
+    getLECouplingPositionData(&X_LE_data, &X_LE_needs_ghost_fill, data_time);
+
+    // Anchor point values must be reset before the ghost node values are
+    // communicated.
+    resetAnchorPointValues(*F_data, coarsest_ln, finest_ln);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        if (*F_needs_ghost_fill &&
+            std::find(d_pending_ghost_update_data.begin(), d_pending_ghost_update_data.end(), (*F_data)[ln]) ==
+                d_pending_ghost_update_data.end())
+        {
+            (*F_data)[ln]->beginGhostUpdate();
+            d_pending_ghost_update_data.push_back((*F_data)[ln]);
+        }
+        if (*X_LE_needs_ghost_fill &&
+            std::find(d_pending_ghost_update_data.begin(), d_pending_ghost_update_data.end(), (*X_LE_data)[ln]) ==
+                d_pending_ghost_update_data.end())
+        {
+            (*X_LE_data)[ln]->beginGhostUpdate();
+            d_pending_ghost_update_data.push_back((*X_LE_data)[ln]);
+        }
+    }
+    *F_needs_ghost_fill = false;
+    *X_LE_needs_ghost_fill = false;
+    return;
+} // beginSpreadForce
+
 void IBMethod::spreadForce(const int f_data_idx,
                            RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                            const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
                            const double data_time)
 {
+    endPendingGhostUpdates();
     std::vector<Pointer<LData> >* F_data, *X_LE_data;
     bool* F_needs_ghost_fill, *X_LE_needs_ghost_fill;
     getForceData(&F_data, &F_needs_ghost_fill, data_time);
@@ -1173,6 +1516,15 @@ void IBMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy
         }
     }
 
+    // Register the phases and counters that are recorded by the performance
+    // telemetry object.
+    Pointer<PerformanceTelemetry> telemetry = d_ib_solver->getPerformanceTelemetry();
+    if (telemetry)
+    {
+        telemetry->registerPhase("instrumentation");
+        telemetry->registerCounter("lagrangian_nodes");
+    }
+
     // Indicate that the force and source strategies need to be re-initialized.
     d_ib_force_fcn_needs_init = true;
     d_ib_source_fcn_needs_init = true;
@@ -1216,6 +1568,18 @@ void IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
 {
     d_l_data_manager->endDataRedistribution();
 
+    // Report the distribution of the Lagrangian nodes.
+    Pointer<WorkloadReport> workload_report = d_ib_solver->getWorkloadReport();
+    if (workload_report)
+    {
+        for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+            workload_report->addLevelCount(
+                "lagrangian_nodes", ln, static_cast<double>(d_l_data_manager->getNumberOfLocalNodes(ln)));
+        }
+    }
+
     // Look up the re-distributed Lagrangian position data.
     std::vector<Pointer<LData> > X_data(hierarchy->getFinestLevelNumber() + 1);
     for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
@@ -1266,6 +1630,20 @@ void IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
     // Indicate that the force and source strategies need to be re-initialized.
     d_ib_force_fcn_needs_init = true;
     d_ib_source_fcn_needs_init = true;
+
+    // Discard the eigenvector estimate used to determine the stable time step
+    // size, since it is not redistributed along with the Lagrangian data.
+    d_stable_dt_eigvec_data.clear();
+
+    // Deallocate any previously allocated Jacobian data structures, since the
+    // layout and the nonzero structure of the Jacobian generally change when
+    // the Lagrangian data are redistributed.
+    if (d_force_jac)
+    {
+        PetscErrorCode ierr;
+        ierr = MatDestroy(&d_force_jac);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // endDataRedistribution
 
@@ -1671,6 +2049,18 @@ void IBMethod::resetAnchorPointValues(std::vector<Pointer<LData> > U_data, const
     return;
 } // resetAnchorPointValues
 
+void IBMethod::endPendingGhostUpdates()
+{
+    for (std::vector<Pointer<LData> >::iterator it = d_pending_ghost_update_data.begin();
+         it != d_pending_ghost_update_data.end();
+         ++it)
+    {
+        (*it)->endGhostUpdate();
+    }
+    d_pending_ghost_update_data.clear();
+    return;
+} // endPendingGhostUpdates
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void IBMethod::resetLagrangianForceFunction(const double init_data_time, const bool initial_time)
@@ -1793,6 +2183,9 @@ void IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
         d_do_log = db->getBool("enable_logging");
+    if (db->keyExists("use_sfc_node_ordering")) d_use_sfc_ordering = db->getBool("use_sfc_node_ordering");
+    if (db->keyExists("use_assembled_force_jacobian"))
+        d_use_assembled_force_jac = db->getBool("use_assembled_force_jacobian");
     return;
 } // getFromInput
 
@@ -39,6 +39,7 @@
 #include <iterator>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <ostream>
 #include <set>
 #include <utility>
@@ -53,6 +54,7 @@
 #include "ibamr/IBSpringForceSpec.h"
 #include "ibamr/IBStandardForceGen.h"
 #include "ibamr/IBTargetPointForceSpec.h"
+#include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LData.h"
@@ -65,6 +67,8 @@
 #include "petscsys.h"
 #include "petscvec.h"
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -75,6 +79,12 @@ namespace IBAMR
 
 namespace
 {
+// Timers.
+static Timer* t_compute_lagrangian_fused_force;
+static Timer* t_compute_lagrangian_spring_force;
+static Timer* t_compute_lagrangian_beam_force;
+static Timer* t_compute_lagrangian_target_point_force;
+
 void resetLocalPETScIndices(std::vector<int>& inds, const int global_node_offset, const int num_local_nodes)
 {
 #if defined(NDEBUG)
@@ -122,14 +132,110 @@ void resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+template <class T>
+void applyPermutation(std::vector<T>& vals, const std::vector<int>& order)
+{
+    std::vector<T> permuted_vals(order.size());
+    for (unsigned int k = 0; k < order.size(); ++k)
+    {
+        permuted_vals[k] = vals[order[k]];
+    }
+    vals.swap(permuted_vals);
+    return;
+} // applyPermutation
+
+// Greedily color the elements with indices in [begin,end) so that no two
+// elements of the same color share any nodes, append the element indices to
+// element_order sorted by color, and append the offset of each (nonempty)
+// color to color_offsets.  The nodes of element k are node_idxs[i][k] for each
+// i, and all node indices must be in [0,num_nodes).
+//
+// NOTE: Coloring is only required when the force loops are threaded.
+// Otherwise, all elements are assigned the same color, and the element
+// ordering is unchanged.
+void colorElements(std::vector<int>& element_order,
+                   std::vector<int>& color_offsets,
+                   const int begin,
+                   const int end,
+                   const std::vector<const std::vector<int>*>& node_idxs,
+                   const int num_nodes)
+{
+    if (begin == end) return;
+    std::vector<int> element_color(end - begin, 0);
+    int num_colors = 1;
+#if defined(_OPENMP)
+    std::vector<std::vector<bool> > node_colors(num_nodes);
+    for (int k = begin; k < end; ++k)
+    {
+        int color = 0;
+        bool color_is_free = false;
+        while (!color_is_free)
+        {
+            color_is_free = true;
+            for (unsigned int i = 0; i < node_idxs.size() && color_is_free; ++i)
+            {
+                const std::vector<bool>& colors = node_colors[(*node_idxs[i])[k]];
+                color_is_free = color >= static_cast<int>(colors.size()) || !colors[color];
+            }
+            if (!color_is_free) ++color;
+        }
+        for (unsigned int i = 0; i < node_idxs.size(); ++i)
+        {
+            std::vector<bool>& colors = node_colors[(*node_idxs[i])[k]];
+            if (color >= static_cast<int>(colors.size())) colors.resize(color + 1, false);
+            colors[color] = true;
+        }
+        element_color[k - begin] = color;
+        num_colors = std::max(num_colors, color + 1);
+    }
+#else
+    NULL_USE(node_idxs);
+    NULL_USE(num_nodes);
+#endif
+    for (int color = 0; color < num_colors; ++color)
+    {
+        const int color_offset = static_cast<int>(element_order.size());
+        for (int k = begin; k < end; ++k)
+        {
+            if (element_color[k - begin] == color) element_order.push_back(k);
+        }
+        if (static_cast<int>(element_order.size()) > color_offset) color_offsets.push_back(color_offset);
+    }
+    return;
+} // colorElements
+
+// Map a cached PETSc index (i.e., a local index for data of depth NDIM) to the
+// corresponding global PETSc node (block) index.
+inline int getGlobalNodeIndex(const int petsc_idx,
+                              const int global_node_offset,
+                              const int num_local_nodes,
+                              const std::vector<int>& nonlocal_petsc_idxs)
+{
+    const int local_node_idx = petsc_idx / NDIM;
+    if (local_node_idx < num_local_nodes) return global_node_offset + local_node_idx;
+    return nonlocal_petsc_idxs[local_node_idx - num_local_nodes];
+} // getGlobalNodeIndex
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 IBStandardForceGen::IBStandardForceGen()
 {
+    d_use_fused_force_kernel = false;
+
     // Setup the default force generation functions.
     registerSpringForceFunction(0, &default_spring_force, &default_spring_force_deriv);
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(t_compute_lagrangian_fused_force = TimerManager::getManager()->getTimer(
+                      "IBAMR::IBStandardForceGen::computeLagrangianFusedForce()");
+                  t_compute_lagrangian_spring_force = TimerManager::getManager()->getTimer(
+                      "IBAMR::IBStandardForceGen::computeLagrangianSpringForce()");
+                  t_compute_lagrangian_beam_force = TimerManager::getManager()->getTimer(
+                      "IBAMR::IBStandardForceGen::computeLagrangianBeamForce()");
+                  t_compute_lagrangian_target_point_force = TimerManager::getManager()->getTimer(
+                      "IBAMR::IBStandardForceGen::computeLagrangianTargetPointForce()"););
     return;
 } // IBStandardForceGen
 
@@ -148,6 +254,12 @@ void IBStandardForceGen::registerSpringForceFunction(const int force_fcn_index,
     return;
 } // registerSpringForceFunction
 
+void IBStandardForceGen::setUseFusedForceKernel(const bool use_fused_force_kernel)
+{
+    d_use_fused_force_kernel = use_fused_force_kernel;
+    return;
+} // setUseFusedForceKernel
+
 void IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hierarchy,
                                              const int level_number,
                                              const double init_data_time,
@@ -172,6 +284,11 @@ void IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM>
     d_F_ghost_data.resize(new_size);
     d_dX_data.resize(new_size);
     d_is_initialized.resize(new_size, false);
+    d_nonlocal_petsc_idxs.resize(new_size);
+    d_jac_d_nnz.resize(new_size);
+    d_jac_o_nnz.resize(new_size);
+    d_jac_nnz_is_cached.resize(new_size, false);
+    d_fused_data.resize(new_size);
 
     // Keep track of all of the nonlocal PETSc indices required to compute the
     // forces.
@@ -203,6 +320,62 @@ void IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM>
     resetLocalOrNonlocalPETScIndices(
         d_beam_data[level_number].petsc_prev_node_idxs, global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
 
+    // Color the springs and beams so that their forces may be accumulated
+    // concurrently.  The interior and boundary sets of springs and beams (and
+    // the linear and user-defined sets of springs) are colored separately.
+    const int num_nodes = num_local_nodes + static_cast<int>(nonlocal_petsc_idxs.size());
+    {
+        SpringData& spring_data = d_spring_data[level_number];
+        const int num_springs = static_cast<int>(spring_data.lag_mastr_node_idxs.size());
+        const int set_offsets[5] = { 0,
+                                     spring_data.num_interior_linear_springs,
+                                     spring_data.num_interior_springs,
+                                     spring_data.num_interior_springs + spring_data.num_boundary_linear_springs,
+                                     num_springs };
+        std::vector<const std::vector<int>*> node_idxs;
+        node_idxs.push_back(&spring_data.petsc_mastr_node_idxs);
+        node_idxs.push_back(&spring_data.petsc_slave_node_idxs);
+        std::vector<int> spring_order;
+        spring_order.reserve(num_springs);
+        spring_data.color_offsets.clear();
+        for (int i = 0; i < 4; ++i)
+        {
+            colorElements(
+                spring_order, spring_data.color_offsets, set_offsets[i], set_offsets[i + 1], node_idxs, num_nodes);
+        }
+        spring_data.color_offsets.push_back(num_springs);
+        applyPermutation(spring_data.lag_mastr_node_idxs, spring_order);
+        applyPermutation(spring_data.lag_slave_node_idxs, spring_order);
+        applyPermutation(spring_data.petsc_mastr_node_idxs, spring_order);
+        applyPermutation(spring_data.petsc_slave_node_idxs, spring_order);
+        applyPermutation(spring_data.force_fcns, spring_order);
+        applyPermutation(spring_data.force_deriv_fcns, spring_order);
+        applyPermutation(spring_data.parameters, spring_order);
+    }
+    {
+        BeamData& beam_data = d_beam_data[level_number];
+        const int num_beams = static_cast<int>(beam_data.petsc_mastr_node_idxs.size());
+        const int set_offsets[3] = { 0, beam_data.num_interior_beams, num_beams };
+        std::vector<const std::vector<int>*> node_idxs;
+        node_idxs.push_back(&beam_data.petsc_mastr_node_idxs);
+        node_idxs.push_back(&beam_data.petsc_next_node_idxs);
+        node_idxs.push_back(&beam_data.petsc_prev_node_idxs);
+        std::vector<int> beam_order;
+        beam_order.reserve(num_beams);
+        beam_data.color_offsets.clear();
+        for (int i = 0; i < 2; ++i)
+        {
+            colorElements(
+                beam_order, beam_data.color_offsets, set_offsets[i], set_offsets[i + 1], node_idxs, num_nodes);
+        }
+        beam_data.color_offsets.push_back(num_beams);
+        applyPermutation(beam_data.petsc_mastr_node_idxs, beam_order);
+        applyPermutation(beam_data.petsc_next_node_idxs, beam_order);
+        applyPermutation(beam_data.petsc_prev_node_idxs, beam_order);
+        applyPermutation(beam_data.rigidities, beam_order);
+        applyPermutation(beam_data.curvatures, beam_order);
+    }
+
     std::ostringstream X_name_stream;
     X_name_stream << "IBStandardForceGen::X_ghost_" << level_number;
     d_X_ghost_data[level_number] = new LData(X_name_stream.str(), num_local_nodes, NDIM, nonlocal_petsc_idxs);
@@ -257,6 +430,14 @@ void IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM>
                    d_target_point_data[level_number].petsc_node_idxs.begin(),
                    std::bind2nd(std::multiplies<int>(), NDIM));
 
+    // Keep track of the global indices of the ghost nodes, and indicate that
+    // the nonzero structure of the force Jacobian must be recomputed.
+    d_nonlocal_petsc_idxs[level_number] = nonlocal_petsc_idxs;
+    d_jac_nnz_is_cached[level_number] = false;
+
+    // The fused force data are regenerated when they are next needed.
+    d_fused_data[level_number] = FusedData();
+
     // Indicate that the level data has been initialized.
     d_is_initialized[level_number] = true;
     return;
@@ -290,22 +471,61 @@ void IBStandardForceGen::computeLagrangianForce(Pointer<LData> F_data,
     IBTK_CHKERRQ(ierr);
     ierr = VecGhostUpdateBegin(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
+
+    if (d_use_fused_force_kernel)
+    {
+        // Compute all of the forces in a single pass over the local nodes.
+        if (d_fused_data[level_number].spring_offsets.empty())
+        {
+            initializeFusedLevelData(level_number, l_data_manager);
+        }
+        ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+        computeLagrangianFusedForce(F_ghost_data, X_ghost_data, U_data, level_number, l_data_manager);
+
+        // Add the locally computed forces to the Lagrangian force vector.
+        //
+        // WARNING: The following operations may yield nondeterministic results
+        // in parallel environments (i.e., the order of summation may not be
+        // consistent).
+        ierr = VecGhostUpdateBegin(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGhostUpdateEnd(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAXPY(F_data->getVec(), 1.0, F_ghost_data->getVec());
+        IBTK_CHKERRQ(ierr);
+        return;
+    }
+
+    // Compute the forces generated by the interior springs and beams while the
+    // ghost node positions are being communicated.  These kernels only read the
+    // locally owned positions and do not access the ghosted local form of
+    // X_ghost_data, which is not permitted until VecGhostUpdateEnd() returns.
+    computeLagrangianSpringForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, /*interior*/ true);
+    computeLagrangianBeamForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, /*interior*/ true);
+
     ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
 
-    // Compute the forces.
-    computeLagrangianSpringForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
-    computeLagrangianBeamForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
-    computeLagrangianTargetPointForce(
-        F_ghost_data, X_ghost_data, U_data, hierarchy, level_number, data_time, l_data_manager);
+    // Compute the forces generated by the boundary springs and beams.
+    computeLagrangianSpringForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, /*interior*/ false);
+    computeLagrangianBeamForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, /*interior*/ false);
 
-    // Add the locally computed forces to the Lagrangian force vector.
+    // Add the locally computed forces to the Lagrangian force vector.  Target
+    // point forces only involve local nodes, so they are computed directly into
+    // the (unghosted) force vector while the ghost node forces are being
+    // communicated; F_ghost_data must not be modified until the scatter ends.
     //
     // WARNING: The following operations may yield nondeterministic results in
     // parallel environments (i.e., the order of summation may not be
     // consistent).
     ierr = VecGhostUpdateBegin(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
     IBTK_CHKERRQ(ierr);
+    computeLagrangianTargetPointForce(F_data, X_ghost_data, U_data, hierarchy, level_number, data_time, l_data_manager);
     ierr = VecGhostUpdateEnd(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
     IBTK_CHKERRQ(ierr);
     ierr = VecAXPY(F_data->getVec(), 1.0, F_ghost_data->getVec());
@@ -326,172 +546,204 @@ IBStandardForceGen::computeLagrangianForceJacobianNonzeroStructure(std::vector<i
     TBOX_ASSERT(d_is_initialized[level_number]);
 #endif
 
-    int ierr;
-
     // Determine the global node offset and the number of local nodes.
     const int global_node_offset = l_data_manager->getGlobalNodeOffset(level_number);
     const int num_local_nodes = l_data_manager->getNumberOfLocalNodes(level_number);
 
-    // Determine the non-zero structure for the matrix used to store the
-    // Jacobian of the force.
-    //
-    // NOTE #1: Each spring and beam is *only* associated with a single node in
-    // the mesh.  We must take this into account when determining the non-zero
-    // structure of the matrix.
-    //
-    // NOTE #2: The following ensures only that sufficient space is allocated to
-    // store the Jacobian matrix.  In general, this routine will request MORE
-    // space than is ACTUALLY required.
-    Vec d_nnz_vec, o_nnz_vec;
-    ierr = VecCreateMPI(PETSC_COMM_WORLD, num_local_nodes, PETSC_DETERMINE, &d_nnz_vec);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecCreateMPI(PETSC_COMM_WORLD, num_local_nodes, PETSC_DETERMINE, &o_nnz_vec);
-    IBTK_CHKERRQ(ierr);
-
-    ierr = VecSet(d_nnz_vec, 1.0);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecSet(o_nnz_vec, 0.0);
-    IBTK_CHKERRQ(ierr);
-
-    { // Spring forces.
-
-        const std::vector<int>& petsc_mastr_node_idxs = d_spring_data[level_number].petsc_mastr_node_idxs;
-        const std::vector<int>& petsc_slave_node_idxs = d_spring_data[level_number].petsc_slave_node_idxs;
-        for (unsigned int k = 0; k < petsc_mastr_node_idxs.size(); ++k)
-        {
-            const int& mastr_idx = petsc_mastr_node_idxs[k];
-            const int& slave_idx = petsc_slave_node_idxs[k];
+    // The nonzero structure only changes when the Lagrangian data are
+    // redistributed, so it is computed only once per initialization of the
+    // level data.
+    if (!d_jac_nnz_is_cached[level_number])
+    {
+        int ierr;
+
+        // Determine the non-zero structure for the matrix used to store the
+        // Jacobian of the force.
+        //
+        // NOTE #1: Each spring and beam is *only* associated with a single node
+        // in the mesh.  We must take this into account when determining the
+        // non-zero structure of the matrix.
+        //
+        // NOTE #2: The following ensures only that sufficient space is
+        // allocated to store the Jacobian matrix.  In general, this routine
+        // will request MORE space than is ACTUALLY required.
+        //
+        // NOTE #3: The cached PETSc indices are local indices, so a node is
+        // local if and only if its local index is less than num_local_nodes.
+        const std::vector<int>& nonlocal_petsc_idxs = d_nonlocal_petsc_idxs[level_number];
+        Vec d_nnz_vec, o_nnz_vec;
+        ierr = VecCreateMPI(PETSC_COMM_WORLD, num_local_nodes, PETSC_DETERMINE, &d_nnz_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecCreateMPI(PETSC_COMM_WORLD, num_local_nodes, PETSC_DETERMINE, &o_nnz_vec);
+        IBTK_CHKERRQ(ierr);
+
+        ierr = VecSet(d_nnz_vec, 1.0);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecSet(o_nnz_vec, 0.0);
+        IBTK_CHKERRQ(ierr);
+
+        { // Spring forces.
+
+            const std::vector<int>& petsc_mastr_node_idxs = d_spring_data[level_number].petsc_mastr_node_idxs;
+            const std::vector<int>& petsc_slave_node_idxs = d_spring_data[level_number].petsc_slave_node_idxs;
+            for (unsigned int k = 0; k < petsc_mastr_node_idxs.size(); ++k)
+            {
+                const int mastr_idx = getGlobalNodeIndex(
+                    petsc_mastr_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
+                const int slave_idx = getGlobalNodeIndex(
+                    petsc_slave_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
 
-            const bool slave_is_local =
-                (slave_idx >= global_node_offset && slave_idx < global_node_offset + num_local_nodes);
+                const bool slave_is_local = petsc_slave_node_idxs[k] < NDIM * num_local_nodes;
 
-            static const int N = 2;
-            const int idxs[N] = { mastr_idx / NDIM, slave_idx / NDIM };
-            const double vals[N] = { 1.0, 1.0 };
+                static const int N = 2;
+                const int idxs[N] = { mastr_idx, slave_idx };
+                const double vals[N] = { 1.0, 1.0 };
 
-            if (slave_is_local)
-            {
-                ierr = VecSetValues(d_nnz_vec, N, idxs, vals, ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
-            else
-            {
-                ierr = VecSetValues(o_nnz_vec, N, idxs, vals, ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
+                if (slave_is_local)
+                {
+                    ierr = VecSetValues(d_nnz_vec, N, idxs, vals, ADD_VALUES);
+                    IBTK_CHKERRQ(ierr);
+                }
+                else
+                {
+                    ierr = VecSetValues(o_nnz_vec, N, idxs, vals, ADD_VALUES);
+                    IBTK_CHKERRQ(ierr);
+                }
             }
         }
-    }
 
-    { // Beam forces.
+        { // Beam forces.
 
-        const std::vector<int>& petsc_mastr_node_idxs = d_beam_data[level_number].petsc_mastr_node_idxs;
-        const std::vector<int>& petsc_next_node_idxs = d_beam_data[level_number].petsc_next_node_idxs;
-        const std::vector<int>& petsc_prev_node_idxs = d_beam_data[level_number].petsc_prev_node_idxs;
-        for (unsigned int k = 0; k < petsc_mastr_node_idxs.size(); ++k)
-        {
-            const int& mastr_idx = petsc_mastr_node_idxs[k];
-            const int& next_idx = petsc_next_node_idxs[k];
-            const int& prev_idx = petsc_prev_node_idxs[k];
+            const std::vector<int>& petsc_mastr_node_idxs = d_beam_data[level_number].petsc_mastr_node_idxs;
+            const std::vector<int>& petsc_next_node_idxs = d_beam_data[level_number].petsc_next_node_idxs;
+            const std::vector<int>& petsc_prev_node_idxs = d_beam_data[level_number].petsc_prev_node_idxs;
+            for (unsigned int k = 0; k < petsc_mastr_node_idxs.size(); ++k)
+            {
+                const int mastr_idx = getGlobalNodeIndex(
+                    petsc_mastr_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
+                const int next_idx = getGlobalNodeIndex(
+                    petsc_next_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
+                const int prev_idx = getGlobalNodeIndex(
+                    petsc_prev_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
 
-            const bool next_is_local =
-                (next_idx >= global_node_offset && next_idx < global_node_offset + num_local_nodes);
-            const bool prev_is_local =
-                (prev_idx >= global_node_offset && prev_idx < global_node_offset + num_local_nodes);
+                const bool next_is_local = petsc_next_node_idxs[k] < NDIM * num_local_nodes;
+                const bool prev_is_local = petsc_prev_node_idxs[k] < NDIM * num_local_nodes;
 
-            if (next_is_local && prev_is_local)
-            {
-                static const int d_N = 3;
-                const int d_idxs[d_N] = { mastr_idx / NDIM, next_idx / NDIM, prev_idx / NDIM };
-                const double d_vals[d_N] = { 2.0, 2.0, 2.0 };
-                ierr = VecSetValues(d_nnz_vec, d_N, d_idxs, d_vals, ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
-            else if (next_is_local && (!prev_is_local))
-            {
-                static const int d_N = 2;
-                const int d_idxs[d_N] = { mastr_idx / NDIM, next_idx / NDIM };
-                const double d_vals[d_N] = { 1.0, 1.0 };
-                ierr = VecSetValues(d_nnz_vec, d_N, d_idxs, d_vals, ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-
-                static const int o_N = 3;
-                const int o_idxs[o_N] = { mastr_idx / NDIM, next_idx / NDIM, prev_idx / NDIM };
-                const double o_vals[o_N] = { 1.0, 1.0, 2.0 };
-                ierr = VecSetValues(o_nnz_vec, o_N, o_idxs, o_vals, ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
-            else if ((!next_is_local) && prev_is_local)
-            {
-                static const int d_N = 2;
-                const int d_idxs[d_N] = { mastr_idx / NDIM, prev_idx / NDIM };
-                const double d_vals[d_N] = { 1.0, 1.0 };
-                ierr = VecSetValues(d_nnz_vec, d_N, d_idxs, d_vals, ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-
-                static const int o_N = 3;
-                const int o_idxs[o_N] = { mastr_idx / NDIM, next_idx / NDIM, prev_idx / NDIM };
-                const double o_vals[o_N] = { 1.0, 2.0, 1.0 };
-                ierr = VecSetValues(o_nnz_vec, o_N, o_idxs, o_vals, ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
-            else
-            {
-                // NOTE: Rather than trying to find out if the previous and next
-                // nodes are assigned to the same processor, we instead allocate
-                // space both for the case that the previous and next nodes are
-                // on different processors, and for the case that the previous
-                // and next nodes are on the same processor.
-                static const int d_N = 2;
-                const int d_idxs[d_N] = { next_idx / NDIM, prev_idx / NDIM };
-                const double d_vals[d_N] = { 2.0, 2.0 };
-                ierr = VecSetValues(d_nnz_vec, d_N, d_idxs, d_vals, ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-
-                static const int o_N = 3;
-                const int o_idxs[o_N] = { mastr_idx / NDIM, next_idx / NDIM, prev_idx / NDIM };
-                const double o_vals[o_N] = { 2.0, 2.0, 2.0 };
-                ierr = VecSetValues(o_nnz_vec, o_N, o_idxs, o_vals, ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
+                if (next_is_local && prev_is_local)
+                {
+                    static const int d_N = 3;
+                    const int d_idxs[d_N] = { mastr_idx, next_idx, prev_idx };
+                    const double d_vals[d_N] = { 2.0, 2.0, 2.0 };
+                    ierr = VecSetValues(d_nnz_vec, d_N, d_idxs, d_vals, ADD_VALUES);
+                    IBTK_CHKERRQ(ierr);
+                }
+                else if (next_is_local && (!prev_is_local))
+                {
+                    static const int d_N = 2;
+                    const int d_idxs[d_N] = { mastr_idx, next_idx };
+                    const double d_vals[d_N] = { 1.0, 1.0 };
+                    ierr = VecSetValues(d_nnz_vec, d_N, d_idxs, d_vals, ADD_VALUES);
+                    IBTK_CHKERRQ(ierr);
+
+                    static const int o_N = 3;
+                    const int o_idxs[o_N] = { mastr_idx, next_idx, prev_idx };
+                    const double o_vals[o_N] = { 1.0, 1.0, 2.0 };
+                    ierr = VecSetValues(o_nnz_vec, o_N, o_idxs, o_vals, ADD_VALUES);
+                    IBTK_CHKERRQ(ierr);
+                }
+                else if ((!next_is_local) && prev_is_local)
+                {
+                    static const int d_N = 2;
+                    const int d_idxs[d_N] = { mastr_idx, prev_idx };
+                    const double d_vals[d_N] = { 1.0, 1.0 };
+                    ierr = VecSetValues(d_nnz_vec, d_N, d_idxs, d_vals, ADD_VALUES);
+                    IBTK_CHKERRQ(ierr);
+
+                    static const int o_N = 3;
+                    const int o_idxs[o_N] = { mastr_idx, next_idx, prev_idx };
+                    const double o_vals[o_N] = { 1.0, 2.0, 1.0 };
+                    ierr = VecSetValues(o_nnz_vec, o_N, o_idxs, o_vals, ADD_VALUES);
+                    IBTK_CHKERRQ(ierr);
+                }
+                else
+                {
+                    // NOTE: Rather than trying to find out if the previous and
+                    // next nodes are assigned to the same processor, we instead
+                    // allocate space both for the case that the previous and
+                    // next nodes are on different processors, and for the case
+                    // that the previous and next nodes are on the same
+                    // processor.
+                    static const int d_N = 2;
+                    const int d_idxs[d_N] = { next_idx, prev_idx };
+                    const double d_vals[d_N] = { 2.0, 2.0 };
+                    ierr = VecSetValues(d_nnz_vec, d_N, d_idxs, d_vals, ADD_VALUES);
+                    IBTK_CHKERRQ(ierr);
+
+                    static const int o_N = 3;
+                    const int o_idxs[o_N] = { mastr_idx, next_idx, prev_idx };
+                    const double o_vals[o_N] = { 2.0, 2.0, 2.0 };
+                    ierr = VecSetValues(o_nnz_vec, o_N, o_idxs, o_vals, ADD_VALUES);
+                    IBTK_CHKERRQ(ierr);
+                }
             }
         }
-    }
 
-    ierr = VecAssemblyBegin(d_nnz_vec);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyBegin(o_nnz_vec);
-    IBTK_CHKERRQ(ierr);
+        ierr = VecAssemblyBegin(d_nnz_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAssemblyBegin(o_nnz_vec);
+        IBTK_CHKERRQ(ierr);
+
+        ierr = VecAssemblyEnd(d_nnz_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAssemblyEnd(o_nnz_vec);
+        IBTK_CHKERRQ(ierr);
+
+        double* d_nnz_vec_arr;
+        ierr = VecGetArray(d_nnz_vec, &d_nnz_vec_arr);
+        IBTK_CHKERRQ(ierr);
+
+        double* o_nnz_vec_arr;
+        ierr = VecGetArray(o_nnz_vec, &o_nnz_vec_arr);
+        IBTK_CHKERRQ(ierr);
+
+        // The number of nonzero blocks in any block row cannot exceed the
+        // number of block columns.
+        int num_global_nodes;
+        ierr = VecGetSize(d_nnz_vec, &num_global_nodes);
+        IBTK_CHKERRQ(ierr);
+        std::vector<int>& jac_d_nnz = d_jac_d_nnz[level_number];
+        std::vector<int>& jac_o_nnz = d_jac_o_nnz[level_number];
+        jac_d_nnz.resize(num_local_nodes);
+        jac_o_nnz.resize(num_local_nodes);
+        for (int k = 0; k < num_local_nodes; ++k)
+        {
+            jac_d_nnz[k] = std::min(static_cast<int>(d_nnz_vec_arr[k]), num_local_nodes);
+            jac_o_nnz[k] = std::min(static_cast<int>(o_nnz_vec_arr[k]), num_global_nodes - num_local_nodes);
+        }
 
-    ierr = VecAssemblyEnd(d_nnz_vec);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(o_nnz_vec);
-    IBTK_CHKERRQ(ierr);
+        ierr = VecRestoreArray(d_nnz_vec, &d_nnz_vec_arr);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecRestoreArray(o_nnz_vec, &o_nnz_vec_arr);
+        IBTK_CHKERRQ(ierr);
 
-    double* d_nnz_vec_arr;
-    ierr = VecGetArray(d_nnz_vec, &d_nnz_vec_arr);
-    IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&d_nnz_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&o_nnz_vec);
+        IBTK_CHKERRQ(ierr);
 
-    double* o_nnz_vec_arr;
-    ierr = VecGetArray(o_nnz_vec, &o_nnz_vec_arr);
-    IBTK_CHKERRQ(ierr);
+        d_jac_nnz_is_cached[level_number] = true;
+    }
 
+    const std::vector<int>& jac_d_nnz = d_jac_d_nnz[level_number];
+    const std::vector<int>& jac_o_nnz = d_jac_o_nnz[level_number];
     for (int k = 0; k < num_local_nodes; ++k)
     {
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            d_nnz[NDIM * k + d] += static_cast<int>(d_nnz_vec_arr[k]);
-            o_nnz[NDIM * k + d] += static_cast<int>(o_nnz_vec_arr[k]);
+            d_nnz[NDIM * k + d] += jac_d_nnz[k];
+            o_nnz[NDIM * k + d] += jac_o_nnz[k];
         }
     }
-
-    ierr = VecRestoreArray(d_nnz_vec, &d_nnz_vec_arr);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecRestoreArray(o_nnz_vec, &o_nnz_vec_arr);
-    IBTK_CHKERRQ(ierr);
-
-    ierr = VecDestroy(&d_nnz_vec);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecDestroy(&o_nnz_vec);
-    IBTK_CHKERRQ(ierr);
     return;
 } // computeLagrangianForceJacobianNonzeroStructure
 
@@ -514,6 +766,24 @@ void IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
 #endif
 
     int ierr;
+
+    // Determine the global node offset and the number of local nodes.
+    const int global_node_offset = l_data_manager->getGlobalNodeOffset(level_number);
+    const int num_local_nodes = l_data_manager->getNumberOfLocalNodes(level_number);
+    const std::vector<int>& nonlocal_petsc_idxs = d_nonlocal_petsc_idxs[level_number];
+
+    // The cached PETSc indices refer to the ghosted data maintained by this
+    // object, so fill the ghosted position data in the same manner as is done
+    // when computing the force.
+    Pointer<LData> X_ghost_data = d_X_ghost_data[level_number];
+    Pointer<LData> dX_data = d_dX_data[level_number];
+    ierr = VecAXPBYPCZ(X_ghost_data->getVec(), 1.0, 1.0, 0.0, X_data->getVec(), dX_data->getVec());
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateBegin(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+
     { // Spring forces.
 
         const std::vector<int>& lag_mastr_node_idxs = d_spring_data[level_number].lag_mastr_node_idxs;
@@ -523,18 +793,19 @@ void IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
         const std::vector<SpringForceFcnPtr>& force_fcns = d_spring_data[level_number].force_fcns;
         const std::vector<SpringForceDerivFcnPtr>& force_deriv_fcns = d_spring_data[level_number].force_deriv_fcns;
         const std::vector<const double*>& parameters = d_spring_data[level_number].parameters;
-        const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+        const double* const X_node = X_ghost_data->getGhostedLocalFormVecArray()->data();
         MatrixNd dF_dX;
         Vector D;
         double R, T, dT_dR, eps;
+        double J_vals[2 * NDIM][2 * NDIM];
         for (unsigned int k = 0; k < petsc_mastr_node_idxs.size(); ++k)
         {
             // Compute the Jacobian of the force applied by the spring to the
             // "master" node with respect to the position of the "slave" node.
             const int& lag_mastr_idx = lag_mastr_node_idxs[k];
             const int& lag_slave_idx = lag_slave_node_idxs[k];
-            int petsc_mastr_idx = petsc_mastr_node_idxs[k];
-            int petsc_slave_idx = petsc_slave_node_idxs[k];
+            const int& petsc_mastr_idx = petsc_mastr_node_idxs[k];
+            const int& petsc_slave_idx = petsc_slave_node_idxs[k];
             const SpringForceFcnPtr force_fcn = force_fcns[k];
             const SpringForceDerivFcnPtr force_deriv_fcn = force_deriv_fcns[k];
             const double* const params = parameters[k];
@@ -564,25 +835,25 @@ void IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
                 }
             }
 
-            // Change the indices to block indices.
-            petsc_mastr_idx /= NDIM;
-            petsc_slave_idx /= NDIM;
-
-            // Accumulate the off-diagonal parts of the matrix.
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_mastr_idx, 1, &petsc_slave_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_slave_idx, 1, &petsc_mastr_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-
-            // Negate dF_dX to obtain the Jacobian of the force applied by the
-            // spring to the "master" node with respect to the position of the
-            // "master" node.
-            dF_dX *= -1.0;
+            // The off-diagonal blocks of the element matrix are dF_dX, and the
+            // diagonal blocks (i.e., the Jacobian of the force applied by the
+            // spring to each node with respect to the position of that node)
+            // are -dF_dX.
+            for (unsigned int i = 0; i < NDIM; ++i)
+            {
+                for (unsigned int j = 0; j < NDIM; ++j)
+                {
+                    J_vals[i][j] = J_vals[NDIM + i][NDIM + j] = -dF_dX(i, j);
+                    J_vals[i][NDIM + j] = J_vals[NDIM + i][j] = dF_dX(i, j);
+                }
+            }
 
-            // Accumulate the diagonal parts of the matrix.
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_mastr_idx, 1, &petsc_mastr_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_slave_idx, 1, &petsc_slave_idx, dF_dX.data(), ADD_VALUES);
+            // Accumulate the element matrix using global block indices.
+            const int idxs[2] = {
+                getGlobalNodeIndex(petsc_mastr_idx, global_node_offset, num_local_nodes, nonlocal_petsc_idxs),
+                getGlobalNodeIndex(petsc_slave_idx, global_node_offset, num_local_nodes, nonlocal_petsc_idxs)
+            };
+            ierr = MatSetValuesBlocked(J_mat, 2, idxs, 2, idxs, &J_vals[0][0], ADD_VALUES);
             IBTK_CHKERRQ(ierr);
         }
     }
@@ -593,45 +864,32 @@ void IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
         const std::vector<int>& petsc_next_node_idxs = d_beam_data[level_number].petsc_next_node_idxs;
         const std::vector<int>& petsc_prev_node_idxs = d_beam_data[level_number].petsc_prev_node_idxs;
         const std::vector<const double*>& rigidities = d_beam_data[level_number].rigidities;
-        MatrixNd dF_dX(MatrixNd::Zero());
+
+        // The element matrix is (bend * X_coef) times the following 3 x 3 block
+        // stencil (with each block a multiple of the NDIM x NDIM identity) for
+        // the (master, next, previous) nodes.
+        static const double stencil[3][3] = { { -4.0, 2.0, 2.0 }, { 2.0, -1.0, -1.0 }, { 2.0, -1.0, -1.0 } };
+        double J_vals[3 * NDIM][3 * NDIM];
+        std::fill(&J_vals[0][0], &J_vals[0][0] + 9 * NDIM * NDIM, 0.0);
         for (unsigned int k = 0; k < petsc_mastr_node_idxs.size(); ++k)
         {
-            const int petsc_mastr_idx = petsc_mastr_node_idxs[k] / NDIM; // block indices
-            const int petsc_next_idx = petsc_next_node_idxs[k] / NDIM;
-            const int petsc_prev_idx = petsc_prev_node_idxs[k] / NDIM;
+            const int idxs[3] = {
+                getGlobalNodeIndex(petsc_mastr_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs),
+                getGlobalNodeIndex(petsc_next_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs),
+                getGlobalNodeIndex(petsc_prev_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs)
+            };
             const double& bend = *rigidities[k];
-
-            for (unsigned int alpha = 0; alpha < NDIM; ++alpha)
-            {
-                dF_dX(alpha, alpha) = -1.0 * bend * X_coef;
-            }
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_prev_idx, 1, &petsc_prev_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_prev_idx, 1, &petsc_next_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_next_idx, 1, &petsc_prev_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_next_idx, 1, &petsc_next_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-
-            for (unsigned int alpha = 0; alpha < NDIM; ++alpha)
-            {
-                dF_dX(alpha, alpha) = +2.0 * bend * X_coef;
-            }
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_prev_idx, 1, &petsc_mastr_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_next_idx, 1, &petsc_mastr_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_mastr_idx, 1, &petsc_prev_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_mastr_idx, 1, &petsc_next_idx, dF_dX.data(), ADD_VALUES);
-            IBTK_CHKERRQ(ierr);
-
-            for (unsigned int alpha = 0; alpha < NDIM; ++alpha)
+            for (unsigned int a = 0; a < 3; ++a)
             {
-                dF_dX(alpha, alpha) = -4.0 * bend * X_coef;
+                for (unsigned int b = 0; b < 3; ++b)
+                {
+                    for (unsigned int alpha = 0; alpha < NDIM; ++alpha)
+                    {
+                        J_vals[NDIM * a + alpha][NDIM * b + alpha] = stencil[a][b] * bend * X_coef;
+                    }
+                }
             }
-            ierr = MatSetValuesBlocked(J_mat, 1, &petsc_mastr_idx, 1, &petsc_mastr_idx, dF_dX.data(), ADD_VALUES);
+            ierr = MatSetValuesBlocked(J_mat, 3, idxs, 3, idxs, &J_vals[0][0], ADD_VALUES);
             IBTK_CHKERRQ(ierr);
         }
     }
@@ -644,7 +902,8 @@ void IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
         MatrixNd dF_dX(MatrixNd::Zero());
         for (unsigned int k = 0; k < petsc_node_idxs.size(); ++k)
         {
-            const int petsc_node_idx = petsc_node_idxs[k] / NDIM; // block index
+            const int petsc_node_idx = getGlobalNodeIndex(
+                petsc_node_idxs[k], global_node_offset, num_local_nodes, nonlocal_petsc_idxs); // block index
             const double& K = *kappa[k];
             const double& E = *eta[k];
             for (unsigned int alpha = 0; alpha < NDIM; ++alpha)
@@ -682,6 +941,184 @@ double IBStandardForceGen::computeLagrangianEnergy(Pointer<LData> /*X_data*/,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void IBStandardForceGen::initializeFusedLevelData(const int level_number, LDataManager* const l_data_manager)
+{
+    const int num_local_nodes = l_data_manager->getNumberOfLocalNodes(level_number);
+    const std::vector<int>& spring_mastr_node_idxs = d_spring_data[level_number].petsc_mastr_node_idxs;
+    const std::vector<int>& beam_mastr_node_idxs = d_beam_data[level_number].petsc_mastr_node_idxs;
+    const std::vector<int>& target_point_node_idxs = d_target_point_data[level_number].petsc_node_idxs;
+    FusedData& fused_data = d_fused_data[level_number];
+
+    // Group the springs and beams by their master nodes via counting sorts.
+    // The cached PETSc indices are local indices for data of depth NDIM.
+    // Within each group, the springs and beams retain their relative ordering.
+    const int num_springs = static_cast<int>(spring_mastr_node_idxs.size());
+    fused_data.spring_offsets.assign(num_local_nodes + 1, 0);
+    for (int k = 0; k < num_springs; ++k)
+    {
+        ++fused_data.spring_offsets[spring_mastr_node_idxs[k] / NDIM + 1];
+    }
+    std::partial_sum(
+        fused_data.spring_offsets.begin(), fused_data.spring_offsets.end(), fused_data.spring_offsets.begin());
+    fused_data.spring_idxs.resize(num_springs);
+    std::vector<int> spring_posns(fused_data.spring_offsets.begin(), fused_data.spring_offsets.end() - 1);
+    for (int k = 0; k < num_springs; ++k)
+    {
+        fused_data.spring_idxs[spring_posns[spring_mastr_node_idxs[k] / NDIM]++] = k;
+    }
+
+    const int num_beams = static_cast<int>(beam_mastr_node_idxs.size());
+    fused_data.beam_offsets.assign(num_local_nodes + 1, 0);
+    for (int k = 0; k < num_beams; ++k)
+    {
+        ++fused_data.beam_offsets[beam_mastr_node_idxs[k] / NDIM + 1];
+    }
+    std::partial_sum(fused_data.beam_offsets.begin(), fused_data.beam_offsets.end(), fused_data.beam_offsets.begin());
+    fused_data.beam_idxs.resize(num_beams);
+    std::vector<int> beam_posns(fused_data.beam_offsets.begin(), fused_data.beam_offsets.end() - 1);
+    for (int k = 0; k < num_beams; ++k)
+    {
+        fused_data.beam_idxs[beam_posns[beam_mastr_node_idxs[k] / NDIM]++] = k;
+    }
+
+    // Each node has at most one target point.
+    fused_data.target_point_idxs.assign(num_local_nodes, -1);
+    for (unsigned int k = 0; k < target_point_node_idxs.size(); ++k)
+    {
+        fused_data.target_point_idxs[target_point_node_idxs[k] / NDIM] = k;
+    }
+    return;
+} // initializeFusedLevelData
+
+void IBStandardForceGen::computeLagrangianFusedForce(Pointer<LData> F_data,
+                                                     Pointer<LData> X_data,
+                                                     Pointer<LData> U_data,
+                                                     const int level_number,
+                                                     LDataManager* const l_data_manager)
+{
+    IBAMR_TIMER_START(t_compute_lagrangian_fused_force);
+
+    const int num_local_nodes = l_data_manager->getNumberOfLocalNodes(level_number);
+    const FusedData& fused_data = d_fused_data[level_number];
+    const SpringData& spring_data = d_spring_data[level_number];
+    const BeamData& beam_data = d_beam_data[level_number];
+    const TargetPointData& target_point_data = d_target_point_data[level_number];
+    double* const F_node = F_data->getLocalFormVecArray()->data();
+    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+    const double* const U_node = U_data->getLocalFormVecArray()->data();
+
+    // Compute all of the forces associated with each local node before moving
+    // on to the next node.
+    for (int m = 0; m < num_local_nodes; ++m)
+    {
+        const int mastr_idx = NDIM * m;
+
+        // Spring forces.
+        for (int s = fused_data.spring_offsets[m]; s < fused_data.spring_offsets[m + 1]; ++s)
+        {
+            const int k = fused_data.spring_idxs[s];
+            const int slave_idx = spring_data.petsc_slave_node_idxs[k];
+#if !defined(NDEBUG)
+            TBOX_ASSERT(mastr_idx == spring_data.petsc_mastr_node_idxs[k]);
+            TBOX_ASSERT(mastr_idx != slave_idx);
+#endif
+            double D[NDIM];
+            D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
+            D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
+#if (NDIM == 3)
+            D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
+#endif
+#if (NDIM == 2)
+            const double R = sqrt(D[0] * D[0] + D[1] * D[1]);
+#endif
+#if (NDIM == 3)
+            const double R = sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
+#endif
+            if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
+            const double* const params = spring_data.parameters[k];
+            const SpringForceFcnPtr force_fcn = spring_data.force_fcns[k];
+            const double T_over_R =
+                (force_fcn == &default_spring_force ?
+                     params[0] * (R - params[1]) :
+                     force_fcn(R, params, spring_data.lag_mastr_node_idxs[k], spring_data.lag_slave_node_idxs[k])) /
+                R;
+            double F[NDIM];
+            F[0] = T_over_R * D[0];
+            F[1] = T_over_R * D[1];
+#if (NDIM == 3)
+            F[2] = T_over_R * D[2];
+#endif
+            F_node[mastr_idx + 0] += F[0];
+            F_node[mastr_idx + 1] += F[1];
+#if (NDIM == 3)
+            F_node[mastr_idx + 2] += F[2];
+#endif
+            F_node[slave_idx + 0] -= F[0];
+            F_node[slave_idx + 1] -= F[1];
+#if (NDIM == 3)
+            F_node[slave_idx + 2] -= F[2];
+#endif
+        }
+
+        // Beam forces.
+        for (int b = fused_data.beam_offsets[m]; b < fused_data.beam_offsets[m + 1]; ++b)
+        {
+            const int k = fused_data.beam_idxs[b];
+            const int next_idx = beam_data.petsc_next_node_idxs[k];
+            const int prev_idx = beam_data.petsc_prev_node_idxs[k];
+#if !defined(NDEBUG)
+            TBOX_ASSERT(mastr_idx == beam_data.petsc_mastr_node_idxs[k]);
+            TBOX_ASSERT(mastr_idx != next_idx);
+            TBOX_ASSERT(mastr_idx != prev_idx);
+#endif
+            const double K = *beam_data.rigidities[k];
+            const double* const D2X0 = beam_data.curvatures[k]->data();
+            double F[NDIM];
+            F[0] = K * (X_node[next_idx + 0] + X_node[prev_idx + 0] - 2.0 * X_node[mastr_idx + 0] - D2X0[0]);
+            F[1] = K * (X_node[next_idx + 1] + X_node[prev_idx + 1] - 2.0 * X_node[mastr_idx + 1] - D2X0[1]);
+#if (NDIM == 3)
+            F[2] = K * (X_node[next_idx + 2] + X_node[prev_idx + 2] - 2.0 * X_node[mastr_idx + 2] - D2X0[2]);
+#endif
+            F_node[mastr_idx + 0] += 2.0 * F[0];
+            F_node[mastr_idx + 1] += 2.0 * F[1];
+#if (NDIM == 3)
+            F_node[mastr_idx + 2] += 2.0 * F[2];
+#endif
+            F_node[next_idx + 0] -= F[0];
+            F_node[next_idx + 1] -= F[1];
+#if (NDIM == 3)
+            F_node[next_idx + 2] -= F[2];
+#endif
+            F_node[prev_idx + 0] -= F[0];
+            F_node[prev_idx + 1] -= F[1];
+#if (NDIM == 3)
+            F_node[prev_idx + 2] -= F[2];
+#endif
+        }
+
+        // Target point forces.
+        const int k = fused_data.target_point_idxs[m];
+        if (k >= 0)
+        {
+            const double K = *target_point_data.kappa[k];
+            const double E = *target_point_data.eta[k];
+            const double* const X_target = target_point_data.X0[k]->data();
+            F_node[mastr_idx + 0] += K * (X_target[0] - X_node[mastr_idx + 0]) - E * U_node[mastr_idx + 0];
+            F_node[mastr_idx + 1] += K * (X_target[1] - X_node[mastr_idx + 1]) - E * U_node[mastr_idx + 1];
+#if (NDIM == 3)
+            F_node[mastr_idx + 2] += K * (X_target[2] - X_node[mastr_idx + 2]) - E * U_node[mastr_idx + 2];
+#endif
+        }
+    }
+
+    F_data->restoreArrays();
+    X_data->restoreArrays();
+    U_data->restoreArrays();
+
+    IBAMR_TIMER_STOP(t_compute_lagrangian_fused_force);
+    return;
+} // computeLagrangianFusedForce
+
 void IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_set,
                                                    const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                                    const int level_number,
@@ -764,14 +1201,48 @@ void IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc
     // NOTE: Only slave nodes can be "off processor".  Master nodes are
     // guaranteed to be "on processor".
     const int global_node_offset = l_data_manager->getGlobalNodeOffset(level_number);
+    std::vector<bool> is_boundary_spring(num_springs, false);
     for (unsigned int k = 0; k < petsc_slave_node_idxs.size(); ++k)
     {
         const int idx = petsc_slave_node_idxs[k];
         if (UNLIKELY(idx < global_node_offset || idx >= global_node_offset + num_local_nodes))
         {
             nonlocal_petsc_idx_set.insert(idx);
+            is_boundary_spring[k] = true;
+        }
+    }
+
+    // Reorder the springs so that the interior springs (i.e., those whose nodes
+    // are all local) are stored before the boundary springs (i.e., those that
+    // involve ghost nodes), and so that within each of these sets, the springs
+    // that use the default linear spring force function are stored first.
+    // Otherwise, springs retain their relative ordering.
+    std::vector<int> spring_order;
+    spring_order.reserve(num_springs);
+    int num_linear_springs[2] = { 0, 0 };
+    for (int boundary = 0; boundary < 2; ++boundary)
+    {
+        for (int linear = 1; linear >= 0; --linear)
+        {
+            for (unsigned int k = 0; k < num_springs; ++k)
+            {
+                if (static_cast<int>(is_boundary_spring[k]) != boundary) continue;
+                if (static_cast<int>(force_fcns[k] == &default_spring_force) != linear) continue;
+                spring_order.push_back(k);
+                if (linear) ++num_linear_springs[boundary];
+            }
         }
+        if (!boundary) d_spring_data[level_number].num_interior_springs = static_cast<int>(spring_order.size());
     }
+    applyPermutation(lag_mastr_node_idxs, spring_order);
+    applyPermutation(lag_slave_node_idxs, spring_order);
+    applyPermutation(petsc_mastr_node_idxs, spring_order);
+    applyPermutation(petsc_slave_node_idxs, spring_order);
+    applyPermutation(force_fcns, spring_order);
+    applyPermutation(force_deriv_fcns, spring_order);
+    applyPermutation(parameters, spring_order);
+    d_spring_data[level_number].num_interior_linear_springs = num_linear_springs[0];
+    d_spring_data[level_number].num_boundary_linear_springs = num_linear_springs[1];
     return;
 } // initializeSpringLevelData
 
@@ -780,9 +1251,18 @@ void IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                       const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                                       const int level_number,
                                                       const double /*data_time*/,
-                                                      LDataManager* const /*l_data_manager*/)
+                                                      LDataManager* const /*l_data_manager*/,
+                                                      const bool interior)
 {
+    IBAMR_TIMER_START(t_compute_lagrangian_spring_force);
+
     const int num_springs = static_cast<int>(d_spring_data[level_number].lag_mastr_node_idxs.size());
+    const int num_interior_springs = d_spring_data[level_number].num_interior_springs;
+    const int spring_begin = interior ? 0 : num_interior_springs;
+    const int spring_end = interior ? num_interior_springs : num_springs;
+    const int linear_spring_end = spring_begin + (interior ? d_spring_data[level_number].num_interior_linear_springs :
+                                                             d_spring_data[level_number].num_boundary_linear_springs);
+    const std::vector<int>& color_offsets = d_spring_data[level_number].color_offsets;
     const int* const lag_mastr_node_idxs = &d_spring_data[level_number].lag_mastr_node_idxs[0];
     const int* const lag_slave_node_idxs = &d_spring_data[level_number].lag_slave_node_idxs[0];
     const int* const petsc_mastr_node_idxs = &d_spring_data[level_number].petsc_mastr_node_idxs[0];
@@ -790,103 +1270,180 @@ void IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
     const SpringForceFcnPtr* const force_fcns = &d_spring_data[level_number].force_fcns[0];
     const double** const parameters = &d_spring_data[level_number].parameters[0];
     double* const F_node = F_data->getLocalFormVecArray()->data();
-    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
+    // NOTE: The interior springs involve only local nodes and are computed while
+    // the ghost node positions are being communicated, so only a read-only view
+    // of the locally owned positions is obtained; the ghosted local form of the
+    // position vector may not be accessed until the ghost update has completed.
+    int ierr;
+    const double* X_node = NULL;
+    if (interior)
+    {
+        ierr = VecGetArrayRead(X_data->getVec(), &X_node);
+        IBTK_CHKERRQ(ierr);
+    }
+    else
+    {
+        X_node = X_data->getGhostedLocalFormVecArray()->data();
+    }
+
+    // The springs are processed one color at a time.  Springs of the same
+    // color do not share any nodes, so that when threading is enabled, the
+    // forces generated by the springs of a single color are accumulated
+    // concurrently without any write conflicts.
     static const int BLOCKSIZE = 16; // this parameter needs to be tuned
-    int k, kblock, kunroll, mastr_idx, slave_idx;
-    double F[NDIM], D[NDIM], R, T_over_R;
-    kblock = 0;
-    for (; kblock < (num_springs - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
+    for (unsigned int c = 0; c + 1 < color_offsets.size(); ++c)
     {
-        PREFETCH_READ_NTA_BLOCK(lag_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(lag_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(force_fcns + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(parameters + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
+        const int color_begin = color_offsets[c];
+        const int color_end = color_offsets[c + 1];
+        if (color_begin < spring_begin || color_begin >= spring_end) continue;
+
+        if (color_begin < linear_spring_end)
         {
-            k = kblock * BLOCKSIZE + kunroll;
-            mastr_idx = petsc_mastr_node_idxs[k];
-            slave_idx = petsc_slave_node_idxs[k];
+            // Compute the forces generated by the springs that use the default
+            // linear spring force function.  Each block of springs is
+            // processed in three passes: the displacements and spring
+            // parameters are gathered into contiguous arrays, the tensions are
+            // computed in a loop that does not involve any function calls (and
+            // that may therefore be vectorized by the compiler), and finally
+            // the forces are accumulated.
+            //
+            // NOTE: The spring parameters are read through the cached parameter
+            // pointers at every evaluation, so that any modifications made to
+            // the parameters stored in the IBSpringForceSpec objects are
+            // respected.
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+            for (int kstart = color_begin; kstart < color_end; kstart += BLOCKSIZE)
+            {
+                const int block_size = std::min(BLOCKSIZE, color_end - kstart);
+                double D_block[NDIM][BLOCKSIZE], kappa_block[BLOCKSIZE], rest_length_block[BLOCKSIZE],
+                    T_over_R_block[BLOCKSIZE];
+                for (int kunroll = 0; kunroll < block_size; ++kunroll)
+                {
+                    const int k = kstart + kunroll;
+                    const int mastr_idx = petsc_mastr_node_idxs[k];
+                    const int slave_idx = petsc_slave_node_idxs[k];
 #if !defined(NDEBUG)
-            TBOX_ASSERT(mastr_idx != slave_idx);
+                    TBOX_ASSERT(mastr_idx != slave_idx);
 #endif
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(parameters[k + 1]);
-            D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-            D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
+                    D_block[0][kunroll] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
+                    D_block[1][kunroll] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
 #if (NDIM == 3)
-            D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
+                    D_block[2][kunroll] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
 #endif
+                    kappa_block[kunroll] = parameters[k][0];
+                    rest_length_block[kunroll] = parameters[k][1];
+                }
+                for (int kunroll = 0; kunroll < block_size; ++kunroll)
+                {
 #if (NDIM == 2)
-            R = sqrt(D[0] * D[0] + D[1] * D[1]);
+                    const double R =
+                        sqrt(D_block[0][kunroll] * D_block[0][kunroll] + D_block[1][kunroll] * D_block[1][kunroll]);
 #endif
 #if (NDIM == 3)
-            R = sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
+                    const double R =
+                        sqrt(D_block[0][kunroll] * D_block[0][kunroll] + D_block[1][kunroll] * D_block[1][kunroll] +
+                             D_block[2][kunroll] * D_block[2][kunroll]);
 #endif
-            if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-            T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-            F[0] = T_over_R * D[0];
-            F[1] = T_over_R * D[1];
+                    // Degenerate springs do not generate any force.
+                    const double R_safe = std::max(R, std::numeric_limits<double>::epsilon());
+                    T_over_R_block[kunroll] = R < std::numeric_limits<double>::epsilon() ?
+                                                  0.0 :
+                                                  kappa_block[kunroll] * (R - rest_length_block[kunroll]) / R_safe;
+                }
+                for (int kunroll = 0; kunroll < block_size; ++kunroll)
+                {
+                    const int k = kstart + kunroll;
+                    const int mastr_idx = petsc_mastr_node_idxs[k];
+                    const int slave_idx = petsc_slave_node_idxs[k];
+                    double F[NDIM];
+                    F[0] = T_over_R_block[kunroll] * D_block[0][kunroll];
+                    F[1] = T_over_R_block[kunroll] * D_block[1][kunroll];
 #if (NDIM == 3)
-            F[2] = T_over_R * D[2];
+                    F[2] = T_over_R_block[kunroll] * D_block[2][kunroll];
 #endif
-            F_node[mastr_idx + 0] += F[0];
-            F_node[mastr_idx + 1] += F[1];
+                    F_node[mastr_idx + 0] += F[0];
+                    F_node[mastr_idx + 1] += F[1];
 #if (NDIM == 3)
-            F_node[mastr_idx + 2] += F[2];
+                    F_node[mastr_idx + 2] += F[2];
 #endif
-            F_node[slave_idx + 0] -= F[0];
-            F_node[slave_idx + 1] -= F[1];
+                    F_node[slave_idx + 0] -= F[0];
+                    F_node[slave_idx + 1] -= F[1];
 #if (NDIM == 3)
-            F_node[slave_idx + 2] -= F[2];
+                    F_node[slave_idx + 2] -= F[2];
 #endif
+                }
+            }
         }
-    }
-    for (k = kblock * BLOCKSIZE; k < num_springs; ++k)
-    {
-        mastr_idx = petsc_mastr_node_idxs[k];
-        slave_idx = petsc_slave_node_idxs[k];
+        else
+        {
+            // Compute the forces generated by the springs that use user-defined
+            // spring force functions.
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+            for (int k = color_begin; k < color_end; ++k)
+            {
+                const int mastr_idx = petsc_mastr_node_idxs[k];
+                const int slave_idx = petsc_slave_node_idxs[k];
 #if !defined(NDEBUG)
-        TBOX_ASSERT(mastr_idx != slave_idx);
+                TBOX_ASSERT(mastr_idx != slave_idx);
 #endif
-        D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-        D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
+                if (LIKELY(k + 1 < color_end))
+                {
+                    PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
+                    PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_slave_node_idxs[k + 1]);
+                    PREFETCH_READ_NTA(parameters[k + 1]);
+                }
+                double D[NDIM];
+                D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
+                D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
 #if (NDIM == 3)
-        D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
+                D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
 #endif
 #if (NDIM == 2)
-        R = sqrt(D[0] * D[0] + D[1] * D[1]);
+                const double R = sqrt(D[0] * D[0] + D[1] * D[1]);
 #endif
 #if (NDIM == 3)
-        R = sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
+                const double R = sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
 #endif
-        if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-        T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-        F[0] = T_over_R * D[0];
-        F[1] = T_over_R * D[1];
+                if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
+                const double T_over_R =
+                    (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
+                double F[NDIM];
+                F[0] = T_over_R * D[0];
+                F[1] = T_over_R * D[1];
 #if (NDIM == 3)
-        F[2] = T_over_R * D[2];
+                F[2] = T_over_R * D[2];
 #endif
-        F_node[mastr_idx + 0] += F[0];
-        F_node[mastr_idx + 1] += F[1];
+                F_node[mastr_idx + 0] += F[0];
+                F_node[mastr_idx + 1] += F[1];
 #if (NDIM == 3)
-        F_node[mastr_idx + 2] += F[2];
+                F_node[mastr_idx + 2] += F[2];
 #endif
-        F_node[slave_idx + 0] -= F[0];
-        F_node[slave_idx + 1] -= F[1];
+                F_node[slave_idx + 0] -= F[0];
+                F_node[slave_idx + 1] -= F[1];
 #if (NDIM == 3)
-        F_node[slave_idx + 2] -= F[2];
+                F_node[slave_idx + 2] -= F[2];
 #endif
+            }
+        }
     }
 
     F_data->restoreArrays();
-    X_data->restoreArrays();
+    if (interior)
+    {
+        ierr = VecRestoreArrayRead(X_data->getVec(), &X_node);
+        IBTK_CHKERRQ(ierr);
+    }
+    else
+    {
+        X_data->restoreArrays();
+    }
+
+    IBAMR_TIMER_STOP(t_compute_lagrangian_spring_force);
     return;
 } // computeLagrangianSpringForce
 
@@ -983,6 +1540,31 @@ void IBStandardForceGen::initializeBeamLevelData(std::set<int>& nonlocal_petsc_i
             nonlocal_petsc_idx_set.insert(idx);
         }
     }
+
+    // Reorder the beams so that the interior beams (i.e., those whose nodes are
+    // all local) are stored before the boundary beams (i.e., those that involve
+    // ghost nodes).  Otherwise, beams retain their relative ordering.
+    std::vector<int> beam_order;
+    beam_order.reserve(num_beams);
+    for (int boundary = 0; boundary < 2; ++boundary)
+    {
+        for (unsigned int k = 0; k < num_beams; ++k)
+        {
+            const int next_idx = petsc_next_node_idxs[k];
+            const int prev_idx = petsc_prev_node_idxs[k];
+            const bool is_boundary_beam = next_idx < global_node_offset ||
+                                          next_idx >= global_node_offset + num_local_nodes ||
+                                          prev_idx < global_node_offset ||
+                                          prev_idx >= global_node_offset + num_local_nodes;
+            if (static_cast<int>(is_boundary_beam) == boundary) beam_order.push_back(k);
+        }
+        if (!boundary) d_beam_data[level_number].num_interior_beams = static_cast<int>(beam_order.size());
+    }
+    applyPermutation(petsc_mastr_node_idxs, beam_order);
+    applyPermutation(petsc_next_node_idxs, beam_order);
+    applyPermutation(petsc_prev_node_idxs, beam_order);
+    applyPermutation(rigidities, beam_order);
+    applyPermutation(curvatures, beam_order);
     return;
 } // initializeBeamLevelData
 
@@ -991,51 +1573,71 @@ void IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
                                                     const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                                     const int level_number,
                                                     const double /*data_time*/,
-                                                    LDataManager* const /*l_data_manager*/)
+                                                    LDataManager* const /*l_data_manager*/,
+                                                    const bool interior)
 {
+    IBAMR_TIMER_START(t_compute_lagrangian_beam_force);
+
     const int num_beams = static_cast<int>(d_beam_data[level_number].petsc_mastr_node_idxs.size());
+    const int num_interior_beams = d_beam_data[level_number].num_interior_beams;
+    const int beam_begin = interior ? 0 : num_interior_beams;
+    const int beam_end = interior ? num_interior_beams : num_beams;
+    const std::vector<int>& color_offsets = d_beam_data[level_number].color_offsets;
     const int* const petsc_mastr_node_idxs = &d_beam_data[level_number].petsc_mastr_node_idxs[0];
     const int* const petsc_next_node_idxs = &d_beam_data[level_number].petsc_next_node_idxs[0];
     const int* const petsc_prev_node_idxs = &d_beam_data[level_number].petsc_prev_node_idxs[0];
     const double** const rigidities = &d_beam_data[level_number].rigidities[0];
     const Vector** const curvatures = &d_beam_data[level_number].curvatures[0];
     double* const F_node = F_data->getLocalFormVecArray()->data();
-    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
-    int k, kblock, kunroll, mastr_idx, next_idx, prev_idx;
-    double K;
-    const double* D2X0;
-    double F[NDIM];
-    kblock = 0;
-    for (; kblock < (num_beams - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
+    // NOTE: The interior beams involve only local nodes and are computed while
+    // the ghost node positions are being communicated, so only a read-only view
+    // of the locally owned positions is obtained; the ghosted local form of the
+    // position vector may not be accessed until the ghost update has completed.
+    int ierr;
+    const double* X_node = NULL;
+    if (interior)
     {
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_next_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_prev_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(rigidities + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(curvatures + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
+        ierr = VecGetArrayRead(X_data->getVec(), &X_node);
+        IBTK_CHKERRQ(ierr);
+    }
+    else
+    {
+        X_node = X_data->getGhostedLocalFormVecArray()->data();
+    }
+
+    // The beams are processed one color at a time.  Beams of the same color do
+    // not share any nodes, so that when threading is enabled, the forces
+    // generated by the beams of a single color are accumulated concurrently
+    // without any write conflicts.
+    for (unsigned int c = 0; c + 1 < color_offsets.size(); ++c)
+    {
+        const int color_begin = color_offsets[c];
+        const int color_end = color_offsets[c + 1];
+        if (color_begin < beam_begin || color_begin >= beam_end) continue;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (int k = color_begin; k < color_end; ++k)
         {
-            k = kblock * BLOCKSIZE + kunroll;
-            mastr_idx = petsc_mastr_node_idxs[k];
-            next_idx = petsc_next_node_idxs[k];
-            prev_idx = petsc_prev_node_idxs[k];
+            const int mastr_idx = petsc_mastr_node_idxs[k];
+            const int next_idx = petsc_next_node_idxs[k];
+            const int prev_idx = petsc_prev_node_idxs[k];
 #if !defined(NDEBUG)
             TBOX_ASSERT(mastr_idx != next_idx);
             TBOX_ASSERT(mastr_idx != prev_idx);
 #endif
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_next_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_prev_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_next_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_prev_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(rigidities[k + 1]);
-            PREFETCH_READ_NTA(curvatures[k + 1]);
-            K = *rigidities[k];
-            D2X0 = curvatures[k]->data();
+            if (LIKELY(k + 1 < color_end))
+            {
+                PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
+                PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_next_node_idxs[k + 1]);
+                PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_prev_node_idxs[k + 1]);
+                PREFETCH_READ_NTA(rigidities[k + 1]);
+                PREFETCH_READ_NTA(curvatures[k + 1]);
+            }
+            const double K = *rigidities[k];
+            const double* const D2X0 = curvatures[k]->data();
+            double F[NDIM];
             F[0] = K * (X_node[next_idx + 0] + X_node[prev_idx + 0] - 2.0 * X_node[mastr_idx + 0] - D2X0[0]);
             F[1] = K * (X_node[next_idx + 1] + X_node[prev_idx + 1] - 2.0 * X_node[mastr_idx + 1] - D2X0[1]);
 #if (NDIM == 3)
@@ -1058,41 +1660,19 @@ void IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
 #endif
         }
     }
-    for (k = kblock * BLOCKSIZE; k < num_beams; ++k)
+
+    F_data->restoreArrays();
+    if (interior)
     {
-        mastr_idx = petsc_mastr_node_idxs[k];
-        next_idx = petsc_next_node_idxs[k];
-        prev_idx = petsc_prev_node_idxs[k];
-#if !defined(NDEBUG)
-        TBOX_ASSERT(mastr_idx != next_idx);
-        TBOX_ASSERT(mastr_idx != prev_idx);
-#endif
-        K = *rigidities[k];
-        D2X0 = curvatures[k]->data();
-        F[0] = K * (X_node[next_idx + 0] + X_node[prev_idx + 0] - 2.0 * X_node[mastr_idx + 0] - D2X0[0]);
-        F[1] = K * (X_node[next_idx + 1] + X_node[prev_idx + 1] - 2.0 * X_node[mastr_idx + 1] - D2X0[1]);
-#if (NDIM == 3)
-        F[2] = K * (X_node[next_idx + 2] + X_node[prev_idx + 2] - 2.0 * X_node[mastr_idx + 2] - D2X0[2]);
-#endif
-        F_node[mastr_idx + 0] += 2.0 * F[0];
-        F_node[mastr_idx + 1] += 2.0 * F[1];
-#if (NDIM == 3)
-        F_node[mastr_idx + 2] += 2.0 * F[2];
-#endif
-        F_node[next_idx + 0] -= F[0];
-        F_node[next_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[next_idx + 2] -= F[2];
-#endif
-        F_node[prev_idx + 0] -= F[0];
-        F_node[prev_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[prev_idx + 2] -= F[2];
-#endif
+        ierr = VecRestoreArrayRead(X_data->getVec(), &X_node);
+        IBTK_CHKERRQ(ierr);
+    }
+    else
+    {
+        X_data->restoreArrays();
     }
 
-    F_data->restoreArrays();
-    X_data->restoreArrays();
+    IBAMR_TIMER_STOP(t_compute_lagrangian_beam_force);
     return;
 } // computeLagrangianBeamForce
 
@@ -1153,6 +1733,8 @@ void IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data
                                                            const double /*data_time*/,
                                                            LDataManager* const /*l_data_manager*/)
 {
+    IBAMR_TIMER_START(t_compute_lagrangian_target_point_force);
+
     const int num_target_points = static_cast<int>(d_target_point_data[level_number].petsc_node_idxs.size());
     const int* const petsc_node_idxs = &d_target_point_data[level_number].petsc_node_idxs[0];
     const double** const kappa = &d_target_point_data[level_number].kappa[0];
@@ -1209,6 +1791,8 @@ void IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data
     F_data->restoreArrays();
     X_data->restoreArrays();
     U_data->restoreArrays();
+
+    IBAMR_TIMER_STOP(t_compute_lagrangian_target_point_force);
     return;
 } // computeLagrangianTargetPointForce
 
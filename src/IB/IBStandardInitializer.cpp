@@ -35,6 +35,7 @@
 #include <stddef.h>
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <ios>
 #include <iosfwd>
 #include <istream>
@@ -48,14 +49,17 @@
 #include <vector>
 
 #include "Box.h"
+#include "BoxTree.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "CellIndex.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "boost/array.hpp"
 #include "boost/multi_array.hpp"
 #include "ibamr/IBAnchorPointSpec.h"
@@ -77,6 +81,8 @@
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/ibtk_utilities.h"
+#include "mpi.h"
+#include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
@@ -126,27 +132,494 @@ inline int round(double x)
 {
     return floor(x + 0.5);
 } // round
+
+// Data read from a binary structure file.  The records held by this process
+// are stored along with their indices in the file.
+struct BinaryStructureData
+{
+    int num_records;
+    int num_int_fields, num_double_fields;
+    std::vector<int> record_idx;
+    std::vector<int> int_data;
+    std::vector<double> double_data;
+    std::vector<std::string> names;
+    std::vector<double> values;
+};
+
+static const char BINARY_STRUCTURE_MAGIC[8] = { 'I', 'B', 'S', 'T', 'R', 'U', 'C', 'T' };
+static const int BINARY_STRUCTURE_VERSION = 1;
+static const int BINARY_STRUCTURE_HEADER_SIZE = 48;
+
+// The index of the first record of a binary structure file that is read by the
+// specified process.
+inline int binary_structure_slice_begin(const int rank, const int num_records, const int nodes)
+{
+    return static_cast<int>((static_cast<long long>(num_records) * rank) / nodes);
+} // binary_structure_slice_begin
+
+// The process that reads the specified record of a binary structure file, i.e.,
+// the largest rank r for which binary_structure_slice_begin(r) <= record_idx.
+inline int binary_structure_slice_rank(const int record_idx, const int num_records, const int nodes)
+{
+    const long long r =
+        ((static_cast<long long>(record_idx) + 1) * nodes + num_records - 1) / num_records - 1;
+    return static_cast<int>(std::max(0LL, std::min(r, static_cast<long long>(nodes - 1))));
+} // binary_structure_slice_rank
+
+// The size in bytes of a record of a binary structure file when it is sent
+// between processes, including its index in the file.
+inline int binary_structure_record_size(const BinaryStructureData& data)
+{
+    return (1 + data.num_int_fields) * sizeof(int) + data.num_double_fields * sizeof(double);
+} // binary_structure_record_size
+
+// Pack the specified record held by this process.
+void pack_binary_structure_record(char* buffer, const BinaryStructureData& data, const int k)
+{
+    std::memcpy(buffer, &data.record_idx[k], sizeof(int));
+    buffer += sizeof(int);
+    if (data.num_int_fields > 0)
+    {
+        std::memcpy(
+            buffer, &data.int_data[static_cast<size_t>(k) * data.num_int_fields], data.num_int_fields * sizeof(int));
+        buffer += data.num_int_fields * sizeof(int);
+    }
+    if (data.num_double_fields > 0)
+    {
+        std::memcpy(buffer,
+                    &data.double_data[static_cast<size_t>(k) * data.num_double_fields],
+                    data.num_double_fields * sizeof(double));
+    }
+    return;
+} // pack_binary_structure_record
+
+// Replace the records held by this process by the records packed in a buffer.
+void unpack_binary_structure_records(BinaryStructureData& data, const std::vector<char>& buffer, const int num_records)
+{
+    const int record_size = binary_structure_record_size(data);
+    data.record_idx.resize(num_records);
+    data.int_data.resize(static_cast<size_t>(num_records) * data.num_int_fields);
+    data.double_data.resize(static_cast<size_t>(num_records) * data.num_double_fields);
+    for (int k = 0; k < num_records; ++k)
+    {
+        const char* record = &buffer[static_cast<size_t>(k) * record_size];
+        std::memcpy(&data.record_idx[k], record, sizeof(int));
+        record += sizeof(int);
+        if (data.num_int_fields > 0)
+        {
+            std::memcpy(&data.int_data[static_cast<size_t>(k) * data.num_int_fields],
+                        record,
+                        data.num_int_fields * sizeof(int));
+            record += data.num_int_fields * sizeof(int);
+        }
+        if (data.num_double_fields > 0)
+        {
+            std::memcpy(&data.double_data[static_cast<size_t>(k) * data.num_double_fields],
+                        record,
+                        data.num_double_fields * sizeof(double));
+        }
+    }
+    return;
+} // unpack_binary_structure_records
+
+// Gather the records of a binary structure file onto all processes.
+void gather_binary_structure_records(BinaryStructureData& data)
+{
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    const int nodes = SAMRAI_MPI::getNodes();
+
+    const int record_size = binary_structure_record_size(data);
+    const int num_local_records = static_cast<int>(data.record_idx.size());
+    std::vector<char> send_buffer(static_cast<size_t>(std::max(num_local_records, 1)) * record_size);
+    for (int k = 0; k < num_local_records; ++k)
+    {
+        pack_binary_structure_record(&send_buffer[static_cast<size_t>(k) * record_size], data, k);
+    }
+    std::vector<int> counts(nodes), displs(nodes, 0);
+    MPI_Allgather(&num_local_records, 1, MPI_INT, &counts[0], 1, MPI_INT, communicator);
+    std::partial_sum(counts.begin(), counts.end() - 1, displs.begin() + 1);
+    const int num_records = displs[nodes - 1] + counts[nodes - 1];
+    std::vector<char> recv_buffer(static_cast<size_t>(std::max(num_records, 1)) * record_size);
+
+    MPI_Datatype record_type;
+    MPI_Type_contiguous(record_size, MPI_BYTE, &record_type);
+    MPI_Type_commit(&record_type);
+    MPI_Allgatherv(&send_buffer[0],
+                   num_local_records,
+                   record_type,
+                   &recv_buffer[0],
+                   &counts[0],
+                   &displs[0],
+                   record_type,
+                   communicator);
+    MPI_Type_free(&record_type);
+
+    // The slices are gathered in rank order, so the records remain in the order
+    // in which they appear in the file.
+    unpack_binary_structure_records(data, recv_buffer, num_records);
+    return;
+} // gather_binary_structure_records
+
+// Send each record of a binary structure file to the process that holds the
+// data of the vertex associated with the record, whose level-wide index is
+// key_idxs[k].  The vertex data are held in contiguous blocks of vertex indices
+// by the processes that read the corresponding records of the vertex files.
+// Records whose vertex indices are out of range remain on the process that
+// read them, so that they are reported when the records are processed.
+void distribute_binary_structure_records(BinaryStructureData& data,
+                                         const std::vector<int>& key_idxs,
+                                         const std::vector<int>& num_vertex,
+                                         const std::vector<int>& vertex_offset)
+{
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+
+    // Determine the destination of each record.
+    const int num_local_records = static_cast<int>(data.record_idx.size());
+    const int num_level_vertex = vertex_offset.back() + num_vertex.back();
+    std::vector<int> dst_rank(num_local_records, rank), send_counts(nodes, 0);
+    for (int k = 0; k < num_local_records; ++k)
+    {
+        const int idx = key_idxs[k];
+        if (idx >= 0 && idx < num_level_vertex)
+        {
+            const int j = static_cast<int>(std::upper_bound(vertex_offset.begin(), vertex_offset.end(), idx) -
+                                           vertex_offset.begin()) -
+                          1;
+            dst_rank[k] = binary_structure_slice_rank(idx - vertex_offset[j], num_vertex[j], nodes);
+        }
+        ++send_counts[dst_rank[k]];
+    }
+
+    // Pack the records in the order of their destinations.
+    const int record_size = binary_structure_record_size(data);
+    std::vector<int> send_displs(nodes, 0);
+    std::partial_sum(send_counts.begin(), send_counts.end() - 1, send_displs.begin() + 1);
+    std::vector<char> send_buffer(static_cast<size_t>(std::max(num_local_records, 1)) * record_size);
+    std::vector<int> send_posn(send_displs);
+    for (int k = 0; k < num_local_records; ++k)
+    {
+        pack_binary_structure_record(
+            &send_buffer[static_cast<size_t>(send_posn[dst_rank[k]]++) * record_size], data, k);
+    }
+
+    // Exchange the records.
+    std::vector<int> recv_counts(nodes), recv_displs(nodes, 0);
+    MPI_Alltoall(&send_counts[0], 1, MPI_INT, &recv_counts[0], 1, MPI_INT, communicator);
+    std::partial_sum(recv_counts.begin(), recv_counts.end() - 1, recv_displs.begin() + 1);
+    const int num_records = recv_displs[nodes - 1] + recv_counts[nodes - 1];
+    std::vector<char> recv_buffer(static_cast<size_t>(std::max(num_records, 1)) * record_size);
+
+    MPI_Datatype record_type;
+    MPI_Type_contiguous(record_size, MPI_BYTE, &record_type);
+    MPI_Type_commit(&record_type);
+    MPI_Alltoallv(&send_buffer[0],
+                  &send_counts[0],
+                  &send_displs[0],
+                  record_type,
+                  &recv_buffer[0],
+                  &recv_counts[0],
+                  &recv_displs[0],
+                  record_type,
+                  communicator);
+    MPI_Type_free(&record_type);
+
+    // Each process sends its records in the order in which they appear in the
+    // file, and the processes read consecutive slices of the file, so the
+    // received records also remain in file order.
+    unpack_binary_structure_records(data, recv_buffer, num_records);
+    return;
+} // distribute_binary_structure_records
+
+// The level-wide index of a vertex index read from a binary structure file, or
+// -1 if the index is out of range.
+inline int binary_structure_key_idx(const int idx, const int min_idx, const int max_idx, const int offset)
+{
+    return (idx >= min_idx && idx < max_idx) ? idx + offset : -1;
+} // binary_structure_key_idx
+
+// Collectively read a binary structure file.  Returns false if the file cannot
+// be opened.  Each process reads a contiguous slice of the records.  If
+// gather_records is true, the slices are then gathered onto all processes;
+// otherwise, each process retains only the records that it has read.
+bool read_binary_structure_file(BinaryStructureData& data,
+                                const std::string& filename,
+                                const int num_int_fields,
+                                const int min_num_double_fields,
+                                const int max_num_double_fields,
+                                const bool gather_records,
+                                const std::string& object_name)
+{
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+
+    // Opening the file is collective, so either all processes or no processes
+    // will find the file.
+    MPI_File fh;
+    if (MPI_File_open(communicator, const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY, MPI_INFO_NULL, &fh) !=
+        MPI_SUCCESS)
+    {
+        return false;
+    }
+
+    // The root process reads the header, names, and values and broadcasts them
+    // to the other processes.
+    char header[BINARY_STRUCTURE_HEADER_SIZE] = { 0 };
+    if (rank == 0) MPI_File_read_at(fh, 0, header, BINARY_STRUCTURE_HEADER_SIZE, MPI_BYTE, MPI_STATUS_IGNORE);
+    MPI_Bcast(header, BINARY_STRUCTURE_HEADER_SIZE, MPI_BYTE, 0, communicator);
+    int version, ndim, num_names, num_values;
+    long long num_records, data_offset;
+    std::memcpy(&version, header + 8, sizeof(int));
+    std::memcpy(&ndim, header + 12, sizeof(int));
+    std::memcpy(&data.num_int_fields, header + 16, sizeof(int));
+    std::memcpy(&data.num_double_fields, header + 20, sizeof(int));
+    std::memcpy(&num_names, header + 24, sizeof(int));
+    std::memcpy(&num_values, header + 28, sizeof(int));
+    std::memcpy(&num_records, header + 32, sizeof(long long));
+    std::memcpy(&data_offset, header + 40, sizeof(long long));
+    if (!std::equal(BINARY_STRUCTURE_MAGIC, BINARY_STRUCTURE_MAGIC + 8, header))
+    {
+        TBOX_ERROR(object_name << ":\n  File " << filename << " is not a binary structure file" << std::endl);
+    }
+    if (version != BINARY_STRUCTURE_VERSION)
+    {
+        TBOX_ERROR(object_name << ":\n  Unsupported version or byte order in binary input file " << filename
+                               << std::endl);
+    }
+    if (ndim != NDIM)
+    {
+        TBOX_ERROR(object_name << ":\n  Binary input file " << filename << " was generated for a " << ndim
+                               << "D model" << std::endl);
+    }
+    if (data.num_int_fields != num_int_fields || data.num_double_fields < min_num_double_fields ||
+        data.num_double_fields > max_num_double_fields)
+    {
+        TBOX_ERROR(object_name << ":\n  Invalid record layout in binary input file " << filename << std::endl
+                               << "  records contain " << data.num_int_fields << " integer and "
+                               << data.num_double_fields << " floating point fields" << std::endl);
+    }
+    if (num_records <= 0 || num_records > std::numeric_limits<int>::max() || num_names < 0 || num_values < 0 ||
+        data_offset < BINARY_STRUCTURE_HEADER_SIZE || data_offset > std::numeric_limits<int>::max())
+    {
+        TBOX_ERROR(object_name << ":\n  Invalid header in binary input file " << filename << std::endl);
+    }
+    data.num_records = static_cast<int>(num_records);
+
+    int preamble_size = static_cast<int>(data_offset) - BINARY_STRUCTURE_HEADER_SIZE;
+    std::vector<char> preamble(std::max(preamble_size, 1));
+    if (rank == 0 && preamble_size > 0)
+    {
+        MPI_File_read_at(fh, BINARY_STRUCTURE_HEADER_SIZE, &preamble[0], preamble_size, MPI_BYTE, MPI_STATUS_IGNORE);
+    }
+    MPI_Bcast(&preamble[0], preamble_size, MPI_BYTE, 0, communicator);
+    int pos = 0;
+    data.names.resize(num_names);
+    for (int m = 0; m < num_names; ++m)
+    {
+        int len = -1;
+        if (pos + static_cast<int>(sizeof(int)) <= preamble_size) std::memcpy(&len, &preamble[pos], sizeof(int));
+        pos += sizeof(int);
+        if (len < 0 || pos + len > preamble_size)
+        {
+            TBOX_ERROR(object_name << ":\n  Invalid name table in binary input file " << filename << std::endl);
+        }
+        data.names[m].assign(&preamble[pos], len);
+        pos += len;
+    }
+    data.values.resize(num_values);
+    if (pos + num_values * static_cast<int>(sizeof(double)) > preamble_size)
+    {
+        TBOX_ERROR(object_name << ":\n  Invalid header values in binary input file " << filename << std::endl);
+    }
+    if (num_values > 0) std::memcpy(&data.values[0], &preamble[pos], num_values * sizeof(double));
+
+    // Each process reads a contiguous slice of the records.
+    const int record_size = data.num_int_fields * sizeof(int) + data.num_double_fields * sizeof(double);
+    MPI_Datatype record_type;
+    MPI_Type_contiguous(record_size, MPI_BYTE, &record_type);
+    MPI_Type_commit(&record_type);
+    const int slice_begin = binary_structure_slice_begin(rank, data.num_records, nodes);
+    const int slice_size = binary_structure_slice_begin(rank + 1, data.num_records, nodes) - slice_begin;
+    std::vector<char> records(static_cast<size_t>(std::max(slice_size, 1)) * record_size);
+    const MPI_Offset slice_offset = data_offset + static_cast<MPI_Offset>(slice_begin) * record_size;
+    MPI_Status status;
+    int ierr = MPI_File_read_at_all(fh, slice_offset, &records[0], slice_size, record_type, &status);
+    int num_read = 0;
+    if (ierr == MPI_SUCCESS) MPI_Get_count(&status, record_type, &num_read);
+    if (SAMRAI_MPI::minReduction(num_read == slice_size ? 1 : 0) == 0)
+    {
+        TBOX_ERROR(object_name << ":\n  Premature end to binary input file " << filename << std::endl);
+    }
+    MPI_File_close(&fh);
+    MPI_Type_free(&record_type);
+
+    // Unpack the records.
+    data.record_idx.resize(slice_size);
+    data.int_data.resize(static_cast<size_t>(slice_size) * data.num_int_fields);
+    data.double_data.resize(static_cast<size_t>(slice_size) * data.num_double_fields);
+    for (int k = 0; k < slice_size; ++k)
+    {
+        const char* const record = &records[static_cast<size_t>(k) * record_size];
+        data.record_idx[k] = slice_begin + k;
+        if (data.num_int_fields > 0)
+        {
+            std::memcpy(&data.int_data[static_cast<size_t>(k) * data.num_int_fields],
+                        record,
+                        data.num_int_fields * sizeof(int));
+        }
+        if (data.num_double_fields > 0)
+        {
+            std::memcpy(&data.double_data[static_cast<size_t>(k) * data.num_double_fields],
+                        record + data.num_int_fields * sizeof(int),
+                        data.num_double_fields * sizeof(double));
+        }
+    }
+
+    if (gather_records) gather_binary_structure_records(data);
+    return true;
+} // read_binary_structure_file
+
+// Ensure that a vertex index read from a binary structure file is valid.
+inline void check_binary_vertex_index(const int idx,
+                                      const int min_idx,
+                                      const int max_idx,
+                                      const int k,
+                                      const std::string& filename,
+                                      const std::string& object_name)
+{
+    if ((idx < min_idx) || (idx >= max_idx))
+    {
+        TBOX_ERROR(object_name << ":\n  Invalid entry in binary input file encountered in record " << k
+                               << " of file " << filename << std::endl << "  vertex index " << idx
+                               << " is out of range" << std::endl);
+    }
+    return;
+} // check_binary_vertex_index
+
+// Ensure that a material parameter read from a binary structure file is
+// nonnegative.
+inline void check_binary_nonnegative_value(const double value,
+                                           const std::string& value_name,
+                                           const int k,
+                                           const std::string& filename,
+                                           const std::string& object_name)
+{
+    if (value < 0.0)
+    {
+        TBOX_ERROR(object_name << ":\n  Invalid entry in binary input file encountered in record " << k
+                               << " of file " << filename << std::endl << "  " << value_name << " is negative"
+                               << std::endl);
+    }
+    return;
+} // check_binary_nonnegative_value
+
+// Append a value to a buffer of structure data that is sent between processes.
+template <class T>
+inline void pack_structure_value(std::vector<char>& buffer, const T& value)
+{
+    const char* const bytes = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    return;
+} // pack_structure_value
+
+// Extract a value from a buffer of structure data and advance the buffer.
+template <class T>
+inline void unpack_structure_value(const char*& buffer, T& value)
+{
+    std::memcpy(static_cast<void*>(&value), buffer, sizeof(T));
+    buffer += sizeof(T);
+    return;
+} // unpack_structure_value
+
+// Append a variable-length array of values to a buffer of structure data.
+inline void pack_structure_values(std::vector<char>& buffer, const std::vector<double>& values)
+{
+    pack_structure_value(buffer, static_cast<int>(values.size()));
+    if (values.empty()) return;
+    const char* const bytes = reinterpret_cast<const char*>(&values[0]);
+    buffer.insert(buffer.end(), bytes, bytes + values.size() * sizeof(double));
+    return;
+} // pack_structure_values
+
+// Extract a variable-length array of values from a buffer of structure data and
+// advance the buffer.
+inline void unpack_structure_values(const char*& buffer, std::vector<double>& values)
+{
+    int num_values;
+    unpack_structure_value(buffer, num_values);
+    values.resize(num_values);
+    if (num_values == 0) return;
+    std::memcpy(&values[0], buffer, num_values * sizeof(double));
+    buffer += num_values * sizeof(double);
+    return;
+} // unpack_structure_values
+
+// Gather the edges of an edge map onto MPI process 0.  Each edge is keyed by its
+// first vertex.  The returned map is empty on all other processes.
+std::multimap<int, std::pair<int, int> > gather_edge_map(const std::multimap<int, std::pair<int, int> >& edge_map)
+{
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+
+    std::vector<int> send_idxs;
+    send_idxs.reserve(2 * edge_map.size() + 1);
+    for (std::multimap<int, std::pair<int, int> >::const_iterator it = edge_map.begin(); it != edge_map.end(); ++it)
+    {
+        send_idxs.push_back(it->second.first);
+        send_idxs.push_back(it->second.second);
+    }
+    const int num_send_idxs = static_cast<int>(send_idxs.size());
+    send_idxs.push_back(0);
+    std::vector<int> recv_counts(nodes, 0), recv_displs(nodes, 0);
+    MPI_Gather(&num_send_idxs, 1, MPI_INT, &recv_counts[0], 1, MPI_INT, 0, communicator);
+    std::partial_sum(recv_counts.begin(), recv_counts.end() - 1, recv_displs.begin() + 1);
+    const int num_recv_idxs = recv_displs[nodes - 1] + recv_counts[nodes - 1];
+    std::vector<int> recv_idxs(std::max(num_recv_idxs, 1));
+    MPI_Gatherv(&send_idxs[0],
+                num_send_idxs,
+                MPI_INT,
+                &recv_idxs[0],
+                &recv_counts[0],
+                &recv_displs[0],
+                MPI_INT,
+                0,
+                communicator);
+
+    std::multimap<int, std::pair<int, int> > gathered_edge_map;
+    if (rank != 0) return gathered_edge_map;
+    for (int k = 0; k < num_recv_idxs; k += 2)
+    {
+        const std::pair<int, int> e(recv_idxs[k], recv_idxs[k + 1]);
+        gathered_edge_map.insert(std::make_pair(e.first, e));
+    }
+    return gathered_edge_map;
+} // gather_edge_map
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 IBStandardInitializer::IBStandardInitializer(const std::string& object_name, Pointer<Database> input_db)
-    : d_object_name(object_name), d_use_file_batons(true), d_max_levels(-1), d_level_is_initialized(),
-      d_silo_writer(NULL), d_base_filename(), d_length_scale_factor(1.0), d_posn_shift(Vector::Zero()), d_num_vertex(),
-      d_vertex_offset(), d_vertex_posn(), d_enable_springs(), d_spring_edge_map(), d_spring_spec_data(),
-      d_using_uniform_spring_stiffness(), d_uniform_spring_stiffness(), d_using_uniform_spring_rest_length(),
-      d_uniform_spring_rest_length(), d_using_uniform_spring_force_fcn_idx(), d_uniform_spring_force_fcn_idx(),
-      d_enable_xsprings(), d_xspring_edge_map(), d_xspring_spec_data(), d_using_uniform_xspring_stiffness(),
-      d_uniform_xspring_stiffness(), d_using_uniform_xspring_rest_length(), d_uniform_xspring_rest_length(),
-      d_using_uniform_xspring_force_fcn_idx(), d_uniform_xspring_force_fcn_idx(), d_enable_beams(), d_beam_spec_data(),
-      d_using_uniform_beam_bend_rigidity(), d_uniform_beam_bend_rigidity(), d_using_uniform_beam_curvature(),
-      d_uniform_beam_curvature(), d_enable_rods(), d_rod_edge_map(), d_rod_spec_data(),
-      d_using_uniform_rod_properties(), d_uniform_rod_properties(), d_enable_target_points(), d_target_spec_data(),
-      d_using_uniform_target_stiffness(), d_uniform_target_stiffness(), d_using_uniform_target_damping(),
-      d_uniform_target_damping(), d_enable_anchor_points(), d_anchor_spec_data(), d_enable_bdry_mass(),
-      d_bdry_mass_spec_data(), d_using_uniform_bdry_mass(), d_uniform_bdry_mass(),
+    : d_object_name(object_name), d_use_file_batons(true), d_use_binary_structure_files(false),
+      d_retain_only_local_structure_data(false), d_level_data_is_pruned(), d_level_data_is_distributed(),
+      d_max_levels(-1), d_level_is_initialized(), d_silo_writer(NULL), d_base_filename(), d_length_scale_factor(1.0),
+      d_posn_shift(Vector::Zero()), d_num_vertex(), d_vertex_offset(), d_vertex_posn(), d_local_vertex_idx(),
+      d_enable_springs(), d_spring_edge_map(), d_spring_spec_data(), d_using_uniform_spring_stiffness(),
+      d_uniform_spring_stiffness(), d_using_uniform_spring_rest_length(), d_uniform_spring_rest_length(),
+      d_using_uniform_spring_force_fcn_idx(), d_uniform_spring_force_fcn_idx(), d_enable_xsprings(),
+      d_xspring_edge_map(), d_xspring_spec_data(),
+      d_using_uniform_xspring_stiffness(), d_uniform_xspring_stiffness(), d_using_uniform_xspring_rest_length(),
+      d_uniform_xspring_rest_length(), d_using_uniform_xspring_force_fcn_idx(), d_uniform_xspring_force_fcn_idx(),
+      d_enable_beams(), d_beam_spec_data(), d_using_uniform_beam_bend_rigidity(), d_uniform_beam_bend_rigidity(),
+      d_using_uniform_beam_curvature(), d_uniform_beam_curvature(), d_enable_rods(), d_rod_edge_map(),
+      d_rod_spec_data(), d_using_uniform_rod_properties(), d_uniform_rod_properties(), d_enable_target_points(),
+      d_target_spec_data(), d_using_uniform_target_stiffness(), d_uniform_target_stiffness(),
+      d_using_uniform_target_damping(), d_uniform_target_damping(), d_enable_anchor_points(), d_anchor_spec_data(),
+      d_enable_bdry_mass(), d_bdry_mass_spec_data(), d_using_uniform_bdry_mass(), d_uniform_bdry_mass(),
       d_using_uniform_bdry_mass_stiffness(), d_uniform_bdry_mass_stiffness(), d_directors(), d_enable_instrumentation(),
-      d_instrument_idx(), d_enable_sources(), d_source_idx(), d_global_index_offset()
+      d_instrument_idx(), d_enable_sources(), d_source_idx(), d_global_index_offset(), d_vertex_binning()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -233,7 +706,15 @@ void IBStandardInitializer::registerLSiloDataWriter(Pointer<LSiloDataWriter> sil
     {
         for (int ln = 0; ln < d_max_levels; ++ln)
         {
-            if (d_level_is_initialized[ln])
+            if (d_level_is_initialized[ln] && d_level_data_is_pruned[ln])
+            {
+                TBOX_WARNING(d_object_name << "::registerLSiloDataWriter():\n"
+                                           << "  structure data on level " << ln
+                                           << " have already been freed; meshes will not be registered.\n"
+                                           << "  register the Lagrangian Silo data writer before initializing the "
+                                              "patch hierarchy when retain_only_local_structure_data is enabled.\n");
+            }
+            else if (d_level_is_initialized[ln])
             {
                 initializeLSiloDataWriter(ln);
             }
@@ -268,6 +749,13 @@ unsigned int IBStandardInitializer::computeLocalNodeCountOnPatchLevel(const Poin
     const double* const domain_x_lower = grid_geom->getXLower();
     const double* const domain_x_upper = grid_geom->getXUpper();
 
+    // Send the distributed structure data to the processes that own the patches
+    // that contain the vertices.
+    if (d_level_data_is_distributed[level_number] && !d_level_data_is_pruned[level_number])
+    {
+        redistributeStructureData(hierarchy, level_number, level_number);
+    }
+
     // Loop over all patches in the specified level of the patch level and count
     // the number of local vertices.
     int local_node_count = 0;
@@ -328,6 +816,17 @@ unsigned int IBStandardInitializer::initializeDataOnPatchLevel(const int lag_nod
         domain_length[d] = domain_x_upper[d] - domain_x_lower[d];
     }
 
+    // The specification data may have been freed when the level was previously
+    // initialized.
+    if (d_level_data_is_pruned[level_number])
+    {
+        TBOX_ERROR(d_object_name << "::initializeDataOnPatchLevel():\n"
+                                 << "  structure data on level " << level_number << " have already been freed.\n"
+                                 << "  the level cannot be re-initialized when retain_only_local_structure_data is "
+                                    "enabled."
+                                 << std::endl);
+    }
+
     // Set the global index offset.  This is equal to the number of Lagrangian
     // indices that have already been initialized on the specified level.
     d_global_index_offset[level_number] = global_index_offset;
@@ -338,6 +837,7 @@ unsigned int IBStandardInitializer::initializeDataOnPatchLevel(const int lag_nod
     boost::multi_array_ref<double, 2>& U_array = *U_data->getLocalFormVecArray();
     int local_idx = -1;
     int local_node_count = 0;
+    std::vector<std::pair<int, int> > local_vertices;
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
     const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
@@ -359,6 +859,10 @@ unsigned int IBStandardInitializer::initializeDataOnPatchLevel(const int lag_nod
         getPatchVertices(
             patch_vertices, patch, level_number, can_be_refined, domain_x_lower, domain_x_upper, periodic_shift);
         local_node_count += patch_vertices.size();
+        if (d_retain_only_local_structure_data)
+        {
+            local_vertices.insert(local_vertices.end(), patch_vertices.begin(), patch_vertices.end());
+        }
         for (std::vector<std::pair<int, int> >::const_iterator it = patch_vertices.begin(); it != patch_vertices.end();
              ++it)
         {
@@ -444,6 +948,12 @@ unsigned int IBStandardInitializer::initializeDataOnPatchLevel(const int lag_nod
     {
         initializeLSiloDataWriter(level_number);
     }
+
+    // Free the structure data that are no longer required by this process.
+    if (d_retain_only_local_structure_data)
+    {
+        pruneStructureData(level_number, local_vertices);
+    }
     return local_node_count;
 } // initializeDataOnPatchLevel
 
@@ -571,6 +1081,16 @@ void IBStandardInitializer::tagCellsForInitialRefinement(const Pointer<PatchHier
     const double* const domain_x_lower = grid_geom->getXLower();
     const double* const domain_x_upper = grid_geom->getXUpper();
 
+    // Send the distributed structure data on the finer levels to the processes
+    // that own the patches of the specified level that contain the vertices.
+    for (int ln = level_number + 1; ln < d_max_levels; ++ln)
+    {
+        if (d_level_data_is_distributed[ln] && !d_level_data_is_pruned[ln])
+        {
+            redistributeStructureData(hierarchy, level_number, ln);
+        }
+    }
+
     // Loop over all patches in the specified level of the patch level and tag
     // cells for refinement wherever there are vertices assigned to a finer
     // level of the Cartesian grid.
@@ -638,6 +1158,30 @@ void IBStandardInitializer::initializeLSiloDataWriter(const int level_number)
         TBOX_ERROR("This is broken --- please submit a bug report if you encounter this error.\n");
     }
 
+    // On distributed levels, the edge data are first gathered onto MPI process
+    // 0.
+    const size_t num_base_filename = d_num_vertex[level_number].size();
+    std::vector<std::multimap<int, Edge> > gathered_spring_edge_map, gathered_xspring_edge_map,
+        gathered_rod_edge_map;
+    if (d_level_data_is_distributed[level_number])
+    {
+        gathered_spring_edge_map.resize(num_base_filename);
+        gathered_xspring_edge_map.resize(num_base_filename);
+        gathered_rod_edge_map.resize(num_base_filename);
+        for (unsigned int j = 0; j < num_base_filename; ++j)
+        {
+            gathered_spring_edge_map[j] = gather_edge_map(d_spring_edge_map[level_number][j]);
+            gathered_xspring_edge_map[j] = gather_edge_map(d_xspring_edge_map[level_number][j]);
+            gathered_rod_edge_map[j] = gather_edge_map(d_rod_edge_map[level_number][j]);
+        }
+    }
+    const std::vector<std::multimap<int, Edge> >& spring_edge_map =
+        d_level_data_is_distributed[level_number] ? gathered_spring_edge_map : d_spring_edge_map[level_number];
+    const std::vector<std::multimap<int, Edge> >& xspring_edge_map =
+        d_level_data_is_distributed[level_number] ? gathered_xspring_edge_map : d_xspring_edge_map[level_number];
+    const std::vector<std::multimap<int, Edge> >& rod_edge_map =
+        d_level_data_is_distributed[level_number] ? gathered_rod_edge_map : d_rod_edge_map[level_number];
+
     // WARNING: For now, we just register the visualization data on MPI process
     // 0.  This will fail if the structure is too large to be stored in the
     // memory available to a single MPI process.
@@ -658,38 +1202,401 @@ void IBStandardInitializer::initializeLSiloDataWriter(const int level_number)
         bool registered_spring_edge_map = false;
         for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
         {
-            if (d_spring_edge_map[level_number][j].size() > 0)
+            if (spring_edge_map[j].size() > 0)
             {
                 registered_spring_edge_map = true;
                 const std::string postfix = "_mesh";
                 d_silo_writer->registerUnstructuredMesh(
-                    d_base_filename[level_number][j] + postfix, d_spring_edge_map[level_number][j], level_number);
+                    d_base_filename[level_number][j] + postfix, spring_edge_map[j], level_number);
             }
         }
 
         for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
         {
-            if (d_xspring_edge_map[level_number][j].size() > 0)
+            if (xspring_edge_map[j].size() > 0)
             {
                 const std::string postfix = "_xmesh";
                 d_silo_writer->registerUnstructuredMesh(
-                    d_base_filename[level_number][j] + postfix, d_xspring_edge_map[level_number][j], level_number);
+                    d_base_filename[level_number][j] + postfix, xspring_edge_map[j], level_number);
             }
         }
 
         for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
         {
-            if (d_rod_edge_map[level_number][j].size() > 0)
+            if (rod_edge_map[j].size() > 0)
             {
                 const std::string postfix = registered_spring_edge_map ? "_rod_mesh" : "_mesh";
                 d_silo_writer->registerUnstructuredMesh(
-                    d_base_filename[level_number][j] + postfix, d_rod_edge_map[level_number][j], level_number);
+                    d_base_filename[level_number][j] + postfix, rod_edge_map[j], level_number);
             }
         }
     }
     return;
 } // initializeLSiloDataWriter
 
+void IBStandardInitializer::pruneStructureData(const int level_number,
+                                               const std::vector<std::pair<int, int> >& local_vertices)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number >= 0);
+    TBOX_ASSERT(level_number < d_max_levels);
+    TBOX_ASSERT(d_level_is_initialized[level_number]);
+#endif
+    const int ln = level_number;
+    const size_t num_base_filename = d_base_filename[ln].size();
+
+    // The connectivity and force specification data have been copied into the
+    // specification objects attached to the local nodes (and, on MPI process
+    // 0, into the Silo data writer), so they are freed outright.
+    for (size_t j = 0; j < num_base_filename; ++j)
+    {
+        std::multimap<int, Edge>().swap(d_spring_edge_map[ln][j]);
+        std::map<Edge, SpringSpec, EdgeComp>().swap(d_spring_spec_data[ln][j]);
+        std::multimap<int, Edge>().swap(d_xspring_edge_map[ln][j]);
+        std::map<Edge, XSpringSpec, EdgeComp>().swap(d_xspring_spec_data[ln][j]);
+        std::multimap<int, BeamSpec>().swap(d_beam_spec_data[ln][j]);
+        std::multimap<int, Edge>().swap(d_rod_edge_map[ln][j]);
+        std::map<Edge, RodSpec, EdgeComp>().swap(d_rod_spec_data[ln][j]);
+        std::vector<TargetSpec>().swap(d_target_spec_data[ln][j]);
+        std::vector<AnchorSpec>().swap(d_anchor_spec_data[ln][j]);
+        std::map<int, std::pair<int, int> >().swap(d_instrument_idx[ln][j]);
+        std::map<int, int>().swap(d_source_idx[ln][j]);
+    }
+
+    // The vertex positions and the boundary mass and director data are still
+    // required to initialize the mass and director data associated with the
+    // local nodes, so only the data of the local vertices are retained.  They
+    // are stored in the order of the (sorted) local vertex indices.
+    std::vector<std::pair<int, int> > sorted_local_vertices(local_vertices);
+    std::sort(sorted_local_vertices.begin(), sorted_local_vertices.end());
+    std::vector<std::vector<int> > local_vertex_idx(num_base_filename);
+    std::vector<std::vector<Point> > local_vertex_posn(num_base_filename);
+    std::vector<std::vector<BdryMassSpec> > local_bdry_mass_spec_data(num_base_filename);
+    std::vector<std::vector<std::vector<double> > > local_directors(num_base_filename);
+    for (std::vector<std::pair<int, int> >::const_iterator it = sorted_local_vertices.begin();
+         it != sorted_local_vertices.end();
+         ++it)
+    {
+        const int j = it->first;
+        const int k = getLocalVertexIndex(*it, ln);
+        local_vertex_idx[j].push_back(it->second);
+        local_vertex_posn[j].push_back(d_vertex_posn[ln][j][k]);
+        local_bdry_mass_spec_data[j].push_back(d_bdry_mass_spec_data[ln][j][k]);
+        local_directors[j].push_back(std::vector<double>());
+        local_directors[j].back().swap(d_directors[ln][j][k]);
+    }
+    d_local_vertex_idx[ln].swap(local_vertex_idx);
+    d_vertex_posn[ln].swap(local_vertex_posn);
+    d_bdry_mass_spec_data[ln].swap(local_bdry_mass_spec_data);
+    d_directors[ln].swap(local_directors);
+
+    // The cached vertex binnings refer to all of the vertices assigned to the
+    // level and are freed; subsequent binnings include only the local vertices.
+    std::vector<VertexBinning>().swap(d_vertex_binning[ln]);
+
+    d_level_data_is_pruned[ln] = true;
+    return;
+} // pruneStructureData
+
+void IBStandardInitializer::redistributeStructureData(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                      const int patch_level_number,
+                                                      const int level_number)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number >= 0);
+    TBOX_ASSERT(level_number < d_max_levels);
+    TBOX_ASSERT(d_level_data_is_distributed[level_number]);
+    TBOX_ASSERT(!d_level_data_is_pruned[level_number]);
+#endif
+    const int ln = level_number;
+    const size_t num_base_filename = d_base_filename[ln].size();
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+
+    // Determine the extents of the physical domain and the grid spacing of the
+    // patch level.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const double* const dx0 = grid_geom->getDx();
+    const double* const domain_x_lower = grid_geom->getXLower();
+    const double* const domain_x_upper = grid_geom->getXUpper();
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(patch_level_number);
+    Pointer<BoxTree<NDIM> > box_tree = level->getBoxTree();
+    const ProcessorMapping& processor_mapping = level->getProcessorMapping();
+    const Box<NDIM>& domain_box = level->getPhysicalDomain()[0];
+    const CellIndex<NDIM>& domain_lower = domain_box.lower();
+    const CellIndex<NDIM>& domain_upper = domain_box.upper();
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(ratio);
+    boost::array<double, NDIM> dx;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        dx[d] = dx0[d] / static_cast<double>(ratio(d));
+    }
+
+    // Pack the data associated with each local vertex for the process that
+    // owns the patch that contains the vertex.  Vertices that are not contained
+    // in any patch remain on this process.
+    std::vector<std::vector<char> > send_data(nodes);
+    for (unsigned int j = 0; j < num_base_filename; ++j)
+    {
+        for (std::vector<int>::const_iterator it = d_local_vertex_idx[ln][j].begin();
+             it != d_local_vertex_idx[ln][j].end();
+             ++it)
+        {
+            const std::pair<int, int> point_idx(j, *it);
+            const Point X = getShiftedVertexPosn(point_idx, ln, domain_x_lower, domain_x_upper, periodic_shift);
+            const CellIndex<NDIM> cell_idx = IndexUtilities::getCellIndex(
+                X, domain_x_lower, domain_x_upper, dx.data(), domain_lower, domain_upper);
+            Array<int> indices;
+            box_tree->findOverlapIndices(indices, Box<NDIM>(cell_idx, cell_idx));
+            const int dst_proc = indices.getSize() > 0 ? processor_mapping.getProcessorAssignment(indices[0]) : rank;
+            packVertexData(send_data[dst_proc], point_idx, ln);
+        }
+    }
+
+    // Exchange the vertex data.
+    std::vector<int> send_counts(nodes), send_displs(nodes, 0);
+    for (int proc = 0; proc < nodes; ++proc)
+    {
+        send_counts[proc] = static_cast<int>(send_data[proc].size());
+    }
+    std::partial_sum(send_counts.begin(), send_counts.end() - 1, send_displs.begin() + 1);
+    std::vector<char> send_buffer(std::max(send_displs[nodes - 1] + send_counts[nodes - 1], 1));
+    for (int proc = 0; proc < nodes; ++proc)
+    {
+        std::copy(send_data[proc].begin(), send_data[proc].end(), send_buffer.begin() + send_displs[proc]);
+        std::vector<char>().swap(send_data[proc]);
+    }
+    std::vector<int> recv_counts(nodes), recv_displs(nodes, 0);
+    MPI_Alltoall(&send_counts[0], 1, MPI_INT, &recv_counts[0], 1, MPI_INT, communicator);
+    std::partial_sum(recv_counts.begin(), recv_counts.end() - 1, recv_displs.begin() + 1);
+    const int recv_size = recv_displs[nodes - 1] + recv_counts[nodes - 1];
+    std::vector<char> recv_buffer(std::max(recv_size, 1));
+    MPI_Alltoallv(&send_buffer[0],
+                  &send_counts[0],
+                  &send_displs[0],
+                  MPI_BYTE,
+                  &recv_buffer[0],
+                  &recv_counts[0],
+                  &recv_displs[0],
+                  MPI_BYTE,
+                  communicator);
+    std::vector<char>().swap(send_buffer);
+
+    // Determine the order of the received vertices.  Each packed vertex begins
+    // with its size and its (structure, vertex) index.
+    std::vector<std::pair<std::pair<int, int>, int> > recv_vertices;
+    for (int offset = 0; offset < recv_size;)
+    {
+        const char* buffer = &recv_buffer[offset];
+        int vertex_data_size;
+        std::pair<int, int> point_idx;
+        unpack_structure_value(buffer, vertex_data_size);
+        unpack_structure_value(buffer, point_idx);
+        recv_vertices.push_back(std::make_pair(point_idx, offset));
+        offset += vertex_data_size;
+    }
+    std::sort(recv_vertices.begin(), recv_vertices.end());
+
+    // Replace the structure data on the level by the received data, which are
+    // stored in the order of the (sorted) local vertex indices.
+    for (unsigned int j = 0; j < num_base_filename; ++j)
+    {
+        d_local_vertex_idx[ln][j].clear();
+        d_vertex_posn[ln][j].clear();
+        d_spring_edge_map[ln][j].clear();
+        d_spring_spec_data[ln][j].clear();
+        d_xspring_edge_map[ln][j].clear();
+        d_xspring_spec_data[ln][j].clear();
+        d_beam_spec_data[ln][j].clear();
+        d_rod_edge_map[ln][j].clear();
+        d_rod_spec_data[ln][j].clear();
+        d_target_spec_data[ln][j].clear();
+        d_anchor_spec_data[ln][j].clear();
+        d_bdry_mass_spec_data[ln][j].clear();
+        d_directors[ln][j].clear();
+        d_instrument_idx[ln][j].clear();
+        d_source_idx[ln][j].clear();
+    }
+    for (std::vector<std::pair<std::pair<int, int>, int> >::const_iterator it = recv_vertices.begin();
+         it != recv_vertices.end();
+         ++it)
+    {
+        unpackVertexData(&recv_buffer[it->second], ln);
+    }
+
+    // The cached vertex binnings refer to the previous distribution of the
+    // vertices and are freed.
+    std::vector<VertexBinning>().swap(d_vertex_binning[ln]);
+    return;
+} // redistributeStructureData
+
+void IBStandardInitializer::packVertexData(std::vector<char>& buffer,
+                                           const std::pair<int, int>& point_index,
+                                           const int level_number) const
+{
+    const int ln = level_number;
+    const int j = point_index.first;
+    const int k = getLocalVertexIndex(point_index, ln);
+    const int mastr_idx = getCanonicalLagrangianIndex(point_index, ln);
+    typedef std::multimap<int, Edge>::const_iterator EdgeIterator;
+
+    // The size of the packed data is filled in once the data have been packed.
+    const size_t vertex_data_offset = buffer.size();
+    pack_structure_value(buffer, 0);
+    pack_structure_value(buffer, point_index);
+
+    // The vertex position and the per-vertex specifications.
+    pack_structure_value(buffer, d_vertex_posn[ln][j][k]);
+    pack_structure_value(buffer, d_target_spec_data[ln][j][k]);
+    pack_structure_value(buffer, d_anchor_spec_data[ln][j][k]);
+    pack_structure_value(buffer, d_bdry_mass_spec_data[ln][j][k]);
+    pack_structure_values(buffer, d_directors[ln][j][k]);
+    pack_structure_value(buffer, getVertexInstrumentationIndices(point_index, ln));
+    pack_structure_value(buffer, getVertexSourceIndices(point_index, ln));
+
+    // The springs for which the present vertex is the "master" vertex.
+    std::pair<EdgeIterator, EdgeIterator> edges = d_spring_edge_map[ln][j].equal_range(mastr_idx);
+    pack_structure_value(buffer, static_cast<int>(std::distance(edges.first, edges.second)));
+    for (EdgeIterator it = edges.first; it != edges.second; ++it)
+    {
+        const Edge& e = it->second;
+        const SpringSpec& spec_data = d_spring_spec_data[ln][j].find(e)->second;
+        pack_structure_value(buffer, e);
+        pack_structure_value(buffer, spec_data.force_fcn_idx);
+        pack_structure_values(buffer, spec_data.parameters);
+    }
+
+    // The crosslink springs, from any of the x-spring files, for which the
+    // present vertex is the "master" vertex.
+    for (unsigned int jj = 0; jj < d_base_filename[ln].size(); ++jj)
+    {
+        edges = d_xspring_edge_map[ln][jj].equal_range(mastr_idx);
+        pack_structure_value(buffer, static_cast<int>(std::distance(edges.first, edges.second)));
+        for (EdgeIterator it = edges.first; it != edges.second; ++it)
+        {
+            const Edge& e = it->second;
+            const XSpringSpec& spec_data = d_xspring_spec_data[ln][jj].find(e)->second;
+            pack_structure_value(buffer, e);
+            pack_structure_value(buffer, spec_data.force_fcn_idx);
+            pack_structure_values(buffer, spec_data.parameters);
+        }
+    }
+
+    // The beams for which the present vertex is the "current" vertex.
+    typedef std::multimap<int, BeamSpec>::const_iterator BeamIterator;
+    const std::pair<BeamIterator, BeamIterator> beams = d_beam_spec_data[ln][j].equal_range(mastr_idx);
+    pack_structure_value(buffer, static_cast<int>(std::distance(beams.first, beams.second)));
+    for (BeamIterator it = beams.first; it != beams.second; ++it)
+    {
+        const BeamSpec& spec_data = it->second;
+        pack_structure_value(buffer, spec_data.neighbor_idxs);
+        pack_structure_value(buffer, spec_data.bend_rigidity);
+        pack_structure_value(buffer, spec_data.curvature);
+    }
+
+    // The rods for which the present vertex is the "current" vertex.
+    edges = d_rod_edge_map[ln][j].equal_range(mastr_idx);
+    pack_structure_value(buffer, static_cast<int>(std::distance(edges.first, edges.second)));
+    for (EdgeIterator it = edges.first; it != edges.second; ++it)
+    {
+        const Edge& e = it->second;
+        pack_structure_value(buffer, e);
+        pack_structure_value(buffer, d_rod_spec_data[ln][j].find(e)->second.properties);
+    }
+
+    const int vertex_data_size = static_cast<int>(buffer.size() - vertex_data_offset);
+    std::memcpy(&buffer[vertex_data_offset], &vertex_data_size, sizeof(int));
+    return;
+} // packVertexData
+
+void IBStandardInitializer::unpackVertexData(const char* buffer, const int level_number)
+{
+    const int ln = level_number;
+    int vertex_data_size;
+    std::pair<int, int> point_index;
+    unpack_structure_value(buffer, vertex_data_size);
+    unpack_structure_value(buffer, point_index);
+    const int j = point_index.first;
+    const int mastr_idx = getCanonicalLagrangianIndex(point_index, ln);
+
+    // The vertex position and the per-vertex specifications.
+    d_local_vertex_idx[ln][j].push_back(point_index.second);
+    d_vertex_posn[ln][j].push_back(Point());
+    unpack_structure_value(buffer, d_vertex_posn[ln][j].back());
+    d_target_spec_data[ln][j].push_back(TargetSpec());
+    unpack_structure_value(buffer, d_target_spec_data[ln][j].back());
+    d_anchor_spec_data[ln][j].push_back(AnchorSpec());
+    unpack_structure_value(buffer, d_anchor_spec_data[ln][j].back());
+    d_bdry_mass_spec_data[ln][j].push_back(BdryMassSpec());
+    unpack_structure_value(buffer, d_bdry_mass_spec_data[ln][j].back());
+    d_directors[ln][j].push_back(std::vector<double>());
+    unpack_structure_values(buffer, d_directors[ln][j].back());
+    std::pair<int, int> inst_idx;
+    unpack_structure_value(buffer, inst_idx);
+    if (inst_idx.first != -1) d_instrument_idx[ln][j][point_index.second] = inst_idx;
+    int source_idx;
+    unpack_structure_value(buffer, source_idx);
+    if (source_idx != -1) d_source_idx[ln][j][point_index.second] = source_idx;
+
+    // The springs for which the present vertex is the "master" vertex.
+    int num_edges;
+    unpack_structure_value(buffer, num_edges);
+    for (int k = 0; k < num_edges; ++k)
+    {
+        Edge e;
+        SpringSpec spec_data;
+        unpack_structure_value(buffer, e);
+        unpack_structure_value(buffer, spec_data.force_fcn_idx);
+        unpack_structure_values(buffer, spec_data.parameters);
+        d_spring_edge_map[ln][j].insert(std::make_pair(mastr_idx, e));
+        d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
+    }
+
+    // The crosslink springs for which the present vertex is the "master"
+    // vertex.
+    for (unsigned int jj = 0; jj < d_base_filename[ln].size(); ++jj)
+    {
+        unpack_structure_value(buffer, num_edges);
+        for (int k = 0; k < num_edges; ++k)
+        {
+            Edge e;
+            XSpringSpec spec_data;
+            unpack_structure_value(buffer, e);
+            unpack_structure_value(buffer, spec_data.force_fcn_idx);
+            unpack_structure_values(buffer, spec_data.parameters);
+            d_xspring_edge_map[ln][jj].insert(std::make_pair(mastr_idx, e));
+            d_xspring_spec_data[ln][jj].insert(std::make_pair(e, spec_data));
+        }
+    }
+
+    // The beams for which the present vertex is the "current" vertex.
+    int num_beams;
+    unpack_structure_value(buffer, num_beams);
+    for (int k = 0; k < num_beams; ++k)
+    {
+        BeamSpec spec_data;
+        unpack_structure_value(buffer, spec_data.neighbor_idxs);
+        unpack_structure_value(buffer, spec_data.bend_rigidity);
+        unpack_structure_value(buffer, spec_data.curvature);
+        d_beam_spec_data[ln][j].insert(std::make_pair(mastr_idx, spec_data));
+    }
+
+    // The rods for which the present vertex is the "current" vertex.
+    unpack_structure_value(buffer, num_edges);
+    for (int k = 0; k < num_edges; ++k)
+    {
+        Edge e;
+        RodSpec spec_data;
+        unpack_structure_value(buffer, e);
+        unpack_structure_value(buffer, spec_data.properties);
+        d_rod_edge_map[ln][j].insert(std::make_pair(mastr_idx, e));
+        d_rod_spec_data[ln][j].insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // unpackVertexData
+
 void IBStandardInitializer::readVertexFiles(const std::string& extension)
 {
     std::string line_string;
@@ -704,11 +1611,26 @@ void IBStandardInitializer::readVertexFiles(const std::string& extension)
         d_num_vertex[ln].resize(num_base_filename, 0);
         d_vertex_offset[ln].resize(num_base_filename, std::numeric_limits<int>::max());
         d_vertex_posn[ln].resize(num_base_filename);
+        d_local_vertex_idx[ln].resize(num_base_filename);
+        d_vertex_binning[ln].clear(); // any cached binnings refer to the old vertex positions
+
+        // Collectively read the binary versions of the files, if they exist.
+        // The structure data on the level are distributed among the processes
+        // only if all of the vertex files on the level are binary files.
+        std::vector<BinaryStructureData> bin_data(num_base_filename);
+        std::vector<bool> read_binary(num_base_filename, false);
         for (unsigned int j = 0; j < num_base_filename; ++j)
         {
-            // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            read_binary[j] =
+                d_use_binary_structure_files &&
+                read_binary_structure_file(
+                    bin_data[j], d_base_filename[ln][j] + extension + ".bin", 0, NDIM, NDIM, false, d_object_name);
+        }
+        d_level_data_is_distributed[ln] =
+            num_base_filename > 0 && std::find(read_binary.begin(), read_binary.end(), false) == read_binary.end();
 
+        for (unsigned int j = 0; j < num_base_filename; ++j)
+        {
             if (j == 0)
             {
                 d_vertex_offset[ln][j] = 0;
@@ -718,18 +1640,29 @@ void IBStandardInitializer::readVertexFiles(const std::string& extension)
                 d_vertex_offset[ln][j] = d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1];
             }
 
+            if (read_binary[j] && !d_level_data_is_distributed[ln]) gather_binary_structure_records(bin_data[j]);
+            const std::string file_type = read_binary[j] ? "binary" : "ASCII";
+
+            // Wait for the previous MPI process to finish reading the current file.
+            if (d_use_file_batons && !read_binary[j] && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+
             // Ensure that the file exists.
-            const std::string vertex_filename = d_base_filename[ln][j] + extension;
+            const std::string vertex_filename = d_base_filename[ln][j] + extension + (read_binary[j] ? ".bin" : "");
             std::ifstream file_stream;
-            file_stream.open(vertex_filename.c_str(), std::ios::in);
-            if (file_stream.is_open())
+            if (!read_binary[j]) file_stream.open(vertex_filename.c_str(), std::ios::in);
+            if (read_binary[j] || file_stream.is_open())
             {
                 plog << d_object_name << ":  "
-                     << "processing vertex data from ASCII input file named " << vertex_filename << std::endl
+                     << "processing vertex data from " << file_type << " input file named " << vertex_filename
+                     << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first entry in the file is the number of vertices.
-                if (!std::getline(file_stream, line_string))
+                if (read_binary[j])
+                {
+                    d_num_vertex[ln][j] = bin_data[j].num_records;
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file " << vertex_filename << std::endl);
@@ -753,17 +1686,35 @@ void IBStandardInitializer::readVertexFiles(const std::string& extension)
 
                 // Each successive line provides the initial position of each
                 // vertex in the input file.
-                d_vertex_posn[ln][j].resize(d_num_vertex[ln][j]);
-                for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                //
+                // On distributed levels, each process stores only the positions
+                // of the vertices whose records it has read, in the order of
+                // their indices.
+                if (read_binary[j])
                 {
-                    Point& X = d_vertex_posn[ln][j][k];
-                    if (!std::getline(file_stream, line_string))
+                    if (d_level_data_is_distributed[ln]) d_local_vertex_idx[ln][j] = bin_data[j].record_idx;
+                    const int num_local_vertex = static_cast<int>(bin_data[j].record_idx.size());
+                    d_vertex_posn[ln][j].resize(num_local_vertex);
+                    for (int k = 0; k < num_local_vertex; ++k)
                     {
-                        TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << k + 2
-                                                 << " of file " << vertex_filename << std::endl);
+                        Point& X = d_vertex_posn[ln][j][k];
+                        for (unsigned int d = 0; d < NDIM; ++d)
+                        {
+                            X[d] = d_length_scale_factor * (bin_data[j].double_data[NDIM * k + d] + d_posn_shift[d]);
+                        }
                     }
-                    else
+                }
+                else
+                {
+                    d_vertex_posn[ln][j].resize(d_num_vertex[ln][j]);
+                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
                     {
+                        Point& X = d_vertex_posn[ln][j][k];
+                        if (!std::getline(file_stream, line_string))
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line "
+                                                     << k + 2 << " of file " << vertex_filename << std::endl);
+                        }
                         line_string = discard_comments(line_string);
                         std::istringstream line_stream(line_string);
                         for (unsigned int d = 0; d < NDIM; ++d)
@@ -782,7 +1733,8 @@ void IBStandardInitializer::readVertexFiles(const std::string& extension)
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << d_num_vertex[ln][j] << " vertices from ASCII input file named " << vertex_filename
+                     << "read " << d_num_vertex[ln][j] << " vertices from " << file_type << " input file named "
+                     << vertex_filename
                      << std::endl << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
             else
@@ -791,7 +1743,10 @@ void IBStandardInitializer::readVertexFiles(const std::string& extension)
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (d_use_file_batons && !read_binary[j] && rank != nodes - 1)
+            {
+                SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            }
         }
     }
 
@@ -823,23 +1778,55 @@ void IBStandardInitializer::readSpringFiles(const std::string& extension, const
                 (input_uses_global_idxs ? std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0) :
                                           d_num_vertex[ln][j]);
 
+            // Collectively read the binary version of the file, if it exists.
+            BinaryStructureData bin_data;
+            const bool read_binary =
+                d_use_binary_structure_files &&
+                read_binary_structure_file(bin_data,
+                                           d_base_filename[ln][j] + extension + ".bin",
+                                           3,
+                                           2,
+                                           std::numeric_limits<int>::max(),
+                                           !d_level_data_is_distributed[ln],
+                                           d_object_name);
+            const std::string file_type = read_binary ? "binary" : "ASCII";
+
+            // On distributed levels, send each binary record to the process that
+            // holds the first vertex of the edge.
+            if (read_binary && d_level_data_is_distributed[ln])
+            {
+                const int idx_offset = input_uses_global_idxs ? 0 : d_vertex_offset[ln][j];
+                std::vector<int> key_idxs(bin_data.record_idx.size());
+                for (unsigned int k = 0; k < key_idxs.size(); ++k)
+                {
+                    const int* const idxs = &bin_data.int_data[3 * k];
+                    key_idxs[k] = binary_structure_key_idx(std::min(idxs[0], idxs[1]), min_idx, max_idx, idx_offset);
+                }
+                distribute_binary_structure_records(bin_data, key_idxs, d_num_vertex[ln], d_vertex_offset[ln]);
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
             // Ensure that the file exists.
-            const std::string spring_filename = d_base_filename[ln][j] + extension;
+            const std::string spring_filename = d_base_filename[ln][j] + extension + (read_binary ? ".bin" : "");
             std::ifstream file_stream;
-            file_stream.open(spring_filename.c_str(), std::ios::in);
-            if (file_stream.is_open())
+            if (!read_binary) file_stream.open(spring_filename.c_str(), std::ios::in);
+            if (read_binary || file_stream.is_open())
             {
                 plog << d_object_name << ":  "
-                     << "processing spring data from ASCII input file named " << spring_filename << std::endl
+                     << "processing spring data from " << file_type << " input file named " << spring_filename
+                     << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of edges in the input
                 // file.
                 int num_edges = -1;
-                if (!std::getline(file_stream, line_string))
+                if (read_binary)
+                {
+                    num_edges = bin_data.num_records;
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file " << spring_filename << std::endl);
@@ -863,12 +1850,30 @@ void IBStandardInitializer::readSpringFiles(const std::string& extension, const
 
                 // Each successive line provides the connectivity and material parameter
                 // information for each spring in the structure.
-                for (int k = 0; k < num_edges; ++k)
+                const int num_records = read_binary ? static_cast<int>(bin_data.record_idx.size()) : num_edges;
+                for (int k = 0; k < num_records; ++k)
                 {
                     Edge e;
                     std::vector<double> parameters(2);
                     int force_fcn_idx = 0;
-                    if (!std::getline(file_stream, line_string))
+                    if (read_binary)
+                    {
+                        const int* const idxs = &bin_data.int_data[3 * k];
+                        const double* const params = &bin_data.double_data[bin_data.num_double_fields * k];
+                        e.first = idxs[0];
+                        e.second = idxs[1];
+                        force_fcn_idx = idxs[2];
+                        parameters.assign(params, params + bin_data.num_double_fields);
+                        const int record = bin_data.record_idx[k];
+                        check_binary_vertex_index(e.first, min_idx, max_idx, record, spring_filename, d_object_name);
+                        check_binary_vertex_index(e.second, min_idx, max_idx, record, spring_filename, d_object_name);
+                        check_binary_nonnegative_value(
+                            parameters[0], "spring constant", record, spring_filename, d_object_name);
+                        check_binary_nonnegative_value(
+                            parameters[1], "spring resting length", record, spring_filename, d_object_name);
+                        parameters[1] *= d_length_scale_factor;
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << k + 2
                                                  << " of file " << spring_filename << std::endl);
@@ -959,8 +1964,8 @@ void IBStandardInitializer::readSpringFiles(const std::string& extension, const
                         (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
                     {
                         TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
-                                                      "encountered in ASCII input file named " << spring_filename << "."
-                                                   << std::endl);
+                                                      "encountered in " << file_type << " input file named "
+                                                   << spring_filename << "." << std::endl);
                         warned = true;
                     }
 
@@ -980,6 +1985,7 @@ void IBStandardInitializer::readSpringFiles(const std::string& extension, const
                     {
                         std::swap<int>(e.first, e.second);
                     }
+                    if (d_level_data_is_distributed[ln] && !isLocalVertex(getPointIndex(e.first, ln), ln)) continue;
                     d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
                     SpringSpec spec_data;
                     spec_data.parameters = parameters;
@@ -991,12 +1997,13 @@ void IBStandardInitializer::readSpringFiles(const std::string& extension, const
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_edges << " edges from ASCII input file named " << spring_filename << std::endl
+                     << "read " << num_edges << " edges from " << file_type << " input file named "
+                     << spring_filename << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
 
@@ -1028,23 +2035,55 @@ void IBStandardInitializer::readXSpringFiles(const std::string& extension, const
                 (input_uses_global_idxs ? std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0) :
                                           d_num_vertex[ln][j]);
 
+            // Collectively read the binary version of the file, if it exists.
+            BinaryStructureData bin_data;
+            const bool read_binary =
+                d_use_binary_structure_files &&
+                read_binary_structure_file(bin_data,
+                                           d_base_filename[ln][j] + extension + ".bin",
+                                           3,
+                                           2,
+                                           std::numeric_limits<int>::max(),
+                                           !d_level_data_is_distributed[ln],
+                                           d_object_name);
+            const std::string file_type = read_binary ? "binary" : "ASCII";
+
+            // On distributed levels, send each binary record to the process that
+            // holds the first vertex of the edge.
+            if (read_binary && d_level_data_is_distributed[ln])
+            {
+                const int idx_offset = input_uses_global_idxs ? 0 : d_vertex_offset[ln][j];
+                std::vector<int> key_idxs(bin_data.record_idx.size());
+                for (unsigned int k = 0; k < key_idxs.size(); ++k)
+                {
+                    const int* const idxs = &bin_data.int_data[3 * k];
+                    key_idxs[k] = binary_structure_key_idx(std::min(idxs[0], idxs[1]), min_idx, max_idx, idx_offset);
+                }
+                distribute_binary_structure_records(bin_data, key_idxs, d_num_vertex[ln], d_vertex_offset[ln]);
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
             // Ensure that the file exists.
-            const std::string xspring_filename = d_base_filename[ln][j] + extension;
+            const std::string xspring_filename = d_base_filename[ln][j] + extension + (read_binary ? ".bin" : "");
             std::ifstream file_stream;
-            file_stream.open(xspring_filename.c_str(), std::ios::in);
-            if (file_stream.is_open())
+            if (!read_binary) file_stream.open(xspring_filename.c_str(), std::ios::in);
+            if (read_binary || file_stream.is_open())
             {
                 plog << d_object_name << ":  "
-                     << "processing crosslink spring data from ASCII input file named " << xspring_filename << std::endl
+                     << "processing crosslink spring data from " << file_type << " input file named "
+                     << xspring_filename << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of edges in the input
                 // file.
                 int num_edges = -1;
-                if (!std::getline(file_stream, line_string))
+                if (read_binary)
+                {
+                    num_edges = bin_data.num_records;
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file " << xspring_filename << std::endl);
@@ -1068,12 +2107,30 @@ void IBStandardInitializer::readXSpringFiles(const std::string& extension, const
 
                 // Each successive line provides the connectivity and material parameter
                 // information for each crosslink spring in the structure.
-                for (int k = 0; k < num_edges; ++k)
+                const int num_records = read_binary ? static_cast<int>(bin_data.record_idx.size()) : num_edges;
+                for (int k = 0; k < num_records; ++k)
                 {
                     Edge e;
                     std::vector<double> parameters(2);
                     int force_fcn_idx = 0;
-                    if (!std::getline(file_stream, line_string))
+                    if (read_binary)
+                    {
+                        const int* const idxs = &bin_data.int_data[3 * k];
+                        const double* const params = &bin_data.double_data[bin_data.num_double_fields * k];
+                        e.first = idxs[0];
+                        e.second = idxs[1];
+                        force_fcn_idx = idxs[2];
+                        parameters.assign(params, params + bin_data.num_double_fields);
+                        const int record = bin_data.record_idx[k];
+                        check_binary_vertex_index(e.first, min_idx, max_idx, record, xspring_filename, d_object_name);
+                        check_binary_vertex_index(e.second, min_idx, max_idx, record, xspring_filename, d_object_name);
+                        check_binary_nonnegative_value(
+                            parameters[0], "spring constant", record, xspring_filename, d_object_name);
+                        check_binary_nonnegative_value(
+                            parameters[1], "spring resting length", record, xspring_filename, d_object_name);
+                        parameters[1] *= d_length_scale_factor;
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << k + 2
                                                  << " of file " << xspring_filename << std::endl);
@@ -1166,8 +2223,8 @@ void IBStandardInitializer::readXSpringFiles(const std::string& extension, const
                         (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
                     {
                         TBOX_WARNING(d_object_name << ":\n  Crosslink spring with zero spring "
-                                                      "constant encountered in ASCII input file "
-                                                      "named " << xspring_filename << "." << std::endl);
+                                                      "constant encountered in " << file_type
+                                                   << " input file named " << xspring_filename << "." << std::endl);
                         warned = true;
                     }
 
@@ -1187,6 +2244,7 @@ void IBStandardInitializer::readXSpringFiles(const std::string& extension, const
                     {
                         std::swap<int>(e.first, e.second);
                     }
+                    if (d_level_data_is_distributed[ln] && !isLocalVertex(getPointIndex(e.first, ln), ln)) continue;
                     d_xspring_edge_map[ln][j].insert(std::make_pair(e.first, e));
                     XSpringSpec spec_data;
                     spec_data.parameters = parameters;
@@ -1198,12 +2256,13 @@ void IBStandardInitializer::readXSpringFiles(const std::string& extension, const
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_edges << " edges from ASCII input file named " << xspring_filename << std::endl
+                     << "read " << num_edges << " edges from " << file_type << " input file named "
+                     << xspring_filename << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
 
@@ -1234,22 +2293,52 @@ void IBStandardInitializer::readBeamFiles(const std::string& extension, const bo
                 (input_uses_global_idxs ? std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0) :
                                           d_num_vertex[ln][j]);
 
+            // Collectively read the binary version of the file, if it exists.
+            BinaryStructureData bin_data;
+            const bool read_binary =
+                d_use_binary_structure_files &&
+                read_binary_structure_file(bin_data,
+                                           d_base_filename[ln][j] + extension + ".bin",
+                                           3,
+                                           1,
+                                           1 + NDIM,
+                                           !d_level_data_is_distributed[ln],
+                                           d_object_name);
+            const std::string file_type = read_binary ? "binary" : "ASCII";
+
+            // On distributed levels, send each binary record to the process that
+            // holds the "current" vertex of the beam.
+            if (read_binary && d_level_data_is_distributed[ln])
+            {
+                const int idx_offset = input_uses_global_idxs ? 0 : d_vertex_offset[ln][j];
+                std::vector<int> key_idxs(bin_data.record_idx.size());
+                for (unsigned int k = 0; k < key_idxs.size(); ++k)
+                {
+                    key_idxs[k] = binary_structure_key_idx(bin_data.int_data[3 * k + 1], min_idx, max_idx, idx_offset);
+                }
+                distribute_binary_structure_records(bin_data, key_idxs, d_num_vertex[ln], d_vertex_offset[ln]);
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
-            const std::string beam_filename = d_base_filename[ln][j] + extension;
+            const std::string beam_filename = d_base_filename[ln][j] + extension + (read_binary ? ".bin" : "");
             std::ifstream file_stream;
-            file_stream.open(beam_filename.c_str(), std::ios::in);
-            if (file_stream.is_open())
+            if (!read_binary) file_stream.open(beam_filename.c_str(), std::ios::in);
+            if (read_binary || file_stream.is_open())
             {
                 plog << d_object_name << ":  "
-                     << "processing beam data from ASCII input file named " << beam_filename << std::endl
+                     << "processing beam data from " << file_type << " input file named " << beam_filename << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of beams in
                 // the input file.
                 int num_beams = -1;
-                if (!std::getline(file_stream, line_string))
+                if (read_binary)
+                {
+                    num_beams = bin_data.num_records;
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file " << beam_filename << std::endl);
@@ -1273,13 +2362,38 @@ void IBStandardInitializer::readBeamFiles(const std::string& extension, const bo
 
                 // Each successive line provides the connectivity and material
                 // parameter information for each beam in the structure.
-                for (int k = 0; k < num_beams; ++k)
+                const int num_records = read_binary ? static_cast<int>(bin_data.record_idx.size()) : num_beams;
+                for (int k = 0; k < num_records; ++k)
                 {
                     int prev_idx = std::numeric_limits<int>::max(), curr_idx = std::numeric_limits<int>::max(),
                         next_idx = std::numeric_limits<int>::max();
                     double bend = 0.0;
                     Vector curv(Vector::Zero());
-                    if (!std::getline(file_stream, line_string))
+                    if (read_binary)
+                    {
+                        const int* const idxs = &bin_data.int_data[3 * k];
+                        const double* const params = &bin_data.double_data[bin_data.num_double_fields * k];
+                        prev_idx = idxs[0];
+                        curr_idx = idxs[1];
+                        next_idx = idxs[2];
+                        bend = params[0];
+                        if (bin_data.num_double_fields == 1 + NDIM)
+                        {
+                            for (unsigned int d = 0; d < NDIM; ++d) curv[d] = params[1 + d];
+                        }
+                        else if (bin_data.num_double_fields != 1)
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Invalid record layout in binary input file "
+                                                     << beam_filename << std::endl
+                                                     << "  incomplete beam curvature specification" << std::endl);
+                        }
+                        const int record = bin_data.record_idx[k];
+                        check_binary_vertex_index(prev_idx, min_idx, max_idx, record, beam_filename, d_object_name);
+                        check_binary_vertex_index(curr_idx, min_idx, max_idx, record, beam_filename, d_object_name);
+                        check_binary_vertex_index(next_idx, min_idx, max_idx, record, beam_filename, d_object_name);
+                        check_binary_nonnegative_value(bend, "beam constant", record, beam_filename, d_object_name);
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << k + 2
                                                  << " of file " << beam_filename << std::endl);
@@ -1375,8 +2489,8 @@ void IBStandardInitializer::readBeamFiles(const std::string& extension, const bo
                     if (!warned && d_enable_beams[ln][j] && (bend == 0.0 || MathUtilities<double>::equalEps(bend, 0.0)))
                     {
                         TBOX_WARNING(d_object_name << ":\n  Beam with zero bending rigidity "
-                                                      "encountered in ASCII input file named " << beam_filename << "."
-                                                   << std::endl);
+                                                      "encountered in " << file_type << " input file named "
+                                                   << beam_filename << "." << std::endl);
                         warned = true;
                     }
 
@@ -1388,6 +2502,7 @@ void IBStandardInitializer::readBeamFiles(const std::string& extension, const bo
                         curr_idx += d_vertex_offset[ln][j];
                         next_idx += d_vertex_offset[ln][j];
                     }
+                    if (d_level_data_is_distributed[ln] && !isLocalVertex(getPointIndex(curr_idx, ln), ln)) continue;
 
                     // Initialize the map data corresponding to the present
                     // beam.
@@ -1405,12 +2520,13 @@ void IBStandardInitializer::readBeamFiles(const std::string& extension, const bo
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_beams << " beams from ASCII input file named " << beam_filename << std::endl
+                     << "read " << num_beams << " beams from " << file_type << " input file named " << beam_filename
+                     << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
 
@@ -1440,22 +2556,52 @@ void IBStandardInitializer::readRodFiles(const std::string& extension, const boo
                 (input_uses_global_idxs ? std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0) :
                                           d_num_vertex[ln][j]);
 
+            // Collectively read the binary version of the file, if it exists.
+            BinaryStructureData bin_data;
+            const bool read_binary =
+                d_use_binary_structure_files &&
+                read_binary_structure_file(bin_data,
+                                           d_base_filename[ln][j] + extension + ".bin",
+                                           2,
+                                           7,
+                                           IBRodForceSpec::NUM_MATERIAL_PARAMS,
+                                           !d_level_data_is_distributed[ln],
+                                           d_object_name);
+            const std::string file_type = read_binary ? "binary" : "ASCII";
+
+            // On distributed levels, send each binary record to the process that
+            // holds the "current" vertex of the rod.
+            if (read_binary && d_level_data_is_distributed[ln])
+            {
+                const int idx_offset = input_uses_global_idxs ? 0 : d_vertex_offset[ln][j];
+                std::vector<int> key_idxs(bin_data.record_idx.size());
+                for (unsigned int k = 0; k < key_idxs.size(); ++k)
+                {
+                    key_idxs[k] = binary_structure_key_idx(bin_data.int_data[2 * k], min_idx, max_idx, idx_offset);
+                }
+                distribute_binary_structure_records(bin_data, key_idxs, d_num_vertex[ln], d_vertex_offset[ln]);
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
-            const std::string rod_filename = d_base_filename[ln][j] + extension;
+            const std::string rod_filename = d_base_filename[ln][j] + extension + (read_binary ? ".bin" : "");
             std::ifstream file_stream;
-            file_stream.open(rod_filename.c_str(), std::ios::in);
-            if (file_stream.is_open())
+            if (!read_binary) file_stream.open(rod_filename.c_str(), std::ios::in);
+            if (read_binary || file_stream.is_open())
             {
                 plog << d_object_name << ":  "
-                     << "processing rod data from ASCII input file named " << rod_filename << std::endl
+                     << "processing rod data from " << file_type << " input file named " << rod_filename << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of rods in
                 // the input file.
                 int num_rods = -1;
-                if (!std::getline(file_stream, line_string))
+                if (read_binary)
+                {
+                    num_rods = bin_data.num_records;
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file " << rod_filename << std::endl);
@@ -1479,7 +2625,8 @@ void IBStandardInitializer::readRodFiles(const std::string& extension, const boo
 
                 // Each successive line provides the connectivity and material
                 // parameter information for each rod in the structure.
-                for (int k = 0; k < num_rods; ++k)
+                const int num_records = read_binary ? static_cast<int>(bin_data.record_idx.size()) : num_rods;
+                for (int k = 0; k < num_records; ++k)
                 {
                     int curr_idx = std::numeric_limits<int>::max(), next_idx = std::numeric_limits<int>::max();
                     boost::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> properties;
@@ -1494,7 +2641,30 @@ void IBStandardInitializer::readRodFiles(const std::string& extension, const boo
                     double& kappa2 = properties[8];
                     double& tau = properties[9];
 
-                    if (!std::getline(file_stream, line_string))
+                    if (read_binary)
+                    {
+                        const int* const idxs = &bin_data.int_data[2 * k];
+                        const double* const params = &bin_data.double_data[bin_data.num_double_fields * k];
+                        curr_idx = idxs[0];
+                        next_idx = idxs[1];
+                        const int record = bin_data.record_idx[k];
+                        check_binary_vertex_index(curr_idx, min_idx, max_idx, record, rod_filename, d_object_name);
+                        check_binary_vertex_index(next_idx, min_idx, max_idx, record, rod_filename, d_object_name);
+                        for (int n = 0; n < IBRodForceSpec::NUM_MATERIAL_PARAMS; ++n)
+                        {
+                            properties[n] = n < bin_data.num_double_fields ? params[n] : 0.0;
+                        }
+                        static const char* const property_names[7] = { "ds", "a1", "a2", "a3", "b1", "b2", "b3" };
+                        for (int n = 0; n < 7; ++n)
+                        {
+                            check_binary_nonnegative_value(properties[n],
+                                                           std::string("rod material constant ") + property_names[n],
+                                                           record,
+                                                           rod_filename,
+                                                           d_object_name);
+                        }
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << k + 2
                                                  << " of file " << rod_filename << std::endl);
@@ -1673,6 +2843,7 @@ void IBStandardInitializer::readRodFiles(const std::string& extension, const boo
                         curr_idx += d_vertex_offset[ln][j];
                         next_idx += d_vertex_offset[ln][j];
                     }
+                    if (d_level_data_is_distributed[ln] && !isLocalVertex(getPointIndex(curr_idx, ln), ln)) continue;
 
                     // Initialize the map data corresponding to the present rod.
                     //
@@ -1691,12 +2862,13 @@ void IBStandardInitializer::readRodFiles(const std::string& extension, const boo
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_rods << " rods from ASCII input file named " << rod_filename << std::endl
+                     << "read " << num_rods << " rods from " << file_type << " input file named " << rod_filename
+                     << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
 
@@ -1725,27 +2897,59 @@ void IBStandardInitializer::readTargetPointFiles(const std::string& extension)
             const int min_idx = 0;
             const int max_idx = d_num_vertex[ln][j];
 
+            // Collectively read the binary version of the file, if it exists.
+            BinaryStructureData bin_data;
+            const bool read_binary =
+                d_use_binary_structure_files &&
+                read_binary_structure_file(bin_data,
+                                           d_base_filename[ln][j] + extension + ".bin",
+                                           1,
+                                           1,
+                                           2,
+                                           !d_level_data_is_distributed[ln],
+                                           d_object_name);
+            const std::string file_type = read_binary ? "binary" : "ASCII";
+
+            // On distributed levels, send each binary record to the process that
+            // holds the vertex.
+            if (read_binary && d_level_data_is_distributed[ln])
+            {
+                std::vector<int> key_idxs(bin_data.record_idx.size());
+                for (unsigned int k = 0; k < key_idxs.size(); ++k)
+                {
+                    key_idxs[k] =
+                        binary_structure_key_idx(bin_data.int_data[k], min_idx, max_idx, d_vertex_offset[ln][j]);
+                }
+                distribute_binary_structure_records(bin_data, key_idxs, d_num_vertex[ln], d_vertex_offset[ln]);
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
             TargetSpec default_spec;
             default_spec.stiffness = 0.0;
             default_spec.damping = 0.0;
-            d_target_spec_data[ln][j].resize(d_num_vertex[ln][j], default_spec);
+            d_target_spec_data[ln][j].resize(d_vertex_posn[ln][j].size(), default_spec);
 
-            const std::string target_point_stiffness_filename = d_base_filename[ln][j] + extension;
+            const std::string target_point_stiffness_filename =
+                d_base_filename[ln][j] + extension + (read_binary ? ".bin" : "");
             std::ifstream file_stream;
-            file_stream.open(target_point_stiffness_filename.c_str(), std::ios::in);
-            if (file_stream.is_open())
+            if (!read_binary) file_stream.open(target_point_stiffness_filename.c_str(), std::ios::in);
+            if (read_binary || file_stream.is_open())
             {
                 plog << d_object_name << ":  "
-                     << "processing target point data from ASCII input file named " << target_point_stiffness_filename
+                     << "processing target point data from " << file_type << " input file named "
+                     << target_point_stiffness_filename
                      << std::endl << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of target
                 // point specifications in the input file.
                 int num_target_points = -1;
-                if (!std::getline(file_stream, line_string))
+                if (read_binary)
+                {
+                    num_target_points = bin_data.num_records;
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file " << target_point_stiffness_filename
@@ -1771,10 +2975,32 @@ void IBStandardInitializer::readTargetPointFiles(const std::string& extension)
 
                 // Each successive line indicates the vertex number and spring
                 // constant associated with any target points.
-                for (int k = 0; k < num_target_points; ++k)
+                const int num_records = read_binary ? static_cast<int>(bin_data.record_idx.size()) : num_target_points;
+                for (int k = 0; k < num_records; ++k)
                 {
                     int n = std::numeric_limits<int>::max();
-                    if (!std::getline(file_stream, line_string))
+                    TargetSpec spec = default_spec;
+                    if (read_binary)
+                    {
+                        const int record = bin_data.record_idx[k];
+                        const double* const params = &bin_data.double_data[bin_data.num_double_fields * k];
+                        n = bin_data.int_data[k];
+                        check_binary_vertex_index(
+                            n, min_idx, max_idx, record, target_point_stiffness_filename, d_object_name);
+                        spec.stiffness = params[0];
+                        spec.damping = bin_data.num_double_fields > 1 ? params[1] : 0.0;
+                        check_binary_nonnegative_value(spec.stiffness,
+                                                       "target point spring constant",
+                                                       record,
+                                                       target_point_stiffness_filename,
+                                                       d_object_name);
+                        check_binary_nonnegative_value(spec.damping,
+                                                       "target point damping coefficient",
+                                                       record,
+                                                       target_point_stiffness_filename,
+                                                       d_object_name);
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << k + 2
                                                  << " of file " << target_point_stiffness_filename << std::endl);
@@ -1795,23 +3021,23 @@ void IBStandardInitializer::readTargetPointFiles(const std::string& extension)
                                                      << "  vertex index " << n << " is out of range" << std::endl);
                         }
 
-                        if (!(line_stream >> d_target_spec_data[ln][j][n].stiffness))
+                        if (!(line_stream >> spec.stiffness))
                         {
                             TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << k + 2
                                                      << " of file " << target_point_stiffness_filename << std::endl);
                         }
-                        else if (d_target_spec_data[ln][j][n].stiffness < 0.0)
+                        else if (spec.stiffness < 0.0)
                         {
                             TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << k + 2
                                                      << " of file " << target_point_stiffness_filename << std::endl
                                                      << "  target point spring constant is negative" << std::endl);
                         }
 
-                        if (!(line_stream >> d_target_spec_data[ln][j][n].damping))
+                        if (!(line_stream >> spec.damping))
                         {
-                            d_target_spec_data[ln][j][n].damping = 0.0;
+                            spec.damping = 0.0;
                         }
-                        else if (d_target_spec_data[ln][j][n].damping < 0.0)
+                        else if (spec.damping < 0.0)
                         {
                             TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << k + 2
                                                      << " of file " << target_point_stiffness_filename << std::endl
@@ -1821,22 +3047,28 @@ void IBStandardInitializer::readTargetPointFiles(const std::string& extension)
 
                     // Check to see if the penalty spring constant is zero and,
                     // if so, emit a warning.
-                    const double kappa = d_target_spec_data[ln][j][n].stiffness;
+                    const double kappa = spec.stiffness;
                     if (!warned && d_enable_target_points[ln][j] &&
                         (kappa == 0.0 || MathUtilities<double>::equalEps(kappa, 0.0)))
                     {
                         TBOX_WARNING(d_object_name << ":\n  Target point with zero penalty spring "
-                                                      "constant encountered in ASCII input file "
-                                                      "named " << target_point_stiffness_filename << "." << std::endl);
+                                                      "constant encountered in " << file_type
+                                                   << " input file named " << target_point_stiffness_filename << "."
+                                                   << std::endl);
                         warned = true;
                     }
+
+                    // Store the specification if this process holds the vertex.
+                    const std::pair<int, int> point_idx(j, n);
+                    if (d_level_data_is_distributed[ln] && !isLocalVertex(point_idx, ln)) continue;
+                    d_target_spec_data[ln][j][getLocalVertexIndex(point_idx, ln)] = spec;
                 }
 
                 // Close the input file.
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_target_points << " target points from ASCII input file named "
+                     << "read " << num_target_points << " target points from " << file_type << " input file named "
                      << target_point_stiffness_filename << std::endl << "  on MPI process " << SAMRAI_MPI::getRank()
                      << std::endl;
             }
@@ -1846,7 +3078,7 @@ void IBStandardInitializer::readTargetPointFiles(const std::string& extension)
             // values are to be employed, for this particular structure.
             if (!d_enable_target_points[ln][j])
             {
-                for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                for (unsigned int k = 0; k < d_target_spec_data[ln][j].size(); ++k)
                 {
                     d_target_spec_data[ln][j][k].stiffness = 0.0;
                     d_target_spec_data[ln][j][k].damping = 0.0;
@@ -1856,14 +3088,14 @@ void IBStandardInitializer::readTargetPointFiles(const std::string& extension)
             {
                 if (d_using_uniform_target_stiffness[ln][j])
                 {
-                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                    for (unsigned int k = 0; k < d_target_spec_data[ln][j].size(); ++k)
                     {
                         d_target_spec_data[ln][j][k].stiffness = d_uniform_target_stiffness[ln][j];
                     }
                 }
                 if (d_using_uniform_target_damping[ln][j])
                 {
-                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                    for (unsigned int k = 0; k < d_target_spec_data[ln][j].size(); ++k)
                     {
                         d_target_spec_data[ln][j][k].damping = d_uniform_target_damping[ln][j];
                     }
@@ -1871,7 +3103,7 @@ void IBStandardInitializer::readTargetPointFiles(const std::string& extension)
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
 
@@ -1898,26 +3130,57 @@ void IBStandardInitializer::readAnchorPointFiles(const std::string& extension)
             const int min_idx = 0;
             const int max_idx = d_num_vertex[ln][j];
 
+            // Collectively read the binary version of the file, if it exists.
+            BinaryStructureData bin_data;
+            const bool read_binary =
+                d_use_binary_structure_files &&
+                read_binary_structure_file(bin_data,
+                                           d_base_filename[ln][j] + extension + ".bin",
+                                           1,
+                                           0,
+                                           0,
+                                           !d_level_data_is_distributed[ln],
+                                           d_object_name);
+            const std::string file_type = read_binary ? "binary" : "ASCII";
+
+            // On distributed levels, send each binary record to the process that
+            // holds the vertex.
+            if (read_binary && d_level_data_is_distributed[ln])
+            {
+                std::vector<int> key_idxs(bin_data.record_idx.size());
+                for (unsigned int k = 0; k < key_idxs.size(); ++k)
+                {
+                    key_idxs[k] =
+                        binary_structure_key_idx(bin_data.int_data[k], min_idx, max_idx, d_vertex_offset[ln][j]);
+                }
+                distribute_binary_structure_records(bin_data, key_idxs, d_num_vertex[ln], d_vertex_offset[ln]);
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
             AnchorSpec default_spec;
             default_spec.is_anchor_point = false;
-            d_anchor_spec_data[ln][j].resize(d_num_vertex[ln][j], default_spec);
+            d_anchor_spec_data[ln][j].resize(d_vertex_posn[ln][j].size(), default_spec);
 
-            const std::string anchor_point_filename = d_base_filename[ln][j] + extension;
+            const std::string anchor_point_filename = d_base_filename[ln][j] + extension + (read_binary ? ".bin" : "");
             std::ifstream file_stream;
-            file_stream.open(anchor_point_filename.c_str(), std::ios::in);
-            if (file_stream.is_open())
+            if (!read_binary) file_stream.open(anchor_point_filename.c_str(), std::ios::in);
+            if (read_binary || file_stream.is_open())
             {
                 plog << d_object_name << ":  "
-                     << "processing anchor point data from ASCII input file named " << anchor_point_filename
+                     << "processing anchor point data from " << file_type << " input file named "
+                     << anchor_point_filename
                      << std::endl << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of anchor
                 // points in the input file.
                 int num_anchor_pts = -1;
-                if (!std::getline(file_stream, line_string))
+                if (read_binary)
+                {
+                    num_anchor_pts = bin_data.num_records;
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file " << anchor_point_filename << std::endl);
@@ -1942,10 +3205,17 @@ void IBStandardInitializer::readAnchorPointFiles(const std::string& extension)
 
                 // Each successive line indicates the vertex number of the
                 // anchor points in the input file.
-                for (int k = 0; k < num_anchor_pts; ++k)
+                const int num_records = read_binary ? static_cast<int>(bin_data.record_idx.size()) : num_anchor_pts;
+                for (int k = 0; k < num_records; ++k)
                 {
-                    int n;
-                    if (!std::getline(file_stream, line_string))
+                    int n = std::numeric_limits<int>::max();
+                    if (read_binary)
+                    {
+                        n = bin_data.int_data[k];
+                        check_binary_vertex_index(
+                            n, min_idx, max_idx, bin_data.record_idx[k], anchor_point_filename, d_object_name);
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << k + 2
                                                  << " of file " << anchor_point_filename << std::endl);
@@ -1965,21 +3235,24 @@ void IBStandardInitializer::readAnchorPointFiles(const std::string& extension)
                                                      << " of file " << anchor_point_filename << std::endl
                                                      << "  vertex index " << n << " is out of range" << std::endl);
                         }
-
-                        d_anchor_spec_data[ln][j][n].is_anchor_point = true;
                     }
+
+                    // Mark the vertex if this process holds it.
+                    const std::pair<int, int> point_idx(j, n);
+                    if (d_level_data_is_distributed[ln] && !isLocalVertex(point_idx, ln)) continue;
+                    d_anchor_spec_data[ln][j][getLocalVertexIndex(point_idx, ln)].is_anchor_point = true;
                 }
 
                 // Close the input file.
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_anchor_pts << " anchor points from ASCII input file named "
+                     << "read " << num_anchor_pts << " anchor points from " << file_type << " input file named "
                      << anchor_point_filename << std::endl << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
     return;
@@ -2003,27 +3276,58 @@ void IBStandardInitializer::readBoundaryMassFiles(const std::string& extension)
             const int min_idx = 0;
             const int max_idx = d_num_vertex[ln][j];
 
+            // Collectively read the binary version of the file, if it exists.
+            BinaryStructureData bin_data;
+            const bool read_binary =
+                d_use_binary_structure_files &&
+                read_binary_structure_file(bin_data,
+                                           d_base_filename[ln][j] + extension + ".bin",
+                                           1,
+                                           2,
+                                           2,
+                                           !d_level_data_is_distributed[ln],
+                                           d_object_name);
+            const std::string file_type = read_binary ? "binary" : "ASCII";
+
+            // On distributed levels, send each binary record to the process that
+            // holds the vertex.
+            if (read_binary && d_level_data_is_distributed[ln])
+            {
+                std::vector<int> key_idxs(bin_data.record_idx.size());
+                for (unsigned int k = 0; k < key_idxs.size(); ++k)
+                {
+                    key_idxs[k] =
+                        binary_structure_key_idx(bin_data.int_data[k], min_idx, max_idx, d_vertex_offset[ln][j]);
+                }
+                distribute_binary_structure_records(bin_data, key_idxs, d_num_vertex[ln], d_vertex_offset[ln]);
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
             BdryMassSpec default_spec;
             default_spec.bdry_mass = 0.0;
             default_spec.stiffness = 0.0;
-            d_bdry_mass_spec_data[ln][j].resize(d_num_vertex[ln][j], default_spec);
+            d_bdry_mass_spec_data[ln][j].resize(d_vertex_posn[ln][j].size(), default_spec);
 
-            const std::string bdry_mass_filename = d_base_filename[ln][j] + extension;
+            const std::string bdry_mass_filename = d_base_filename[ln][j] + extension + (read_binary ? ".bin" : "");
             std::ifstream file_stream;
-            file_stream.open(bdry_mass_filename.c_str(), std::ios::in);
-            if (file_stream.is_open())
+            if (!read_binary) file_stream.open(bdry_mass_filename.c_str(), std::ios::in);
+            if (read_binary || file_stream.is_open())
             {
                 plog << d_object_name << ":  "
-                     << "processing boundary mass data from ASCII input file named " << bdry_mass_filename << std::endl
+                     << "processing boundary mass data from " << file_type << " input file named "
+                     << bdry_mass_filename << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of massive IB
                 // points in the input file.
                 int num_bdry_mass_pts = -1;
-                if (!std::getline(file_stream, line_string))
+                if (read_binary)
+                {
+                    num_bdry_mass_pts = bin_data.num_records;
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file " << bdry_mass_filename << std::endl);
@@ -2049,10 +3353,25 @@ void IBStandardInitializer::readBoundaryMassFiles(const std::string& extension)
                 // Each successive line indicates the vertex number, mass, and
                 // penalty spring constant associated with any massive IB
                 // points.
-                for (int k = 0; k < num_bdry_mass_pts; ++k)
+                const int num_records = read_binary ? static_cast<int>(bin_data.record_idx.size()) : num_bdry_mass_pts;
+                for (int k = 0; k < num_records; ++k)
                 {
-                    int n;
-                    if (!std::getline(file_stream, line_string))
+                    int n = std::numeric_limits<int>::max();
+                    BdryMassSpec spec = default_spec;
+                    if (read_binary)
+                    {
+                        const int record = bin_data.record_idx[k];
+                        const double* const params = &bin_data.double_data[2 * k];
+                        n = bin_data.int_data[k];
+                        check_binary_vertex_index(n, min_idx, max_idx, record, bdry_mass_filename, d_object_name);
+                        spec.bdry_mass = params[0];
+                        spec.stiffness = params[1];
+                        check_binary_nonnegative_value(
+                            spec.bdry_mass, "boundary mass", record, bdry_mass_filename, d_object_name);
+                        check_binary_nonnegative_value(
+                            spec.stiffness, "boundary mass spring constant", record, bdry_mass_filename, d_object_name);
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << k + 2
                                                  << " of file " << bdry_mass_filename << std::endl);
@@ -2073,37 +3392,43 @@ void IBStandardInitializer::readBoundaryMassFiles(const std::string& extension)
                                                      << "  vertex index " << n << " is out of range" << std::endl);
                         }
 
-                        if (!(line_stream >> d_bdry_mass_spec_data[ln][j][n].bdry_mass))
+                        if (!(line_stream >> spec.bdry_mass))
                         {
                             TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << k + 2
                                                      << " of file " << bdry_mass_filename << std::endl);
                         }
-                        else if (d_bdry_mass_spec_data[ln][j][n].bdry_mass < 0.0)
+                        else if (spec.bdry_mass < 0.0)
                         {
                             TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << k + 2
                                                      << " of file " << bdry_mass_filename << std::endl
                                                      << "  boundary mass is negative" << std::endl);
                         }
 
-                        if (!(line_stream >> d_bdry_mass_spec_data[ln][j][n].stiffness))
+                        if (!(line_stream >> spec.stiffness))
                         {
                             TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << k + 2
                                                      << " of file " << bdry_mass_filename << std::endl);
                         }
-                        else if (d_bdry_mass_spec_data[ln][j][n].stiffness < 0.0)
+                        else if (spec.stiffness < 0.0)
                         {
                             TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line " << k + 2
                                                      << " of file " << bdry_mass_filename << std::endl
                                                      << "  boundary mass spring constant is negative" << std::endl);
                         }
                     }
+
+                    // Store the specification if this process holds the vertex.
+                    const std::pair<int, int> point_idx(j, n);
+                    if (d_level_data_is_distributed[ln] && !isLocalVertex(point_idx, ln)) continue;
+                    d_bdry_mass_spec_data[ln][j][getLocalVertexIndex(point_idx, ln)] = spec;
                 }
 
                 // Close the input file.
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_bdry_mass_pts << " boundary mass points from ASCII input file named "
+                     << "read " << num_bdry_mass_pts << " boundary mass points from " << file_type
+                     << " input file named "
                      << bdry_mass_filename << std::endl << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
 
@@ -2112,7 +3437,7 @@ void IBStandardInitializer::readBoundaryMassFiles(const std::string& extension)
             // values are to be employed, for this particular structure.
             if (!d_enable_bdry_mass[ln][j])
             {
-                for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                for (unsigned int k = 0; k < d_bdry_mass_spec_data[ln][j].size(); ++k)
                 {
                     d_bdry_mass_spec_data[ln][j][k].bdry_mass = 0.0;
                     d_bdry_mass_spec_data[ln][j][k].stiffness = 0.0;
@@ -2122,14 +3447,14 @@ void IBStandardInitializer::readBoundaryMassFiles(const std::string& extension)
             {
                 if (d_using_uniform_bdry_mass[ln][j])
                 {
-                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                    for (unsigned int k = 0; k < d_bdry_mass_spec_data[ln][j].size(); ++k)
                     {
                         d_bdry_mass_spec_data[ln][j][k].bdry_mass = d_uniform_bdry_mass[ln][j];
                     }
                 }
                 if (d_using_uniform_bdry_mass_stiffness[ln][j])
                 {
-                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                    for (unsigned int k = 0; k < d_bdry_mass_spec_data[ln][j].size(); ++k)
                     {
                         d_bdry_mass_spec_data[ln][j][k].stiffness = d_uniform_bdry_mass_stiffness[ln][j];
                     }
@@ -2137,7 +3462,7 @@ void IBStandardInitializer::readBoundaryMassFiles(const std::string& extension)
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
     return;
@@ -2157,24 +3482,55 @@ void IBStandardInitializer::readDirectorFiles(const std::string& extension)
         d_directors[ln].resize(num_base_filename);
         for (unsigned int j = 0; j < num_base_filename; ++j)
         {
+            // Collectively read the binary version of the file, if it exists.
+            BinaryStructureData bin_data;
+            const bool read_binary =
+                d_use_binary_structure_files &&
+                read_binary_structure_file(bin_data,
+                                           d_base_filename[ln][j] + extension + ".bin",
+                                           0,
+                                           9,
+                                           9,
+                                           !d_level_data_is_distributed[ln],
+                                           d_object_name);
+            const std::string file_type = read_binary ? "binary" : "ASCII";
+
+            // On distributed levels, send each binary record to the process that
+            // holds the corresponding vertex.
+            if (read_binary && d_level_data_is_distributed[ln])
+            {
+                std::vector<int> key_idxs(bin_data.record_idx.size());
+                for (unsigned int k = 0; k < key_idxs.size(); ++k)
+                {
+                    key_idxs[k] = binary_structure_key_idx(
+                        bin_data.record_idx[k], 0, d_num_vertex[ln][j], d_vertex_offset[ln][j]);
+                }
+                distribute_binary_structure_records(bin_data, key_idxs, d_num_vertex[ln], d_vertex_offset[ln]);
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
-            d_directors[ln][j].resize(d_num_vertex[ln][j], std::vector<double>(3 * 3, 0.0));
+            d_directors[ln][j].resize(d_vertex_posn[ln][j].size(), std::vector<double>(3 * 3, 0.0));
 
-            const std::string directors_filename = d_base_filename[ln][j] + extension;
+            const std::string directors_filename = d_base_filename[ln][j] + extension + (read_binary ? ".bin" : "");
             std::ifstream file_stream;
-            file_stream.open(directors_filename.c_str(), std::ios::in);
-            if (file_stream.is_open())
+            if (!read_binary) file_stream.open(directors_filename.c_str(), std::ios::in);
+            if (read_binary || file_stream.is_open())
             {
                 plog << d_object_name << ":  "
-                     << "processing director data from ASCII input file named " << directors_filename << std::endl
+                     << "processing director data from " << file_type << " input file named " << directors_filename
+                     << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of sets of
                 // directors in the input file.
                 int num_directors_pts = -1;
-                if (!std::getline(file_stream, line_string))
+                if (read_binary)
+                {
+                    num_directors_pts = bin_data.num_records;
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file " << directors_filename << std::endl);
@@ -2199,11 +3555,34 @@ void IBStandardInitializer::readDirectorFiles(const std::string& extension)
 
                 // Each successive set of three lines indicates the initial
                 // configuration of a triad.
-                for (int k = 0; k < num_directors_pts; ++k)
+                const int num_records = read_binary ? static_cast<int>(bin_data.record_idx.size()) : num_directors_pts;
+                for (int k = 0; k < num_records; ++k)
                 {
+                    const int vertex_idx = read_binary ? bin_data.record_idx[k] : k;
+                    std::vector<double> D(3 * 3, 0.0);
                     for (int n = 0; n < 3; ++n)
                     {
-                        if (!std::getline(file_stream, line_string))
+                        if (read_binary)
+                        {
+                            double D_norm_squared = 0.0;
+                            for (int d = 0; d < 3; ++d)
+                            {
+                                D[3 * n + d] = bin_data.double_data[9 * k + 3 * n + d];
+                                D_norm_squared += D[3 * n + d] * D[3 * n + d];
+                            }
+                            const double D_norm = sqrt(D_norm_squared);
+                            if (!MathUtilities<double>::equalEps(D_norm, 1.0))
+                            {
+                                TBOX_WARNING(d_object_name << ":\n  Director vector " << n << " in record "
+                                                           << vertex_idx << " of file " << directors_filename
+                                                           << " is not normalized; norm = " << D_norm << std::endl);
+                                for (int d = 0; d < 3; ++d)
+                                {
+                                    D[3 * n + d] /= D_norm;
+                                }
+                            }
+                        }
+                        else if (!std::getline(file_stream, line_string))
                         {
                             TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line "
                                                      << 3 * k + n + 2 << " of file " << directors_filename
@@ -2216,13 +3595,13 @@ void IBStandardInitializer::readDirectorFiles(const std::string& extension)
                             double D_norm_squared = 0.0;
                             for (int d = 0; d < 3; ++d)
                             {
-                                if (!(line_stream >> d_directors[ln][j][k][3 * n + d]))
+                                if (!(line_stream >> D[3 * n + d]))
                                 {
                                     TBOX_ERROR(d_object_name << ":\n  Invalid entry in input "
                                                                 "file encountered on line " << 3 * k + n + 2
                                                              << " of file " << directors_filename << std::endl);
                                 }
-                                D_norm_squared += d_directors[ln][j][k][3 * n + d] * d_directors[ln][j][k][3 * n + d];
+                                D_norm_squared += D[3 * n + d] * D[3 * n + d];
                             }
                             const double D_norm = sqrt(D_norm_squared);
                             if (!MathUtilities<double>::equalEps(D_norm, 1.0))
@@ -2232,23 +3611,28 @@ void IBStandardInitializer::readDirectorFiles(const std::string& extension)
                                                            << " is not normalized; norm = " << D_norm << std::endl);
                                 for (int d = 0; d < 3; ++d)
                                 {
-                                    d_directors[ln][j][k][3 * n + d] /= D_norm;
+                                    D[3 * n + d] /= D_norm;
                                 }
                             }
                         }
                     }
+
+                    // Store the directors if this process holds the vertex.
+                    const std::pair<int, int> point_idx(j, vertex_idx);
+                    if (d_level_data_is_distributed[ln] && !isLocalVertex(point_idx, ln)) continue;
+                    d_directors[ln][j][getLocalVertexIndex(point_idx, ln)] = D;
                 }
 
                 // Close the input file.
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_directors_pts << " director triads from ASCII input file named "
+                     << "read " << num_directors_pts << " director triads from " << file_type << " input file named "
                      << directors_filename << std::endl << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
     return;
@@ -2274,22 +3658,53 @@ void IBStandardInitializer::readInstrumentationFiles(const std::string& extensio
             const int min_idx = 0;
             const int max_idx = d_num_vertex[ln][j];
 
+            // Collectively read the binary version of the file, if it exists.
+            BinaryStructureData bin_data;
+            const bool read_binary =
+                d_use_binary_structure_files && d_enable_instrumentation[ln][j] &&
+                read_binary_structure_file(bin_data,
+                                           d_base_filename[ln][j] + extension + ".bin",
+                                           3,
+                                           0,
+                                           0,
+                                           !d_level_data_is_distributed[ln],
+                                           d_object_name);
+            const std::string file_type = read_binary ? "binary" : "ASCII";
+
+            // On distributed levels, send each binary record to the process that
+            // holds the vertex.
+            if (read_binary && d_level_data_is_distributed[ln])
+            {
+                std::vector<int> key_idxs(bin_data.record_idx.size());
+                for (unsigned int k = 0; k < key_idxs.size(); ++k)
+                {
+                    key_idxs[k] =
+                        binary_structure_key_idx(bin_data.int_data[3 * k], min_idx, max_idx, d_vertex_offset[ln][j]);
+                }
+                distribute_binary_structure_records(bin_data, key_idxs, d_num_vertex[ln], d_vertex_offset[ln]);
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
-            const std::string inst_filename = d_base_filename[ln][j] + extension;
+            const std::string inst_filename = d_base_filename[ln][j] + extension + (read_binary ? ".bin" : "");
             std::ifstream file_stream;
-            file_stream.open(inst_filename.c_str(), std::ios::in);
-            if (file_stream.is_open() && d_enable_instrumentation[ln][j])
+            if (!read_binary) file_stream.open(inst_filename.c_str(), std::ios::in);
+            if ((read_binary || file_stream.is_open()) && d_enable_instrumentation[ln][j])
             {
                 plog << d_object_name << ":  "
-                     << "processing instrumentation data from ASCII input file named " << inst_filename << std::endl
+                     << "processing instrumentation data from " << file_type << " input file named "
+                     << inst_filename << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of
                 // instruments in the input file.
                 int num_inst = -1;
-                if (!std::getline(file_stream, line_string))
+                if (read_binary)
+                {
+                    num_inst = static_cast<int>(bin_data.names.size());
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file " << inst_filename << std::endl);
@@ -2315,7 +3730,11 @@ void IBStandardInitializer::readInstrumentationFiles(const std::string& extensio
                 // instruments in the input file.
                 for (int m = 0; m < num_inst; ++m)
                 {
-                    if (!std::getline(file_stream, line_string))
+                    if (read_binary)
+                    {
+                        instrument_names.push_back(bin_data.names[m]);
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << m + 2
                                                  << " of file " << inst_filename << std::endl);
@@ -2339,7 +3758,11 @@ void IBStandardInitializer::readInstrumentationFiles(const std::string& extensio
                 // The next line in the file indicates the number of
                 // instrumented IB points in the input file.
                 int num_inst_pts = -1;
-                if (!std::getline(file_stream, line_string))
+                if (read_binary)
+                {
+                    num_inst_pts = bin_data.num_records;
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line "
                                              << num_inst + 2 << " of file " << inst_filename << std::endl);
@@ -2366,10 +3789,38 @@ void IBStandardInitializer::readInstrumentationFiles(const std::string& extensio
                 // points in the input file.
                 std::vector<bool> encountered_instrument_idx;
                 std::map<size_t, std::vector<bool> > encountered_node_idx;
-                for (int k = 0; k < num_inst_pts; ++k)
+                const int num_records = read_binary ? static_cast<int>(bin_data.record_idx.size()) : num_inst_pts;
+                for (int k = 0; k < num_records; ++k)
                 {
-                    int n;
-                    if (!std::getline(file_stream, line_string))
+                    int n = std::numeric_limits<int>::max();
+                    std::pair<int, int> idx(-1, -1);
+                    if (read_binary)
+                    {
+                        const int record = bin_data.record_idx[k];
+                        n = bin_data.int_data[3 * k];
+                        check_binary_vertex_index(n, min_idx, max_idx, record, inst_filename, d_object_name);
+                        idx.first = bin_data.int_data[3 * k + 1];
+                        idx.second = bin_data.int_data[3 * k + 2];
+                        if (idx.first < 0 || idx.first >= num_inst || idx.second < 0)
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record "
+                                                     << record << " of file " << inst_filename << std::endl
+                                                     << "  meter index " << idx.first << " or meter node index "
+                                                     << idx.second << " is out of range" << std::endl);
+                        }
+                        if (idx.first >= static_cast<int>(encountered_instrument_idx.size()))
+                        {
+                            encountered_instrument_idx.resize(idx.first + 1, false);
+                        }
+                        encountered_instrument_idx[idx.first] = true;
+                        if (idx.second >= static_cast<int>(encountered_node_idx[idx.first].size()))
+                        {
+                            encountered_node_idx[idx.first].resize(idx.second + 1, false);
+                        }
+                        encountered_node_idx[idx.first][idx.second] = true;
+                        idx.first += instrument_offset;
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line "
                                                  << num_inst + k + 3 << " of file " << inst_filename << std::endl);
@@ -2390,8 +3841,6 @@ void IBStandardInitializer::readInstrumentationFiles(const std::string& extensio
                                                      << "  vertex index " << n << " is out of range" << std::endl);
                         }
 
-                        std::pair<int, int>& idx = d_instrument_idx[ln][j][n];
-
                         if (!(line_stream >> idx.first))
                         {
                             TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line "
@@ -2433,6 +3882,51 @@ void IBStandardInitializer::readInstrumentationFiles(const std::string& extensio
                         // instrument indices from earlier files.
                         idx.first += instrument_offset;
                     }
+
+                    // Store the instrument index if this process holds the vertex.
+                    const std::pair<int, int> point_idx(j, n);
+                    if (d_level_data_is_distributed[ln] && !isLocalVertex(point_idx, ln)) continue;
+                    d_instrument_idx[ln][j][n] = idx;
+                }
+
+                // On distributed levels, each process has encountered only the
+                // binary records that it holds, so the encountered indices are
+                // combined across processes before they are checked.
+                if (read_binary && d_level_data_is_distributed[ln])
+                {
+                    std::vector<int> meter_flags(num_inst, 0), num_meter_nodes(num_inst, 0);
+                    for (unsigned int m = 0; m < encountered_instrument_idx.size(); ++m)
+                    {
+                        meter_flags[m] = encountered_instrument_idx[m] ? 1 : 0;
+                        num_meter_nodes[m] = static_cast<int>(encountered_node_idx[m].size());
+                    }
+                    SAMRAI_MPI::maxReduction(&meter_flags[0], num_inst);
+                    SAMRAI_MPI::maxReduction(&num_meter_nodes[0], num_inst);
+                    std::vector<int> node_offset(num_inst + 1, 0);
+                    std::partial_sum(num_meter_nodes.begin(), num_meter_nodes.end(), node_offset.begin() + 1);
+                    std::vector<int> node_flags(std::max(node_offset[num_inst], 1), 0);
+                    for (std::map<size_t, std::vector<bool> >::const_iterator it = encountered_node_idx.begin();
+                         it != encountered_node_idx.end();
+                         ++it)
+                    {
+                        for (unsigned int node_idx = 0; node_idx < it->second.size(); ++node_idx)
+                        {
+                            if (it->second[node_idx]) node_flags[node_offset[it->first] + node_idx] = 1;
+                        }
+                    }
+                    SAMRAI_MPI::maxReduction(&node_flags[0], static_cast<int>(node_flags.size()));
+                    int num_meters = 0;
+                    for (int m = 0; m < num_inst; ++m)
+                    {
+                        if (meter_flags[m]) num_meters = m + 1;
+                    }
+                    encountered_instrument_idx.assign(meter_flags.begin(), meter_flags.begin() + num_meters);
+                    encountered_node_idx.clear();
+                    for (int m = 0; m < num_meters; ++m)
+                    {
+                        encountered_node_idx[m].assign(node_flags.begin() + node_offset[m],
+                                                       node_flags.begin() + node_offset[m + 1]);
+                    }
                 }
 
                 // Ensure that a complete range of instrument indices were found
@@ -2480,12 +3974,12 @@ void IBStandardInitializer::readInstrumentationFiles(const std::string& extensio
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_inst_pts << " instrumentation points from ASCII input file named "
+                     << "read " << num_inst_pts << " instrumentation points from " << file_type << " input file named "
                      << inst_filename << std::endl << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
     }
     IBInstrumentationSpec::setInstrumentNames(instrument_names);
@@ -2513,22 +4007,53 @@ void IBStandardInitializer::readSourceFiles(const std::string& extension)
             const int min_idx = 0;
             const int max_idx = d_num_vertex[ln][j];
 
+            // Collectively read the binary version of the file, if it exists.
+            BinaryStructureData bin_data;
+            const bool read_binary =
+                d_use_binary_structure_files && d_enable_sources[ln][j] &&
+                read_binary_structure_file(bin_data,
+                                           d_base_filename[ln][j] + extension + ".bin",
+                                           2,
+                                           0,
+                                           0,
+                                           !d_level_data_is_distributed[ln],
+                                           d_object_name);
+            const std::string file_type = read_binary ? "binary" : "ASCII";
+
+            // On distributed levels, send each binary record to the process that
+            // holds the vertex.
+            if (read_binary && d_level_data_is_distributed[ln])
+            {
+                std::vector<int> key_idxs(bin_data.record_idx.size());
+                for (unsigned int k = 0; k < key_idxs.size(); ++k)
+                {
+                    key_idxs[k] =
+                        binary_structure_key_idx(bin_data.int_data[2 * k], min_idx, max_idx, d_vertex_offset[ln][j]);
+                }
+                distribute_binary_structure_records(bin_data, key_idxs, d_num_vertex[ln], d_vertex_offset[ln]);
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
-            const std::string source_filename = d_base_filename[ln][j] + extension;
+            const std::string source_filename = d_base_filename[ln][j] + extension + (read_binary ? ".bin" : "");
             std::ifstream file_stream;
-            file_stream.open(source_filename.c_str(), std::ios::in);
-            if (file_stream.is_open() && d_enable_sources[ln][j])
+            if (!read_binary) file_stream.open(source_filename.c_str(), std::ios::in);
+            if ((read_binary || file_stream.is_open()) && d_enable_sources[ln][j])
             {
                 plog << d_object_name << ":  "
-                     << "processing source data from ASCII input file named " << source_filename << std::endl
+                     << "processing source data from " << file_type << " input file named " << source_filename
+                     << std::endl
                      << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
 
                 // The first line in the file indicates the number of sources in
                 // the input file.
                 int num_source = -1;
-                if (!std::getline(file_stream, line_string))
+                if (read_binary)
+                {
+                    num_source = static_cast<int>(bin_data.names.size());
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
                                                 "before line 1 of file " << source_filename << std::endl);
@@ -2554,7 +4079,11 @@ void IBStandardInitializer::readSourceFiles(const std::string& extension)
                 // sources in the input file.
                 for (int m = 0; m < num_source; ++m)
                 {
-                    if (!std::getline(file_stream, line_string))
+                    if (read_binary)
+                    {
+                        source_names.push_back(bin_data.names[m]);
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << m + 2
                                                  << " of file " << source_filename << std::endl);
@@ -2579,7 +4108,16 @@ void IBStandardInitializer::readSourceFiles(const std::string& extension)
                 // sources in the input file.
                 for (int m = 0; m < num_source; ++m)
                 {
-                    if (!std::getline(file_stream, line_string))
+                    if (read_binary)
+                    {
+                        if (m >= static_cast<int>(bin_data.values.size()) || bin_data.values[m] <= 0.0)
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Invalid or missing radius for source " << m
+                                                     << " in binary input file " << source_filename << std::endl);
+                        }
+                        source_radii.push_back(bin_data.values[m]);
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << m + 2
                                                  << " of file " << source_filename << std::endl);
@@ -2602,7 +4140,11 @@ void IBStandardInitializer::readSourceFiles(const std::string& extension)
                 // The next line in the file indicates the number of source
                 // points in the input file.
                 int num_source_pts = -1;
-                if (!std::getline(file_stream, line_string))
+                if (read_binary)
+                {
+                    num_source_pts = bin_data.num_records;
+                }
+                else if (!std::getline(file_stream, line_string))
                 {
                     TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line "
                                              << 2 * num_source + 2 << " of file " << source_filename << std::endl);
@@ -2620,10 +4162,27 @@ void IBStandardInitializer::readSourceFiles(const std::string& extension)
 
                 // Each successive line indicates the vertex number and source
                 // number of the IB points in the input file.
-                for (int k = 0; k < num_source_pts; ++k)
+                const int num_records = read_binary ? static_cast<int>(bin_data.record_idx.size()) : num_source_pts;
+                for (int k = 0; k < num_records; ++k)
                 {
-                    int n;
-                    if (!std::getline(file_stream, line_string))
+                    int n = std::numeric_limits<int>::max();
+                    int source_idx = -1;
+                    if (read_binary)
+                    {
+                        const int record = bin_data.record_idx[k];
+                        n = bin_data.int_data[2 * k];
+                        check_binary_vertex_index(n, min_idx, max_idx, record, source_filename, d_object_name);
+                        source_idx = bin_data.int_data[2 * k + 1];
+                        if (source_idx < 0 || source_idx >= num_source)
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record "
+                                                     << record << " of file " << source_filename << std::endl
+                                                     << "  source index " << source_idx << " is out of range"
+                                                     << std::endl);
+                        }
+                        source_idx += source_offset;
+                    }
+                    else if (!std::getline(file_stream, line_string))
                     {
                         TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line "
                                                  << 2 * num_source + k + 3 << " of file " << source_filename
@@ -2647,8 +4206,6 @@ void IBStandardInitializer::readSourceFiles(const std::string& extension)
                                                      << std::endl);
                         }
 
-                        int& source_idx = d_source_idx[ln][j][n];
-
                         if (!(line_stream >> source_idx))
                         {
                             TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line "
@@ -2667,6 +4224,11 @@ void IBStandardInitializer::readSourceFiles(const std::string& extension)
                         // indices from earlier files.
                         source_idx += source_offset;
                     }
+
+                    // Store the source index if this process holds the vertex.
+                    const std::pair<int, int> point_idx(j, n);
+                    if (d_level_data_is_distributed[ln] && !isLocalVertex(point_idx, ln)) continue;
+                    d_source_idx[ln][j][n] = source_idx;
                 }
 
                 // Increment the meter offset.
@@ -2676,12 +4238,13 @@ void IBStandardInitializer::readSourceFiles(const std::string& extension)
                 file_stream.close();
 
                 plog << d_object_name << ":  "
-                     << "read " << num_source_pts << " source points from ASCII input file named " << source_filename
+                     << "read " << num_source_pts << " source points from " << file_type << " input file named "
+                     << source_filename
                      << std::endl << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
             }
 
             // Free the next MPI process to start reading the current file.
-            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+            if (d_use_file_batons && !read_binary && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
         }
         IBStandardSourceGen::setNumSources(ln, source_offset);
         IBStandardSourceGen::setSourceNames(ln, source_names);
@@ -2698,11 +4261,8 @@ void IBStandardInitializer::getPatchVertices(std::vector<std::pair<int, int> >&
                                              const double* const domain_x_upper,
                                              const IntVector<NDIM>& periodic_shift) const
 {
-    // Loop over all of the vertices to determine the indices of those vertices
-    // within the present patch.
-    //
-    // NOTE: This is clearly not the best way to do this, but it will work for
-    // now.
+    // Loop over the vertices in the bins that overlap the present patch to
+    // determine the indices of those vertices within the present patch.
     const Box<NDIM>& patch_box = patch->getBox();
     const CellIndex<NDIM>& patch_lower = patch_box.lower();
     const CellIndex<NDIM>& patch_upper = patch_box.upper();
@@ -2710,11 +4270,32 @@ void IBStandardInitializer::getPatchVertices(std::vector<std::pair<int, int> >&
     const double* const patch_x_lower = patch_geom->getXLower();
     const double* const patch_x_upper = patch_geom->getXUpper();
     const double* const patch_dx = patch_geom->getDx();
-    for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
+    const VertexBinning& binning =
+        getVertexBinning(level_number, patch_dx, domain_x_lower, domain_x_upper, periodic_shift);
+
+    // Determine the range of bins that overlap the patch.  The patch extents
+    // are padded by one cell to guard against roundoff error.
+    Index<NDIM> bin_lower, bin_upper;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const double x_lower = (patch_x_lower[d] - patch_dx[d] - domain_x_lower[d]) / binning.bin_width[d];
+        const double x_upper = (patch_x_upper[d] + patch_dx[d] - domain_x_lower[d]) / binning.bin_width[d];
+        bin_lower(d) = static_cast<int>(std::floor(std::max(x_lower, 0.0)));
+        bin_upper(d) = static_cast<int>(std::floor(std::min(x_upper, static_cast<double>(binning.num_bins(d) - 1))));
+    }
+    const Box<NDIM> bin_box(bin_lower, bin_upper);
+    const size_t num_patch_vertices = patch_vertices.size();
+    for (Box<NDIM>::Iterator b(bin_box); b; b++)
     {
-        for (int k = 0; k < d_num_vertex[level_number][j]; ++k)
+        const Index<NDIM>& bin_idx = b();
+        int bin = 0;
+        for (int d = NDIM - 1; d >= 0; --d)
         {
-            std::pair<int, int> point_index(j, k);
+            bin = bin * binning.num_bins(d) + bin_idx(d);
+        }
+        for (int v = binning.bin_offset[bin]; v < binning.bin_offset[bin + 1]; ++v)
+        {
+            const std::pair<int, int>& point_index = binning.bin_vertices[v];
             const Point& X =
                 getShiftedVertexPosn(point_index, level_number, domain_x_lower, domain_x_upper, periodic_shift);
             const CellIndex<NDIM> idx =
@@ -2722,18 +4303,154 @@ void IBStandardInitializer::getPatchVertices(std::vector<std::pair<int, int> >&
             if (patch_box.contains(idx)) patch_vertices.push_back(point_index);
         }
     }
+
+    // Keep the vertices in the same (structure, vertex) order as the input
+    // files.
+    std::sort(patch_vertices.begin() + num_patch_vertices, patch_vertices.end());
     return;
 } // getPatchVertices
 
+const IBStandardInitializer::VertexBinning&
+IBStandardInitializer::getVertexBinning(const int level_number,
+                                        const double* const dx,
+                                        const double* const domain_x_lower,
+                                        const double* const domain_x_upper,
+                                        const IntVector<NDIM>& periodic_shift) const
+{
+    // Look for an existing binning computed with respect to the same grid
+    // spacing.
+    std::vector<VertexBinning>& level_binnings = d_vertex_binning[level_number];
+    for (std::vector<VertexBinning>::const_iterator it = level_binnings.begin(); it != level_binnings.end(); ++it)
+    {
+        bool match = it->periodic_shift == periodic_shift;
+        for (unsigned int d = 0; d < NDIM && match; ++d)
+        {
+            match = it->dx[d] == dx[d];
+        }
+        if (match) return *it;
+    }
+
+    // Bin the vertices into a uniform grid of bins that are (initially) eight
+    // grid cells wide.  The bins are coarsened if there would be many more bins
+    // than vertices.
+    //
+    // Once the structure data on the level have been pruned, or if they are
+    // distributed, only the local vertices are binned.
+    const bool level_data_is_local =
+        d_level_data_is_pruned[level_number] || d_level_data_is_distributed[level_number];
+    const size_t num_base_filename = d_num_vertex[level_number].size();
+    std::vector<int> num_binned_vertex(num_base_filename);
+    for (unsigned int j = 0; j < num_base_filename; ++j)
+    {
+        num_binned_vertex[j] = level_data_is_local ? static_cast<int>(d_local_vertex_idx[level_number][j].size()) :
+                                                     d_num_vertex[level_number][j];
+    }
+    const int num_vertex = std::accumulate(num_binned_vertex.begin(), num_binned_vertex.end(), 0);
+    level_binnings.push_back(VertexBinning());
+    VertexBinning& binning = level_binnings.back();
+    binning.periodic_shift = periodic_shift;
+    int bin_cells = 8;
+    while (true)
+    {
+        double num_bins = 1.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            binning.dx[d] = dx[d];
+            binning.bin_width[d] = bin_cells * dx[d];
+            binning.num_bins(d) = std::max(
+                1, static_cast<int>(std::ceil((domain_x_upper[d] - domain_x_lower[d]) / binning.bin_width[d])));
+            num_bins *= binning.num_bins(d);
+        }
+        if (num_bins <= 4.0 * num_vertex + 1024.0) break;
+        bin_cells *= 2;
+    }
+    int num_bins = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        num_bins *= binning.num_bins(d);
+    }
+
+    // Determine the bin of each vertex.  Vertices outside of the physical
+    // domain are assigned to the nearest bin.
+    std::vector<int> vertex_bin(num_vertex);
+    binning.bin_offset.resize(num_bins + 1, 0);
+    for (unsigned int j = 0, v = 0; j < num_base_filename; ++j)
+    {
+        for (int p = 0; p < num_binned_vertex[j]; ++p, ++v)
+        {
+            const int k = level_data_is_local ? d_local_vertex_idx[level_number][j][p] : p;
+            const Point& X = getShiftedVertexPosn(
+                std::make_pair(j, k), level_number, domain_x_lower, domain_x_upper, periodic_shift);
+            int bin = 0;
+            for (int d = NDIM - 1; d >= 0; --d)
+            {
+                const double x = std::floor((X[d] - domain_x_lower[d]) / binning.bin_width[d]);
+                const int bin_idx =
+                    static_cast<int>(std::max(0.0, std::min(x, static_cast<double>(binning.num_bins(d) - 1))));
+                bin = bin * binning.num_bins(d) + bin_idx;
+            }
+            vertex_bin[v] = bin;
+            ++binning.bin_offset[bin + 1];
+        }
+    }
+    std::partial_sum(binning.bin_offset.begin(), binning.bin_offset.end(), binning.bin_offset.begin());
+    binning.bin_vertices.resize(num_vertex);
+    std::vector<int> bin_pos(binning.bin_offset.begin(), binning.bin_offset.end() - 1);
+    for (unsigned int j = 0, v = 0; j < num_base_filename; ++j)
+    {
+        for (int p = 0; p < num_binned_vertex[j]; ++p, ++v)
+        {
+            const int k = level_data_is_local ? d_local_vertex_idx[level_number][j][p] : p;
+            binning.bin_vertices[bin_pos[vertex_bin[v]]++] = std::make_pair(j, k);
+        }
+    }
+    return binning;
+} // getVertexBinning
+
 int IBStandardInitializer::getCanonicalLagrangianIndex(const std::pair<int, int>& point_index,
                                                        const int level_number) const
 {
     return d_vertex_offset[level_number][point_index.first] + point_index.second;
 } // getCanonicalLagrangianIndex
 
+std::pair<int, int> IBStandardInitializer::getPointIndex(const int lag_idx, const int level_number) const
+{
+    const std::vector<int>& vertex_offset = d_vertex_offset[level_number];
+    const int j = static_cast<int>(std::upper_bound(vertex_offset.begin(), vertex_offset.end(), lag_idx) -
+                                   vertex_offset.begin()) -
+                  1;
+    return std::make_pair(j, lag_idx - vertex_offset[j]);
+} // getPointIndex
+
+bool IBStandardInitializer::isLocalVertex(const std::pair<int, int>& point_index, const int level_number) const
+{
+    if (!d_level_data_is_pruned[level_number] && !d_level_data_is_distributed[level_number]) return true;
+    const std::vector<int>& local_idx = d_local_vertex_idx[level_number][point_index.first];
+    return std::binary_search(local_idx.begin(), local_idx.end(), point_index.second);
+} // isLocalVertex
+
+int IBStandardInitializer::getLocalVertexIndex(const std::pair<int, int>& point_index, const int level_number) const
+{
+    if (!d_level_data_is_pruned[level_number] && !d_level_data_is_distributed[level_number])
+    {
+        return point_index.second;
+    }
+    const std::vector<int>& local_idx = d_local_vertex_idx[level_number][point_index.first];
+    const std::vector<int>::const_iterator it =
+        std::lower_bound(local_idx.begin(), local_idx.end(), point_index.second);
+    if (it == local_idx.end() || *it != point_index.second)
+    {
+        TBOX_ERROR(d_object_name << "::getLocalVertexIndex():\n"
+                                 << "  data for vertex " << point_index.second << " of structure "
+                                 << d_base_filename[level_number][point_index.first] << " on level " << level_number
+                                 << " are not retained by this process." << std::endl);
+    }
+    return static_cast<int>(it - local_idx.begin());
+} // getLocalVertexIndex
+
 Point IBStandardInitializer::getVertexPosn(const std::pair<int, int>& point_index, const int level_number) const
 {
-    return d_vertex_posn[level_number][point_index.first][point_index.second];
+    return d_vertex_posn[level_number][point_index.first][getLocalVertexIndex(point_index, level_number)];
 } // getVertexPosn
 
 Point IBStandardInitializer::getShiftedVertexPosn(const std::pair<int, int>& point_index,
@@ -2761,25 +4478,25 @@ Point IBStandardInitializer::getShiftedVertexPosn(const std::pair<int, int>& poi
 const IBStandardInitializer::TargetSpec&
 IBStandardInitializer::getVertexTargetSpec(const std::pair<int, int>& point_index, const int level_number) const
 {
-    return d_target_spec_data[level_number][point_index.first][point_index.second];
+    return d_target_spec_data[level_number][point_index.first][getLocalVertexIndex(point_index, level_number)];
 } // getVertexTargetSpec
 
 const IBStandardInitializer::AnchorSpec&
 IBStandardInitializer::getVertexAnchorSpec(const std::pair<int, int>& point_index, const int level_number) const
 {
-    return d_anchor_spec_data[level_number][point_index.first][point_index.second];
+    return d_anchor_spec_data[level_number][point_index.first][getLocalVertexIndex(point_index, level_number)];
 } // getVertexAnchorSpec
 
 const IBStandardInitializer::BdryMassSpec&
 IBStandardInitializer::getVertexBdryMassSpec(const std::pair<int, int>& point_index, const int level_number) const
 {
-    return d_bdry_mass_spec_data[level_number][point_index.first][point_index.second];
+    return d_bdry_mass_spec_data[level_number][point_index.first][getLocalVertexIndex(point_index, level_number)];
 } // getVertexBdryMassSpec
 
 const std::vector<double>& IBStandardInitializer::getVertexDirectors(const std::pair<int, int>& point_index,
                                                                      const int level_number) const
 {
-    return d_directors[level_number][point_index.first][point_index.second];
+    return d_directors[level_number][point_index.first][getLocalVertexIndex(point_index, level_number)];
 } // getVertexDirectors
 
 std::pair<int, int> IBStandardInitializer::getVertexInstrumentationIndices(const std::pair<int, int>& point_index,
@@ -2997,6 +4714,16 @@ void IBStandardInitializer::getFromInput(Pointer<Database> db)
     // reading the same file at once.
     if (db->keyExists("use_file_batons")) d_use_file_batons = db->getBool("use_file_batons");
 
+    // Determine whether to read binary versions of the input files
+    // collectively when they are available.
+    if (db->keyExists("use_binary_structure_files"))
+        d_use_binary_structure_files = db->getBool("use_binary_structure_files");
+
+    // Determine whether to free the structure data that are not required by
+    // the local MPI process once each level has been initialized.
+    if (db->keyExists("retain_only_local_structure_data"))
+        d_retain_only_local_structure_data = db->getBool("retain_only_local_structure_data");
+
     // Determine the (maximum) number of levels in the locally refined grid.
     // Note that each piece of the Lagrangian structure must be assigned to a
     // particular level of the grid.
@@ -3018,12 +4745,15 @@ void IBStandardInitializer::getFromInput(Pointer<Database> db)
 
     // Resize the vectors that are indexed by the level number.
     d_level_is_initialized.resize(d_max_levels, false);
+    d_level_data_is_pruned.resize(d_max_levels, false);
+    d_level_data_is_distributed.resize(d_max_levels, false);
 
     d_base_filename.resize(d_max_levels);
 
     d_num_vertex.resize(d_max_levels);
     d_vertex_offset.resize(d_max_levels);
     d_vertex_posn.resize(d_max_levels);
+    d_local_vertex_idx.resize(d_max_levels);
 
     d_enable_springs.resize(d_max_levels);
     d_spring_edge_map.resize(d_max_levels);
@@ -3085,6 +4815,8 @@ void IBStandardInitializer::getFromInput(Pointer<Database> db)
 
     d_global_index_offset.resize(d_max_levels);
 
+    d_vertex_binning.resize(d_max_levels);
+
     // Determine the various input file names.
     //
     // Prefer to use the new ``structure_names'' key, but revert to the
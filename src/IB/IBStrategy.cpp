@@ -34,6 +34,7 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <limits>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -159,6 +160,29 @@ void IBStrategy::updateFixedLEOperators()
     return;
 } // updateFixedLEOperators
 
+void IBStrategy::computeSubcycledLagrangianForce(
+    int /*u_data_idx*/,
+    const std::vector<Pointer<CoarsenSchedule<NDIM> > >& /*u_synch_scheds*/,
+    const std::vector<Pointer<RefineSchedule<NDIM> > >& /*u_ghost_fill_scheds*/,
+    double /*current_time*/,
+    double /*new_time*/,
+    int /*num_substeps*/)
+{
+    TBOX_ERROR("IBStrategy::computeSubcycledLagrangianForce(): unimplemented\n");
+    return;
+} // computeSubcycledLagrangianForce
+
+double IBStrategy::getStableTimestep()
+{
+    return std::numeric_limits<double>::max();
+} // getStableTimestep
+
+void IBStrategy::beginSpreadForce(double /*data_time*/)
+{
+    // intentionally blank
+    return;
+} // beginSpreadForce
+
 bool IBStrategy::hasFluidSources() const
 {
     return false;
@@ -41,6 +41,7 @@
 #include <string>
 #include <vector>
 
+#include "ArrayData.h"
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
 #include "Box.h"
@@ -62,11 +63,9 @@
 #include "RefineSchedule.h"
 #include "SideData.h"
 #include "SideGeometry.h"
-#include "SideIndex.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
-#include "boost/array.hpp"
 #include "boost/multi_array.hpp"
 #include "ibamr/IMPMethod.h"
 #include "ibamr/MaterialPointSpec.h"
@@ -116,20 +115,17 @@ namespace
 
 static const std::string KERNEL_FCN = "IB_6";
 static const int kernel_width = 3;
+static const int stencil_width = 2 * kernel_width;
 void kernel(const double X,
             const double patch_x_lower,
-            const double /*patch_x_upper*/,
             const double dx,
             const int patch_box_lower,
-            const int /*patch_box_upper*/,
             int& stencil_box_lower,
-            int& stencil_box_upper,
-            boost::multi_array<double, 1>& phi,
-            boost::multi_array<double, 1>& dphi)
+            double* const phi,
+            double* const dphi)
 {
     const double X_o_dx = (X - patch_x_lower) / dx;
     stencil_box_lower = round(X_o_dx) + patch_box_lower - kernel_width;
-    stencil_box_upper = stencil_box_lower + 2 * kernel_width - 1;
     const double r = 1.0 - X_o_dx + ((stencil_box_lower + kernel_width - 1 - patch_box_lower) + 0.5);
 
     const double r2 = r * r;
@@ -170,6 +166,156 @@ void kernel(const double X,
     return;
 }
 
+// Evaluate the one-dimensional kernel weights and their derivatives about X for
+// both the cell-centered and the side-centered (i.e., staggered) grids.  The
+// weights for a side-centered component are the tensor product of the
+// side-centered weights in the direction of the component and the
+// cell-centered weights in all other directions, so that only 2*NDIM kernel
+// evaluations are required per node.
+inline void computeKernelWeights(const double* const X,
+                                 const double* const x_lower,
+                                 const double* const dx,
+                                 const Box<NDIM>& patch_box,
+                                 int stencil_lower_cc[NDIM],
+                                 int stencil_lower_sc[NDIM],
+                                 double phi_cc[NDIM][stencil_width],
+                                 double dphi_cc[NDIM][stencil_width],
+                                 double phi_sc[NDIM][stencil_width],
+                                 double dphi_sc[NDIM][stencil_width])
+{
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        kernel(X[d], x_lower[d], dx[d], patch_box.lower(d), stencil_lower_cc[d], phi_cc[d], dphi_cc[d]);
+        kernel(X[d], x_lower[d] - 0.5 * dx[d], dx[d], patch_box.lower(d), stencil_lower_sc[d], phi_sc[d], dphi_sc[d]);
+    }
+    return;
+} // computeKernelWeights
+
+// Interpolate one component of side-centered data and its gradient using the
+// tensor-product kernel with one-dimensional weights phi and derivatives dphi
+// supported on stencil_box.  Only values in interp_box are used.  The sums are
+// factored one direction at a time, and values are accessed directly through
+// the array data.
+inline void interpolateComponent(const ArrayData<NDIM, double>& u_array,
+                                 const Box<NDIM>& interp_box,
+                                 const Box<NDIM>& stencil_box,
+                                 const double* const phi[NDIM],
+                                 const double* const dphi[NDIM],
+                                 const double* const dx,
+                                 double& U,
+                                 double* const Grad_U)
+{
+    if (interp_box.empty()) return;
+    const Box<NDIM>& u_box = u_array.getBox();
+    const double* const u = u_array.getPointer();
+    const int n0 = u_box.numberCells(0);
+    const int i0_lower = interp_box.lower(0), num_i0 = interp_box.numberCells(0);
+    const double* const phi0 = phi[0] + (i0_lower - stencil_box.lower(0));
+    const double* const dphi0 = dphi[0] + (i0_lower - stencil_box.lower(0));
+    double G[NDIM] = { 0.0 };
+#if (NDIM == 2)
+    for (int i1 = interp_box.lower(1); i1 <= interp_box.upper(1); ++i1)
+    {
+        const double* const u_row = u + (i1 - u_box.lower(1)) * n0 + (i0_lower - u_box.lower(0));
+        double a = 0.0, da = 0.0;
+        for (int m = 0; m < num_i0; ++m)
+        {
+            a += u_row[m] * phi0[m];
+            da += u_row[m] * dphi0[m];
+        }
+        const double p1 = phi[1][i1 - stencil_box.lower(1)], dp1 = dphi[1][i1 - stencil_box.lower(1)];
+        U += a * p1;
+        G[0] += da * p1;
+        G[1] += a * dp1;
+    }
+#endif
+#if (NDIM == 3)
+    const int n1 = u_box.numberCells(1);
+    for (int i2 = interp_box.lower(2); i2 <= interp_box.upper(2); ++i2)
+    {
+        double b = 0.0, db0 = 0.0, db1 = 0.0;
+        for (int i1 = interp_box.lower(1); i1 <= interp_box.upper(1); ++i1)
+        {
+            const double* const u_row =
+                u + ((i2 - u_box.lower(2)) * n1 + (i1 - u_box.lower(1))) * n0 + (i0_lower - u_box.lower(0));
+            double a = 0.0, da = 0.0;
+            for (int m = 0; m < num_i0; ++m)
+            {
+                a += u_row[m] * phi0[m];
+                da += u_row[m] * dphi0[m];
+            }
+            const double p1 = phi[1][i1 - stencil_box.lower(1)], dp1 = dphi[1][i1 - stencil_box.lower(1)];
+            b += a * p1;
+            db0 += da * p1;
+            db1 += a * dp1;
+        }
+        const double p2 = phi[2][i2 - stencil_box.lower(2)], dp2 = dphi[2][i2 - stencil_box.lower(2)];
+        U += b * p2;
+        G[0] += db0 * p2;
+        G[1] += db1 * p2;
+        G[2] += b * dp2;
+    }
+#endif
+    for (unsigned int k = 0; k < NDIM; ++k) Grad_U[k] -= G[k] / dx[k];
+    return;
+} // interpolateComponent
+
+// Spread the divergence of one row of a stress tensor, tau(component, :), to
+// one component of side-centered data using the tensor-product kernel with
+// one-dimensional weights phi and derivatives dphi supported on stencil_box.
+// Only values in spread_box are modified.
+inline void spreadComponent(ArrayData<NDIM, double>& f_array,
+                            const Box<NDIM>& spread_box,
+                            const Box<NDIM>& stencil_box,
+                            const double* const phi[NDIM],
+                            const double* const dphi[NDIM],
+                            const double* const dx,
+                            const double* const tau_row,
+                            const double scale)
+{
+    if (spread_box.empty()) return;
+    const Box<NDIM>& f_box = f_array.getBox();
+    double* const f = f_array.getPointer();
+    const int n0 = f_box.numberCells(0);
+    const int i0_lower = spread_box.lower(0), num_i0 = spread_box.numberCells(0);
+    const double* const phi0 = phi[0] + (i0_lower - stencil_box.lower(0));
+    const double* const dphi0 = dphi[0] + (i0_lower - stencil_box.lower(0));
+    double c[NDIM];
+    for (unsigned int k = 0; k < NDIM; ++k) c[k] = scale * tau_row[k] / dx[k];
+#if (NDIM == 2)
+    for (int i1 = spread_box.lower(1); i1 <= spread_box.upper(1); ++i1)
+    {
+        double* const f_row = f + (i1 - f_box.lower(1)) * n0 + (i0_lower - f_box.lower(0));
+        const double a = c[0] * phi[1][i1 - stencil_box.lower(1)];
+        const double b = c[1] * dphi[1][i1 - stencil_box.lower(1)];
+        for (int m = 0; m < num_i0; ++m)
+        {
+            f_row[m] += a * dphi0[m] + b * phi0[m];
+        }
+    }
+#endif
+#if (NDIM == 3)
+    const int n1 = f_box.numberCells(1);
+    for (int i2 = spread_box.lower(2); i2 <= spread_box.upper(2); ++i2)
+    {
+        const double p2 = phi[2][i2 - stencil_box.lower(2)], dp2 = dphi[2][i2 - stencil_box.lower(2)];
+        for (int i1 = spread_box.lower(1); i1 <= spread_box.upper(1); ++i1)
+        {
+            double* const f_row =
+                f + ((i2 - f_box.lower(2)) * n1 + (i1 - f_box.lower(1))) * n0 + (i0_lower - f_box.lower(0));
+            const double p1 = phi[1][i1 - stencil_box.lower(1)], dp1 = dphi[1][i1 - stencil_box.lower(1)];
+            const double a = c[0] * p1 * p2;
+            const double b = c[1] * dp1 * p2 + c[2] * p1 * dp2;
+            for (int m = 0; m < num_i0; ++m)
+            {
+                f_row[m] += a * dphi0[m] + b * phi0[m];
+            }
+        }
+    }
+#endif
+    return;
+} // spreadComponent
+
 // Version of IMPMethod restart file data.
 static const int IMP_METHOD_VERSION = 1;
 }
@@ -450,13 +596,15 @@ void IMPMethod::interpolateVelocity(const int u_data_idx,
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const x_lower = patch_geom->getXLower();
-            const double* const x_upper = patch_geom->getXUpper();
             const double* const dx = patch_geom->getDx();
             Box<NDIM> side_boxes[NDIM];
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(u_data->getGhostBox() * idx_data->getGhostBox(), axis);
             }
+            int stencil_lower_cc[NDIM], stencil_lower_sc[NDIM];
+            double phi_cc[NDIM][stencil_width], dphi_cc[NDIM][stencil_width];
+            double phi_sc[NDIM][stencil_width], dphi_sc[NDIM][stencil_width];
             for (LNodeSetData::CellIterator it(idx_data->getGhostBox()); it; it++)
             {
                 const Index<NDIM>& i = *it;
@@ -472,58 +620,38 @@ void IMPMethod::interpolateVelocity(const int u_data_idx,
 
                     // Interpolate U and Grad U using a smoothed kernel
                     // function evaluated about X.
-                    Box<NDIM> stencil_box;
-                    const int stencil_size = LEInteractor::getStencilSize(KERNEL_FCN);
-                    boost::array<boost::multi_array<double, 1>, NDIM> phi, dphi;
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        phi[d].resize(boost::extents[stencil_size]);
-                        dphi[d].resize(boost::extents[stencil_size]);
-                    }
+                    computeKernelWeights(X,
+                                         x_lower,
+                                         dx,
+                                         patch_box,
+                                         stencil_lower_cc,
+                                         stencil_lower_sc,
+                                         phi_cc,
+                                         dphi_cc,
+                                         phi_sc,
+                                         dphi_sc);
                     for (unsigned int component = 0; component < NDIM; ++component)
                     {
+                        Box<NDIM> stencil_box;
+                        const double* phi[NDIM];
+                        const double* dphi[NDIM];
                         for (unsigned int d = 0; d < NDIM; ++d)
                         {
-                            kernel(X[d],
-                                   x_lower[d] + (d == component ? -0.5 * dx[d] : 0.0),
-                                   x_upper[d] + (d == component ? +0.5 * dx[d] : 0.0),
-                                   dx[d],
-                                   patch_box.lower(d),
-                                   patch_box.upper(d) + (d == component ? 1 : 0),
-                                   stencil_box.lower(d),
-                                   stencil_box.upper(d),
-                                   phi[d],
-                                   dphi[d]);
-                        }
-                        for (Box<NDIM>::Iterator b(stencil_box * side_boxes[component]); b; b++)
-                        {
-                            const Index<NDIM>& i = b();
-                            const Index<NDIM> i_shift = i - stencil_box.lower();
-                            const SideIndex<NDIM> i_s(i, component, SideIndex<NDIM>::Lower);
-                            const double u = (*u_data)(i_s);
-                            double w = 1.0;
-                            for (unsigned int d = 0; d < NDIM; ++d)
-                            {
-                                w *= phi[d][i_shift(d)];
-                            }
-                            U(component) += u * w;
-                            for (unsigned int k = 0; k < NDIM; ++k)
-                            {
-                                double dw_dx_k = 1.0;
-                                for (unsigned int d = 0; d < NDIM; ++d)
-                                {
-                                    if (d == k)
-                                    {
-                                        dw_dx_k *= dphi[d][i_shift(d)] / dx[d];
-                                    }
-                                    else
-                                    {
-                                        dw_dx_k *= phi[d][i_shift(d)];
-                                    }
-                                }
-                                Grad_U(component, k) -= u * dw_dx_k;
-                            }
+                            stencil_box.lower(d) = (d == component ? stencil_lower_sc[d] : stencil_lower_cc[d]);
+                            stencil_box.upper(d) = stencil_box.lower(d) + stencil_width - 1;
+                            phi[d] = (d == component ? phi_sc[d] : phi_cc[d]);
+                            dphi[d] = (d == component ? dphi_sc[d] : dphi_cc[d]);
                         }
+                        double Grad_U_row[NDIM] = { 0.0 };
+                        interpolateComponent(u_data->getArrayData(component),
+                                             stencil_box * side_boxes[component],
+                                             stencil_box,
+                                             phi,
+                                             dphi,
+                                             dx,
+                                             U(component),
+                                             Grad_U_row);
+                        for (unsigned int k = 0; k < NDIM; ++k) Grad_U(component, k) = Grad_U_row[k];
                     }
                     for (int i = 0; i < NDIM; ++i)
                     {
@@ -841,10 +969,12 @@ void IMPMethod::spreadForce(const int f_data_idx,
             for (unsigned int d = 0; d < NDIM; ++d) side_boxes[d] = SideGeometry<NDIM>::toSideBox(patch_box, d);
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const x_lower = patch_geom->getXLower();
-            const double* const x_upper = patch_geom->getXUpper();
             const double* const dx = patch_geom->getDx();
             double dV_c = 1.0;
             for (unsigned int d = 0; d < NDIM; ++d) dV_c *= dx[d];
+            int stencil_lower_cc[NDIM], stencil_lower_sc[NDIM];
+            double phi_cc[NDIM][stencil_width], dphi_cc[NDIM][stencil_width];
+            double phi_sc[NDIM][stencil_width], dphi_sc[NDIM][stencil_width];
             for (LNodeSetData::CellIterator it(idx_data->getGhostBox()); it; it++)
             {
                 const Index<NDIM>& i = *it;
@@ -869,53 +999,38 @@ void IMPMethod::spreadForce(const int f_data_idx,
 
                     // Weight tau using a smooth kernel function evaluated about
                     // X.
-                    Box<NDIM> stencil_box;
-                    const int stencil_size = LEInteractor::getStencilSize(KERNEL_FCN);
-                    boost::array<boost::multi_array<double, 1>, NDIM> phi, dphi;
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        phi[d].resize(boost::extents[stencil_size]);
-                        dphi[d].resize(boost::extents[stencil_size]);
-                    }
+                    computeKernelWeights(X,
+                                         x_lower,
+                                         dx,
+                                         patch_box,
+                                         stencil_lower_cc,
+                                         stencil_lower_sc,
+                                         phi_cc,
+                                         dphi_cc,
+                                         phi_sc,
+                                         dphi_sc);
                     for (unsigned int component = 0; component < NDIM; ++component)
                     {
+                        Box<NDIM> stencil_box;
+                        const double* phi[NDIM];
+                        const double* dphi[NDIM];
+                        double tau_row[NDIM];
                         for (unsigned int d = 0; d < NDIM; ++d)
                         {
-                            kernel(X[d],
-                                   x_lower[d] + (d == component ? -0.5 * dx[d] : 0.0),
-                                   x_upper[d] + (d == component ? +0.5 * dx[d] : 0.0),
-                                   dx[d],
-                                   patch_box.lower(d),
-                                   patch_box.upper(d) + (d == component ? 1 : 0),
-                                   stencil_box.lower(d),
-                                   stencil_box.upper(d),
-                                   phi[d],
-                                   dphi[d]);
-                        }
-                        for (Box<NDIM>::Iterator b(stencil_box * side_boxes[component]); b; b++)
-                        {
-                            const Index<NDIM>& i = b();
-                            const Index<NDIM> i_shift = i - stencil_box.lower();
-                            const SideIndex<NDIM> i_s(i, component, SideIndex<NDIM>::Lower);
-                            double f = 0.0;
-                            for (unsigned int k = 0; k < NDIM; ++k)
-                            {
-                                double dw_dx_k = 1.0;
-                                for (unsigned int d = 0; d < NDIM; ++d)
-                                {
-                                    if (d == k)
-                                    {
-                                        dw_dx_k *= dphi[d][i_shift(d)] / dx[d];
-                                    }
-                                    else
-                                    {
-                                        dw_dx_k *= phi[d][i_shift(d)];
-                                    }
-                                }
-                                f += tau(component, k) * dw_dx_k;
-                            }
-                            (*f_data)(i_s) += f * wgt / dV_c;
+                            stencil_box.lower(d) = (d == component ? stencil_lower_sc[d] : stencil_lower_cc[d]);
+                            stencil_box.upper(d) = stencil_box.lower(d) + stencil_width - 1;
+                            phi[d] = (d == component ? phi_sc[d] : phi_cc[d]);
+                            dphi[d] = (d == component ? dphi_sc[d] : dphi_cc[d]);
+                            tau_row[d] = tau(component, d);
                         }
+                        spreadComponent(f_data->getArrayData(component),
+                                        stencil_box * side_boxes[component],
+                                        stencil_box,
+                                        phi,
+                                        dphi,
+                                        dx,
+                                        tau_row,
+                                        wgt / dV_c);
                     }
                 }
             }
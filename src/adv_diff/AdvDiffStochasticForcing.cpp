@@ -69,6 +69,7 @@
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PatchDataMemoryManager.h"
 #include "ibtk/PhysicalBoundaryUtilities.h"
 #include "ibtk/SideDataSynchronization.h"
 #include "muParser.h"
@@ -146,11 +147,17 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(const std::string& object_nam
     d_C_current_cc_idx = var_db->registerVariableAndContext(d_C_cc_var, d_context, ghosts_cc);
     d_C_half_cc_idx = var_db->registerClonedPatchDataIndex(d_C_cc_var, d_C_current_cc_idx);
     d_C_new_cc_idx = var_db->registerClonedPatchDataIndex(d_C_cc_var, d_C_current_cc_idx);
+    PatchDataMemoryManager* memory_manager = PatchDataMemoryManager::getManager();
+    memory_manager->registerPatchDataOwner(d_C_half_cc_idx, d_object_name);
+    memory_manager->registerPatchDataOwner(d_C_new_cc_idx, d_object_name);
     d_F_sc_var = new SideVariable<NDIM, double>(d_object_name + "::F_sc", C_depth);
     static const IntVector<NDIM> ghosts_sc = 0;
     d_F_sc_idx = var_db->registerVariableAndContext(d_F_sc_var, d_context, ghosts_sc);
     for (int k = 0; k < d_num_rand_vals; ++k)
+    {
         d_F_sc_idxs.push_back(var_db->registerClonedPatchDataIndex(d_F_sc_var, d_F_sc_idx));
+        memory_manager->registerPatchDataOwner(d_F_sc_idxs.back(), d_object_name);
+    }
     return;
 } // AdvDiffStochasticForcing
 
@@ -997,6 +997,10 @@ void INSStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Patc
     // Setup a boundary op to set velocity boundary conditions on regrid.
     d_fill_after_regrid_phys_bdry_bc_op = new CartSideRobinPhysBdryOp(d_U_scratch_idx, d_U_bc_coefs, false);
 
+    // Register the counters that are recorded by the performance telemetry
+    // object.
+    registerTelemetryCounter("stokes_iterations");
+
     // Indicate that the integrator has been initialized.
     d_integrator_is_initialized = true;
     return;
@@ -1250,6 +1254,7 @@ void INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_ti
 
     // Solve for u(n+1), p(n+1/2).
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
+    addTelemetryCount("stokes_iterations", d_stokes_solver->getNumIterations());
     if (d_enable_logging)
         plog << d_object_name
              << "::integrateHierarchy(): stokes solve number of iterations = " << d_stokes_solver->getNumIterations()
@@ -76,6 +76,7 @@
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PatchDataMemoryManager.h"
 #include "ibtk/PhysicalBoundaryUtilities.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
@@ -226,20 +227,29 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(const std::string&
     static const IntVector<NDIM> ghosts_cc = 1;
     d_W_cc_idx = var_db->registerVariableAndContext(d_W_cc_var, d_context, ghosts_cc);
     for (int k = 0; k < d_num_rand_vals; ++k)
+    {
         d_W_cc_idxs.push_back(var_db->registerClonedPatchDataIndex(d_W_cc_var, d_W_cc_idx));
+        PatchDataMemoryManager::getManager()->registerPatchDataOwner(d_W_cc_idxs.back(), d_object_name);
+    }
 #if (NDIM == 2)
     d_W_nc_var = new NodeVariable<NDIM, double>(d_object_name + "::W_nc", 2);
     static const IntVector<NDIM> ghosts_nc = 0;
     d_W_nc_idx = var_db->registerVariableAndContext(d_W_nc_var, d_context, ghosts_nc);
     for (int k = 0; k < d_num_rand_vals; ++k)
+    {
         d_W_nc_idxs.push_back(var_db->registerClonedPatchDataIndex(d_W_nc_var, d_W_nc_idx));
+        PatchDataMemoryManager::getManager()->registerPatchDataOwner(d_W_nc_idxs.back(), d_object_name);
+    }
 #endif
 #if (NDIM == 3)
     d_W_ec_var = new EdgeVariable<NDIM, double>(d_object_name + "::W_ec", 2);
     static const IntVector<NDIM> ghosts_ec = 0;
     d_W_ec_idx = var_db->registerVariableAndContext(d_W_ec_var, d_context, ghosts_ec);
     for (int k = 0; k < d_num_rand_vals; ++k)
+    {
         d_W_ec_idxs.push_back(var_db->registerClonedPatchDataIndex(d_W_ec_var, d_W_ec_idx));
+        PatchDataMemoryManager::getManager()->registerPatchDataOwner(d_W_ec_idxs.back(), d_object_name);
+    }
 #endif
     return;
 } // INSStaggeredStochasticForcing
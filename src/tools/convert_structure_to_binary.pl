@@ -0,0 +1,223 @@
+#!/usr/bin/perl -w
+#
+# filename: convert_structure_to_binary.pl
+# author: agent
+# usage: convert_structure_to_binary.pl <NDIM> <input filename> [<output filename>]
+#
+# A simple Perl script to convert an ASCII IBStandardInitializer input file
+# (.vertex, .spring, .xspring, .beam, .rod, .target, .anchor, .mass,
+# .director, .inst, or .source) into the binary format that is read
+# collectively by IBStandardInitializer when use_binary_structure_files is
+# enabled.  By default, the output file name is the input file name with the
+# extension ".bin" appended.
+
+use strict;
+
+if ($#ARGV < 1 || $#ARGV > 2) {
+    die "incorrect number of command line arguments.\nusage:\n  convert_structure_to_binary.pl <NDIM> <input filename> [<output filename>]\n";
+}
+
+# parse the command line arguments
+my $ndim = shift @ARGV;  chomp $ndim;
+my $input_filename = shift @ARGV;  chomp $input_filename;
+my $output_filename = ($#ARGV >= 0 ? shift @ARGV : "$input_filename.bin");  chomp $output_filename;
+
+if ($ndim != 2 && $ndim != 3) {
+    die "error: NDIM must be 2 or 3\n";
+}
+
+my ($extension) = ($input_filename =~ /\.(\w+)$/);
+if (!defined($extension)) {
+    die "error: cannot determine the type of input file $input_filename\n";
+}
+
+print "input file: $input_filename\n";
+print "output file: $output_filename\n";
+
+open(IN, "$input_filename") || die "error: cannot open $input_filename for reading: $!";
+
+# read the next line of the input file, discarding any text following a '!',
+# '#', or '%' character
+my $line_number = 0;
+sub next_line {
+    my $line = <IN>;
+    $line_number++;
+    if (!defined($line)) {
+        die "error: premature end to input file encountered before line $line_number of file $input_filename\n";
+    }
+    chomp $line;
+    $line =~ s/[!#%].*//;
+    return $line;
+}
+
+sub next_fields {
+    my $line = next_line();
+    $line =~ s/^\s+//;
+    return split(/\s+/, $line);
+}
+
+sub next_count {
+    my @fields = next_fields();
+    if ($#fields < 0 || $fields[0] !~ /^\d+$/ || $fields[0] <= 0) {
+        die "error: invalid entry in input file encountered on line $line_number of file $input_filename\n";
+    }
+    return $fields[0];
+}
+
+sub check_fields {
+    my ($fields, $min_fields) = @_;
+    if ($#{$fields} + 1 < $min_fields) {
+        die "error: invalid entry in input file encountered on line $line_number of file $input_filename\n";
+    }
+}
+
+# the records in the file, along with the record layout
+my @records = ();
+my @names = ();
+my @values = ();
+my $n_int = 0;
+my $n_double = 0;
+
+if ($extension eq "vertex") {
+    my $n = next_count();
+    ($n_int, $n_double) = (0, $ndim);
+    for (my $k = 0; $k < $n; $k++) {
+        my @f = next_fields();  check_fields(\@f, $ndim);
+        push @records, [ @f[0 .. $ndim - 1] ];
+    }
+}
+elsif ($extension eq "spring" || $extension eq "xspring") {
+    my $n = next_count();
+    $n_int = 3;
+    $n_double = -1;
+    for (my $k = 0; $k < $n; $k++) {
+        my @f = next_fields();  check_fields(\@f, 4);
+        my $fcn_idx = ($#f >= 4 ? $f[4] : 0);
+        my @params = ($f[2], $f[3], @f[5 .. $#f]);
+        if ($n_double < 0) {
+            $n_double = $#params + 1;
+        }
+        elsif ($n_double != $#params + 1) {
+            die "error: all springs in a binary file must have the same number of parameters (line $line_number of file $input_filename)\n";
+        }
+        push @records, [ $f[0], $f[1], $fcn_idx, @params ];
+    }
+}
+elsif ($extension eq "beam") {
+    my $n = next_count();
+    my @lines = ();
+    my $has_curvature = 0;
+    for (my $k = 0; $k < $n; $k++) {
+        my @f = next_fields();  check_fields(\@f, 4);
+        if ($#f + 1 > 4) {
+            check_fields(\@f, 4 + $ndim);
+            $has_curvature = 1;
+        }
+        push @lines, [ @f ];
+    }
+    ($n_int, $n_double) = (3, ($has_curvature ? 1 + $ndim : 1));
+    foreach my $f (@lines) {
+        my @record = @{$f}[0 .. 3];
+        if ($has_curvature) {
+            for (my $d = 0; $d < $ndim; $d++) {
+                push @record, ($#{$f} >= 4 + $d ? $f->[4 + $d] : 0.0);
+            }
+        }
+        push @records, [ @record ];
+    }
+}
+elsif ($extension eq "rod") {
+    my $n = next_count();
+    ($n_int, $n_double) = (2, 10);
+    for (my $k = 0; $k < $n; $k++) {
+        my @f = next_fields();  check_fields(\@f, 9);
+        my @record = @f[0 .. 8];
+        for (my $m = 9; $m < 12; $m++) {
+            push @record, ($#f >= $m ? $f[$m] : 0.0);
+        }
+        push @records, [ @record ];
+    }
+}
+elsif ($extension eq "target") {
+    my $n = next_count();
+    ($n_int, $n_double) = (1, 2);
+    for (my $k = 0; $k < $n; $k++) {
+        my @f = next_fields();  check_fields(\@f, 2);
+        push @records, [ $f[0], $f[1], ($#f >= 2 ? $f[2] : 0.0) ];
+    }
+}
+elsif ($extension eq "anchor") {
+    my $n = next_count();
+    ($n_int, $n_double) = (1, 0);
+    for (my $k = 0; $k < $n; $k++) {
+        my @f = next_fields();  check_fields(\@f, 1);
+        push @records, [ $f[0] ];
+    }
+}
+elsif ($extension eq "mass") {
+    my $n = next_count();
+    ($n_int, $n_double) = (1, 2);
+    for (my $k = 0; $k < $n; $k++) {
+        my @f = next_fields();  check_fields(\@f, 3);
+        push @records, [ @f[0 .. 2] ];
+    }
+}
+elsif ($extension eq "director") {
+    my $n = next_count();
+    ($n_int, $n_double) = (0, 9);
+    for (my $k = 0; $k < $n; $k++) {
+        my @record = ();
+        for (my $m = 0; $m < 3; $m++) {
+            my @f = next_fields();  check_fields(\@f, 3);
+            push @record, @f[0 .. 2];
+        }
+        push @records, [ @record ];
+    }
+}
+elsif ($extension eq "inst" || $extension eq "source") {
+    my $num_names = next_count();
+    for (my $m = 0; $m < $num_names; $m++) {
+        my $name = next_line();
+        $name =~ s/^\s+//;
+        $name =~ s/\s+$//;
+        push @names, $name;
+    }
+    if ($extension eq "source") {
+        for (my $m = 0; $m < $num_names; $m++) {
+            my @f = next_fields();  check_fields(\@f, 1);
+            push @values, $f[0];
+        }
+    }
+    my $n = next_count();
+    ($n_int, $n_double) = (($extension eq "inst" ? 3 : 2), 0);
+    for (my $k = 0; $k < $n; $k++) {
+        my @f = next_fields();  check_fields(\@f, $n_int);
+        push @records, [ @f[0 .. $n_int - 1] ];
+    }
+}
+else {
+    die "error: unknown input file type: .$extension\n";
+}
+close(IN);
+
+# the header is followed by the names, the header values, and the records
+my $preamble = "";
+foreach my $name (@names) {
+    $preamble .= pack("l a*", length($name), $name);
+}
+$preamble .= pack("d*", @values);
+my $header_size = 48;
+my $data_offset = $header_size + length($preamble);
+my $num_records = $#records + 1;
+
+open(OUT, ">$output_filename") || die "error: cannot open $output_filename for writing: $!";
+binmode OUT;
+print OUT pack("a8 l l l l l l q q", "IBSTRUCT", 1, $ndim, $n_int, $n_double, $#names + 1, $#values + 1, $num_records, $data_offset);
+print OUT $preamble;
+my $record_format = ("l" x $n_int) . ("d" x $n_double);
+foreach my $record (@records) {
+    print OUT pack($record_format, @{$record});
+}
+close(OUT);
+
+print "wrote $num_records records to $output_filename\n";